@@ -0,0 +1,163 @@
+/**
+ * Demonstração do Alocador de Nós com Caches por Thread em C
+ *
+ * Este código mostra o uso do alocador de Alocador_Nos.h:
+ * - Comparação de tempo com malloc/free em uma pilha de nós
+ * - Produtor e consumidor em threads diferentes: os nós alocados por uma
+ *   thread são liberados pela outra e voltam a circular pelo depósito
+ * - Estatísticas de acertos, faltas, nós em uso e bytes reservados
+ *
+ *   gcc -O2 -pthread Alocador_Nos.c -o alocador_nos
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <time.h>
+#include "Alocador_Nos.h"
+
+struct no {
+    int numero;
+    struct no *proximo;
+};
+
+static struct alocadorNos alocador = ALOCADOR_NOS_INICIALIZADOR(struct no);
+
+// Lista compartilhada entre produtor e consumidor
+struct canal {
+    pthread_mutex_t trava;
+    pthread_cond_t sinal;
+    struct no *inicio;
+    bool terminou;
+};
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+/**
+ * Produtor: aloca nós e os entrega em lotes ao consumidor
+ */
+static void *produtor(void *arg) {
+    struct canal *canal = (struct canal *) arg;
+
+    for (int lote = 0; lote < 2000; lote++) {
+        struct no *inicio = NULL;
+        for (int i = 0; i < 500; i++) {
+            struct no *novoNo = (struct no *) alocarNo(&alocador);
+            novoNo->numero = i;
+            novoNo->proximo = inicio;
+            inicio = novoNo;
+        }
+
+        pthread_mutex_lock(&canal->trava);
+        struct no *ultimo = inicio;
+        while (ultimo->proximo != NULL) {
+            ultimo = ultimo->proximo;
+        }
+        ultimo->proximo = canal->inicio;
+        canal->inicio = inicio;
+        pthread_cond_signal(&canal->sinal);
+        pthread_mutex_unlock(&canal->trava);
+    }
+
+    pthread_mutex_lock(&canal->trava);
+    canal->terminou = true;
+    pthread_cond_signal(&canal->sinal);
+    pthread_mutex_unlock(&canal->trava);
+
+    liberarCacheThread(&alocador);
+    return NULL;
+}
+
+/**
+ * Consumidor: libera os nós recebidos (liberação entre threads)
+ */
+static void *consumidor(void *arg) {
+    struct canal *canal = (struct canal *) arg;
+    long liberados = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&canal->trava);
+        while (canal->inicio == NULL && !canal->terminou) {
+            pthread_cond_wait(&canal->sinal, &canal->trava);
+        }
+        struct no *inicio = canal->inicio;
+        bool terminou = canal->terminou;
+        canal->inicio = NULL;
+        pthread_mutex_unlock(&canal->trava);
+
+        while (inicio != NULL) {
+            struct no *remover = inicio;
+            inicio = inicio->proximo;
+            liberarNo(&alocador, remover);
+            liberados++;
+        }
+        if (terminou) {
+            break;
+        }
+    }
+
+    liberarCacheThread(&alocador);
+    printf("Consumidor liberou %ld nos\n", liberados);
+    return NULL;
+}
+
+int main() {
+    const int total = 10000000;
+    struct timespec t0;
+
+    // Pilha de nós com malloc/free
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    struct no *topo = NULL;
+    for (int i = 0; i < total; i++) {
+        struct no *novoNo = (struct no *) malloc(sizeof(struct no));
+        novoNo->numero = i;
+        novoNo->proximo = topo;
+        topo = novoNo;
+    }
+    while (topo != NULL) {
+        struct no *remover = topo;
+        topo = topo->proximo;
+        free(remover);
+    }
+    double tempoMalloc = segundosDesde(&t0);
+
+    // A mesma pilha com o alocador de nós
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < total; i++) {
+        struct no *novoNo = (struct no *) alocarNo(&alocador);
+        novoNo->numero = i;
+        novoNo->proximo = topo;
+        topo = novoNo;
+    }
+    while (topo != NULL) {
+        struct no *remover = topo;
+        topo = topo->proximo;
+        liberarNo(&alocador, remover);
+    }
+    double tempoAlocador = segundosDesde(&t0);
+
+    printf("%d alocacoes + liberacoes:\n", total);
+    printf("malloc/free: %.3f s\n", tempoMalloc);
+    printf("alocador:    %.3f s (%.1fx)\n", tempoAlocador, tempoMalloc / tempoAlocador);
+    imprimirEstatisticasAlocador(&alocador, "pilha");
+
+    // Produtor e consumidor em threads diferentes
+    struct canal canal = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, false};
+    pthread_t threadProdutor, threadConsumidor;
+    pthread_create(&threadConsumidor, NULL, consumidor, &canal);
+    pthread_create(&threadProdutor, NULL, produtor, &canal);
+    pthread_join(threadProdutor, NULL);
+    pthread_join(threadConsumidor, NULL);
+    imprimirEstatisticasAlocador(&alocador, "entre threads");
+
+    destruirAlocador(&alocador);
+    return 0;
+}
@@ -0,0 +1,378 @@
+/**
+ * Alocador de Nós de Tamanho Fixo com Caches por Thread em C
+ *
+ * Todas as estruturas encadeadas do repositório fazem um malloc e um free
+ * por nó. Este alocador substitui essas chamadas por:
+ * - Carregadores (magazines) por thread: cada thread mantém dois vetores de
+ *   ponteiros livres (o carregado e o anterior) e atende alocações e
+ *   liberações sem trava enquanto eles têm espaço/objetos
+ * - Depósito global: carregadores cheios e vazios trocados sob uma trava,
+ *   o que permite que um nó liberado por outra thread volte a circular
+ * - Blocos (slabs) de 64 KB recortados em nós quando o depósito está vazio
+ * - Estatísticas de acertos no cache da thread, faltas (idas ao depósito),
+ *   nós em uso e bytes reservados
+ *
+ * Uso:
+ *   static struct alocadorNos alocador = ALOCADOR_NOS_INICIALIZADOR(struct no);
+ *   struct no *novoNo = (struct no *) alocarNo(&alocador);
+ *   liberarNo(&alocador, novoNo);
+ *
+ * Os contadores de cada thread são somados aos globais quando ela passa pelo
+ * depósito ou chama liberarCacheThread(); por isso as estatísticas podem
+ * ficar levemente atrasadas. Uma thread que termina deve chamar
+ * liberarCacheThread() para devolver seus nós ao depósito.
+ *
+ * Os nós precisam ter ao menos o tamanho de um ponteiro: se faltar memória
+ * para um carregador vazio, um nó liberado é encadeado por ele mesmo em uma
+ * lista de transbordo do alocador, em vez de ser perdido.
+ *
+ * Todas as funções são static inline: o arquivo é incluído por cada programa.
+ */
+
+#ifndef ALOCADOR_NOS_H
+#define ALOCADOR_NOS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#define TAMANHO_CARREGADOR 64          // Nós por carregador
+#define BYTES_BLOCO_ALOCADOR (64 * 1024)
+#define MAX_ALOCADORES 16              // Alocadores distintos por programa
+
+// Carregador: pilha de nós livres trocada inteira entre thread e depósito
+struct carregador {
+    struct carregador *proximo;        // Encadeamento no depósito
+    int quantidade;
+    void *nos[TAMANHO_CARREGADOR];
+};
+
+// Bloco de memória recortado em nós
+struct blocoAlocador {
+    struct blocoAlocador *proximo;
+};
+
+// Estatísticas consolidadas de um alocador
+struct estatisticasAlocador {
+    unsigned long acertos;             // Operações atendidas pelo cache da thread
+    unsigned long faltas;              // Operações que passaram pelo depósito
+    long nosEmUso;                     // Nós alocados e ainda não liberados
+    size_t bytesReservados;            // Memória obtida do sistema (blocos)
+};
+
+// Alocador de nós de um único tamanho
+struct alocadorNos {
+    size_t tamanho;                    // Tamanho de cada nó
+    atomic_int id;                     // Índice do cache por thread (+1; 0 = não atribuído)
+    pthread_mutex_t trava;             // Protege o depósito e os blocos
+    struct carregador *cheios;         // Depósito: carregadores com nós
+    struct carregador *vazios;         // Depósito: carregadores sem nós
+    struct blocoAlocador *blocos;      // Blocos obtidos do sistema
+    char *livre;                       // Próximo nó ainda não recortado do bloco atual
+    size_t restante;                   // Bytes restantes no bloco atual
+    void *transbordo;                  // Nós liberados sem carregador livre (encadeados por eles mesmos)
+    atomic_ulong acertos;
+    atomic_ulong faltas;
+    atomic_long nosEmUso;
+    atomic_size_t bytesReservados;
+};
+
+// Cache de uma thread para um alocador
+struct cacheThreadAlocador {
+    struct carregador *carregado;
+    struct carregador *anterior;
+    unsigned long acertos;             // Ainda não somados ao alocador
+    long nosEmUso;                     // Variação ainda não somada ao alocador
+};
+
+#define ALOCADOR_NOS_INICIALIZADOR(tipo) \
+    { sizeof(tipo), 0, PTHREAD_MUTEX_INITIALIZER, NULL, NULL, NULL, NULL, 0, NULL, 0, 0, 0, 0 }
+
+static atomic_int proximoIdAlocador = 0;
+static _Thread_local struct cacheThreadAlocador cachesAlocador[MAX_ALOCADORES];
+
+/**
+ * Retorna o cache da thread atual para um alocador
+ * @param alocador Ponteiro para o alocador
+ * @return Ponteiro para o cache
+ */
+static inline struct cacheThreadAlocador *cacheDaThread(struct alocadorNos *alocador) {
+    int id = atomic_load_explicit(&alocador->id, memory_order_acquire);
+    if (__builtin_expect(id == 0, 0)) {
+        int novo = atomic_fetch_add(&proximoIdAlocador, 1) + 1;
+        if (novo > MAX_ALOCADORES) {
+            fprintf(stderr, "Limite de %d alocadores excedido.\n", MAX_ALOCADORES);
+            exit(EXIT_FAILURE);
+        }
+        if (!atomic_compare_exchange_strong(&alocador->id, &id, novo)) {
+            novo = id;  // Outra thread atribuiu primeiro
+        }
+        id = novo;
+    }
+    return &cachesAlocador[id - 1];
+}
+
+/**
+ * Soma os contadores pendentes da thread ao alocador (com a trava)
+ */
+static inline void consolidarContadores(struct alocadorNos *alocador, struct cacheThreadAlocador *cache) {
+    atomic_fetch_add_explicit(&alocador->acertos, cache->acertos, memory_order_relaxed);
+    atomic_fetch_add_explicit(&alocador->nosEmUso, cache->nosEmUso, memory_order_relaxed);
+    atomic_fetch_add_explicit(&alocador->faltas, 1, memory_order_relaxed);
+    cache->acertos = 0;
+    cache->nosEmUso = 0;
+}
+
+/**
+ * Obtém um carregador vazio do depósito ou do sistema (com a trava)
+ * @return Ponteiro para o carregador ou NULL
+ */
+static inline struct carregador *carregadorVazio(struct alocadorNos *alocador) {
+    struct carregador *c = alocador->vazios;
+    if (c != NULL) {
+        alocador->vazios = c->proximo;
+        return c;
+    }
+    c = (struct carregador *) malloc(sizeof(struct carregador));
+    if (c != NULL) {
+        c->quantidade = 0;
+    }
+    return c;
+}
+
+/**
+ * Devolve um carregador ao depósito, na lista adequada (com a trava)
+ */
+static inline void devolverCarregador(struct alocadorNos *alocador, struct carregador *c) {
+    if (c == NULL) {
+        return;
+    }
+    if (c->quantidade > 0) {
+        c->proximo = alocador->cheios;
+        alocador->cheios = c;
+    } else {
+        c->proximo = alocador->vazios;
+        alocador->vazios = c;
+    }
+}
+
+/**
+ * Enche um carregador recortando nós novos dos blocos (com a trava)
+ * @return Quantidade de nós obtidos
+ */
+static inline int recortarBlocos(struct alocadorNos *alocador, struct carregador *c) {
+    while (c->quantidade < TAMANHO_CARREGADOR) {
+        if (alocador->restante < alocador->tamanho) {
+            struct blocoAlocador *bloco = (struct blocoAlocador *) malloc(BYTES_BLOCO_ALOCADOR);
+            if (bloco == NULL) {
+                break;
+            }
+            bloco->proximo = alocador->blocos;
+            alocador->blocos = bloco;
+            // Os nós começam após o cabeçalho, alinhados como o malloc
+            alocador->livre = (char *) bloco + sizeof(max_align_t);
+            alocador->restante = BYTES_BLOCO_ALOCADOR - sizeof(max_align_t);
+            atomic_fetch_add_explicit(&alocador->bytesReservados, BYTES_BLOCO_ALOCADOR, memory_order_relaxed);
+        }
+        c->nos[c->quantidade++] = alocador->livre;
+        alocador->livre += alocador->tamanho;
+        alocador->restante -= alocador->tamanho;
+    }
+    return c->quantidade;
+}
+
+/**
+ * Caminho lento da alocação: troca o carregador vazio por um cheio
+ * @return Ponteiro para o nó ou NULL se faltar memória
+ */
+static inline void *alocarNoLento(struct alocadorNos *alocador, struct cacheThreadAlocador *cache) {
+    pthread_mutex_lock(&alocador->trava);
+    consolidarContadores(alocador, cache);
+
+    struct carregador *cheio = alocador->cheios;
+    if (cheio != NULL) {
+        alocador->cheios = cheio->proximo;
+        devolverCarregador(alocador, cache->anterior);
+        cache->anterior = cache->carregado;
+        cache->carregado = cheio;
+    } else if (alocador->transbordo != NULL) {
+        // Nós guardados por liberarNoLento quando faltou carregador
+        void *no = alocador->transbordo;
+        alocador->transbordo = *(void **) no;
+        pthread_mutex_unlock(&alocador->trava);
+        cache->nosEmUso++;
+        return no;
+    } else {
+        if (cache->carregado == NULL) {
+            cache->carregado = carregadorVazio(alocador);
+        }
+        if (cache->carregado == NULL || recortarBlocos(alocador, cache->carregado) == 0) {
+            pthread_mutex_unlock(&alocador->trava);
+            return NULL;
+        }
+    }
+    pthread_mutex_unlock(&alocador->trava);
+
+    cache->nosEmUso++;
+    return cache->carregado->nos[--cache->carregado->quantidade];
+}
+
+/**
+ * Aloca um nó
+ * @param alocador Ponteiro para o alocador
+ * @return Ponteiro para o nó ou NULL se faltar memória
+ */
+static inline void *alocarNo(struct alocadorNos *alocador) {
+    struct cacheThreadAlocador *cache = cacheDaThread(alocador);
+    struct carregador *c = cache->carregado;
+
+    if (__builtin_expect(c == NULL || c->quantidade == 0, 0)) {
+        // Carregado vazio: usa o anterior se ele tiver nós
+        c = cache->anterior;
+        if (c == NULL || c->quantidade == 0) {
+            return alocarNoLento(alocador, cache);
+        }
+        cache->anterior = cache->carregado;
+        cache->carregado = c;
+    }
+
+    cache->acertos++;
+    cache->nosEmUso++;
+    return c->nos[--c->quantidade];
+}
+
+/**
+ * Caminho lento da liberação: troca o carregador cheio por um vazio
+ */
+static inline void liberarNoLento(struct alocadorNos *alocador, struct cacheThreadAlocador *cache, void *no) {
+    pthread_mutex_lock(&alocador->trava);
+    consolidarContadores(alocador, cache);
+
+    cache->nosEmUso--;
+    struct carregador *vazio = carregadorVazio(alocador);
+    if (vazio == NULL) {
+        // Sem memória nem para um carregador: o nó vai para o transbordo
+        *(void **) no = alocador->transbordo;
+        alocador->transbordo = no;
+        pthread_mutex_unlock(&alocador->trava);
+        return;
+    }
+    devolverCarregador(alocador, cache->anterior);
+    cache->anterior = cache->carregado;
+    cache->carregado = vazio;
+    pthread_mutex_unlock(&alocador->trava);
+
+    vazio->nos[vazio->quantidade++] = no;
+}
+
+/**
+ * Libera um nó (pode ter sido alocado por outra thread)
+ * @param alocador Ponteiro para o alocador
+ * @param no Ponteiro para o nó (NULL é ignorado)
+ */
+static inline void liberarNo(struct alocadorNos *alocador, void *no) {
+    if (no == NULL) {
+        return;
+    }
+
+    struct cacheThreadAlocador *cache = cacheDaThread(alocador);
+    struct carregador *c = cache->carregado;
+
+    if (__builtin_expect(c == NULL || c->quantidade == TAMANHO_CARREGADOR, 0)) {
+        // Carregado cheio: usa o anterior se ele estiver vazio
+        c = cache->anterior;
+        if (c == NULL || c->quantidade == TAMANHO_CARREGADOR) {
+            liberarNoLento(alocador, cache, no);
+            return;
+        }
+        cache->anterior = cache->carregado;
+        cache->carregado = c;
+    }
+
+    cache->acertos++;
+    cache->nosEmUso--;
+    c->nos[c->quantidade++] = no;
+}
+
+/**
+ * Devolve os carregadores da thread atual ao depósito
+ * @param alocador Ponteiro para o alocador
+ */
+static inline void liberarCacheThread(struct alocadorNos *alocador) {
+    struct cacheThreadAlocador *cache = cacheDaThread(alocador);
+
+    pthread_mutex_lock(&alocador->trava);
+    atomic_fetch_add_explicit(&alocador->acertos, cache->acertos, memory_order_relaxed);
+    atomic_fetch_add_explicit(&alocador->nosEmUso, cache->nosEmUso, memory_order_relaxed);
+    cache->acertos = 0;
+    cache->nosEmUso = 0;
+    devolverCarregador(alocador, cache->carregado);
+    devolverCarregador(alocador, cache->anterior);
+    cache->carregado = NULL;
+    cache->anterior = NULL;
+    pthread_mutex_unlock(&alocador->trava);
+}
+
+/**
+ * Lê as estatísticas do alocador (inclui os contadores da thread atual)
+ * @param alocador Ponteiro para o alocador
+ * @return Estatísticas consolidadas
+ */
+static inline struct estatisticasAlocador estatisticasAlocador(struct alocadorNos *alocador) {
+    struct cacheThreadAlocador *cache = cacheDaThread(alocador);
+    struct estatisticasAlocador e;
+    e.acertos = atomic_load(&alocador->acertos) + cache->acertos;
+    e.faltas = atomic_load(&alocador->faltas);
+    e.nosEmUso = atomic_load(&alocador->nosEmUso) + cache->nosEmUso;
+    e.bytesReservados = atomic_load(&alocador->bytesReservados);
+    return e;
+}
+
+/**
+ * Imprime as estatísticas do alocador
+ * @param alocador Ponteiro para o alocador
+ * @param nome Nome exibido
+ */
+static inline void imprimirEstatisticasAlocador(struct alocadorNos *alocador, const char *nome) {
+    struct estatisticasAlocador e = estatisticasAlocador(alocador);
+    unsigned long total = e.acertos + e.faltas;
+    printf("Alocador %s: acertos=%lu faltas=%lu (%.2f%% no cache da thread) "
+           "nos em uso=%ld bytes reservados=%zu\n",
+           nome, e.acertos, e.faltas, total ? 100.0 * (double) e.acertos / (double) total : 0.0,
+           e.nosEmUso, e.bytesReservados);
+}
+
+/**
+ * Devolve toda a memória do alocador ao sistema
+ * Todas as threads devem ter chamado liberarCacheThread() antes.
+ * @param alocador Ponteiro para o alocador
+ */
+static inline void destruirAlocador(struct alocadorNos *alocador) {
+    liberarCacheThread(alocador);
+
+    pthread_mutex_lock(&alocador->trava);
+    struct carregador *listas[2] = {alocador->cheios, alocador->vazios};
+    for (int i = 0; i < 2; i++) {
+        while (listas[i] != NULL) {
+            struct carregador *remover = listas[i];
+            listas[i] = remover->proximo;
+            free(remover);
+        }
+    }
+    while (alocador->blocos != NULL) {
+        struct blocoAlocador *remover = alocador->blocos;
+        alocador->blocos = remover->proximo;
+        free(remover);
+    }
+    alocador->cheios = alocador->vazios = NULL;
+    alocador->livre = NULL;
+    alocador->restante = 0;
+    alocador->transbordo = NULL;        // Os nós do transbordo estavam nos blocos
+    atomic_store(&alocador->bytesReservados, 0);
+    atomic_store(&alocador->nosEmUso, 0);
+    pthread_mutex_unlock(&alocador->trava);
+}
+
+#endif
@@ -4,6 +4,11 @@
  * Este código implementa uma Árvore AVL com as seguintes funcionalidades:
  * - Inserir nós mantendo o balanceamento
  * - Rotações simples e duplas para balancear a árvore
+ * - Buscar um número
+ * - Remover um número, rebalanceando no caminho de volta
+ * - Gravar a árvore em uma imagem binária e consultá-la direto do arquivo
+ *   mapeado, ou restaurá-la sem refazer as inserções (opcional, compilado com
+ *   -DIMAGEM_BINARIA; ver Imagem_Binaria.h)
  * 
  * Conceito:
  * A Árvore AVL é uma árvore binária de busca que mantém o equilíbrio ao garantir
@@ -11,6 +16,9 @@
  * não seja maior que 1.
  */
 
+#if defined(IMAGEM_BINARIA) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE          // madvise e MADV_* com -std=c11 (ver Imagem_Binaria.h)
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -121,6 +129,227 @@ struct NoAVL* inserirAVL(struct NoAVL* no, int numero) {
     return no;
 }
 
+/**
+ * Busca um número na Árvore AVL
+ * @param no Ponteiro para o nó raiz
+ * @param numero Valor procurado
+ * @return Ponteiro para o nó com o número ou NULL
+ */
+struct NoAVL* buscarAVL(struct NoAVL* no, int numero) {
+    while (no && no->numero != numero)
+        no = numero < no->numero ? no->esquerda : no->direita;
+    return no;
+}
+
+/**
+ * Remove um número da Árvore AVL
+ * @param no Ponteiro para o nó raiz
+ * @param numero Valor a ser removido
+ * @return Novo nó raiz após a remoção e balanceamento
+ */
+struct NoAVL* removerAVL(struct NoAVL* no, int numero) {
+    if (!no)
+        return NULL;
+
+    if (numero < no->numero) {
+        no->esquerda = removerAVL(no->esquerda, numero);
+    } else if (numero > no->numero) {
+        no->direita = removerAVL(no->direita, numero);
+    } else if (!no->esquerda || !no->direita) {
+        // Zero ou um filho: o filho (ou NULL) ocupa o lugar do nó
+        struct NoAVL* filho = no->esquerda ? no->esquerda : no->direita;
+        free(no);
+        return filho;
+    } else {
+        // Dois filhos: copia o sucessor e o remove da subárvore direita
+        struct NoAVL* sucessor = no->direita;
+        while (sucessor->esquerda)
+            sucessor = sucessor->esquerda;
+        no->numero = sucessor->numero;
+        no->direita = removerAVL(no->direita, sucessor->numero);
+    }
+
+    no->altura = 1 + (altura(no->esquerda) > altura(no->direita) ? altura(no->esquerda) : altura(no->direita));
+
+    int balance = fatorBalanceamento(no);
+
+    if (balance > 1 && fatorBalanceamento(no->esquerda) >= 0)
+        return rotacaoDireita(no);
+
+    if (balance > 1) {
+        no->esquerda = rotacaoEsquerda(no->esquerda);
+        return rotacaoDireita(no);
+    }
+
+    if (balance < -1 && fatorBalanceamento(no->direita) <= 0)
+        return rotacaoEsquerda(no);
+
+    if (balance < -1) {
+        no->direita = rotacaoDireita(no->direita);
+        return rotacaoEsquerda(no);
+    }
+
+    return no;
+}
+
+/**
+ * Libera todos os nós da Árvore AVL
+ * @param no Ponteiro para o nó raiz
+ */
+void liberarAVL(struct NoAVL* no) {
+    if (!no)
+        return;
+    liberarAVL(no->esquerda);
+    liberarAVL(no->direita);
+    free(no);
+}
+
+#ifdef IMAGEM_BINARIA
+// Imagem binária (só POSIX: mmap). Compile com -DIMAGEM_BINARIA, ver Imagem_Binaria.h
+#include "../Imagem_Binaria/Imagem_Binaria.h"
+
+// Nó da imagem binária: os filhos são índices de registro, em pós-ordem
+struct NoImagemAVL {
+    int32_t numero;
+    int32_t altura;
+    uint32_t esquerda;
+    uint32_t direita;
+};
+
+// Árvore AVL aberta de uma imagem, consultada sem reconstrução
+struct ImagemAVL {
+    const struct NoImagemAVL *nos;
+    uint32_t quantidade;
+    uint32_t raiz;              // SEM_LIGACAO se a árvore está vazia
+    struct imagemMapeada mapa;
+};
+
+/**
+ * Grava uma subárvore em pós-ordem: os filhos saem antes do pai, então o
+ * índice de cada filho já é conhecido quando o pai é escrito
+ * @param g Gravação em andamento
+ * @param no Raiz da subárvore
+ * @param proximo Índice do próximo registro (avança a cada nó gravado)
+ * @return Índice do registro da raiz da subárvore, ou SEM_LIGACAO se vazia
+ */
+uint32_t gravarSubarvoreAVL(struct gravacaoImagem* g, struct NoAVL* no, uint32_t* proximo) {
+    if (!no)
+        return SEM_LIGACAO;
+    struct NoImagemAVL registro;
+    registro.esquerda = gravarSubarvoreAVL(g, no->esquerda, proximo);
+    registro.direita = gravarSubarvoreAVL(g, no->direita, proximo);
+    registro.numero = no->numero;
+    registro.altura = no->altura;
+    gravarRegistro(g, &registro, sizeof(registro));
+    return (*proximo)++;
+}
+
+/**
+ * Grava a Árvore AVL em uma imagem binária, em uma passada sequencial
+ * @param raiz Ponteiro para o nó raiz
+ * @param caminho Arquivo da imagem
+ * @return true se gravou
+ */
+bool salvarAVL(struct NoAVL* raiz, const char* caminho) {
+    struct gravacaoImagem g;
+    if (!iniciarGravacaoImagem(&g, caminho))
+        return false;
+    uint32_t quantidade = 0;
+    struct cabecalhoImagem c;
+    memset(&c, 0, sizeof(c));
+    memcpy(c.magica, "AVLIMAGE", 8);
+    c.tamanhoRegistro = sizeof(struct NoImagemAVL);
+    c.raiz = gravarSubarvoreAVL(&g, raiz, &quantidade);
+    c.registros = quantidade;
+    return concluirGravacaoImagem(&g, &c);
+}
+
+/**
+ * Abre uma imagem da Árvore AVL, mapeando-a na memória
+ * @param caminho Arquivo da imagem
+ * @param imagem Recebe a árvore mapeada
+ * @return false se o arquivo não existe ou não é uma imagem de AVL válida
+ */
+bool abrirImagemAVL(const char* caminho, struct ImagemAVL* imagem) {
+    if (!mapearImagem(caminho, "AVLIMAGE", sizeof(struct NoImagemAVL), 0, &imagem->mapa))
+        return false;
+    imagem->nos = (const struct NoImagemAVL*) imagem->mapa.registros;
+    imagem->quantidade = (uint32_t) imagem->mapa.cabecalho->registros;
+    imagem->raiz = imagem->mapa.cabecalho->raiz;
+    return true;
+}
+
+/**
+ * Busca um número direto na imagem mapeada
+ * Em pós-ordem todo filho tem índice menor que o do pai. Parar quando o
+ * índice não diminui cobre a falta de filho (SEM_LIGACAO) e impede que uma
+ * imagem corrompida leve a busca para fora do arquivo ou a um ciclo.
+ * @param imagem Árvore aberta com abrirImagemAVL
+ * @param numero Valor procurado
+ * @return Ponteiro para o registro com o número ou NULL
+ */
+const struct NoImagemAVL* buscarImagemAVL(const struct ImagemAVL* imagem, int numero) {
+    uint32_t i = imagem->raiz;
+    if (i == SEM_LIGACAO)
+        return NULL;
+    for (;;) {
+        const struct NoImagemAVL* no = &imagem->nos[i];
+        if (no->numero == numero)
+            return no;
+        uint32_t filho = numero < no->numero ? no->esquerda : no->direita;
+        if (filho >= i)
+            return NULL;
+        i = filho;
+    }
+}
+
+/**
+ * Reconstrói a Árvore AVL em memória a partir da imagem
+ * Os registros são lidos em ordem (pós-ordem), copiando alturas e ligações:
+ * nenhuma comparação nem rotação, O(n) no total.
+ * @param imagem Árvore aberta com abrirImagemAVL
+ * @param raiz Recebe a raiz da árvore reconstruída (NULL se vazia)
+ * @return false se as ligações da imagem não formam uma árvore (nada é alocado)
+ */
+bool restaurarAVL(const struct ImagemAVL* imagem, struct NoAVL** raiz) {
+    *raiz = NULL;
+    if (!conferirArvoreImagem(&imagem->nos[0].esquerda, sizeof(struct NoImagemAVL) / sizeof(uint32_t),
+                              imagem->quantidade, imagem->raiz))
+        return false;
+    if (imagem->quantidade == 0)
+        return true;
+
+    struct NoAVL** nos = (struct NoAVL**)malloc(imagem->quantidade * sizeof(struct NoAVL*));
+    if (!nos) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (uint32_t i = 0; i < imagem->quantidade; i++) {
+        const struct NoImagemAVL* registro = &imagem->nos[i];
+        struct NoAVL* novoNo = (struct NoAVL*)malloc(sizeof(struct NoAVL));
+        if (!novoNo) {
+            fprintf(stderr, "Erro na alocação de memória.\n");
+            exit(EXIT_FAILURE);
+        }
+        novoNo->numero = registro->numero;
+        novoNo->altura = registro->altura;
+        novoNo->esquerda = registro->esquerda == SEM_LIGACAO ? NULL : nos[registro->esquerda];
+        novoNo->direita = registro->direita == SEM_LIGACAO ? NULL : nos[registro->direita];
+        nos[i] = novoNo;
+    }
+    *raiz = nos[imagem->raiz];
+    free(nos);
+    return true;
+}
+
+/**
+ * Fecha uma imagem da Árvore AVL (desfaz o mapeamento)
+ */
+void fecharImagemAVL(struct ImagemAVL* imagem) {
+    desmapearImagem(&imagem->mapa);
+}
+#endif
+
 /**
  * Função principal para testar a Árvore AVL
  */
@@ -136,5 +365,8 @@ int main() {
 
     printf("Árvore AVL criada com sucesso.\n");
 
+    raiz = removerAVL(raiz, 30);
+    printf("Após remover 30: raiz %d, 30 %s\n", raiz->numero, buscarAVL(raiz, 30) ? "encontrado" : "ausente");
+
     return 0;
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
  * 
  * Este código implementa uma árvore binária básica com as seguintes funcionalidades:
  * - Inserir nós na árvore
+ * - Buscar e remover números
  * - Navegar em ordem (in-order traversal)
  * - Imprimir os nós da árvore
  * 
@@ -47,6 +48,48 @@ struct No* inserirArvore(struct No* raiz, int numero) {
     return raiz;
 }
 
+/**
+ * Busca um número na árvore binária
+ * @param raiz Ponteiro para a raiz da árvore
+ * @param numero Valor procurado
+ * @return Ponteiro para o nó com o número ou NULL
+ */
+struct No* buscarArvore(struct No* raiz, int numero) {
+    while (raiz && raiz->numero != numero)
+        raiz = numero < raiz->numero ? raiz->esquerda : raiz->direita;
+    return raiz;
+}
+
+/**
+ * Remove uma ocorrência de um número da árvore binária
+ * @param raiz Ponteiro para a raiz da árvore
+ * @param numero Valor a ser removido
+ * @return Ponteiro atualizado da raiz
+ */
+struct No* removerArvore(struct No* raiz, int numero) {
+    // Procura o nó guardando o ponteiro que aponta para ele
+    struct No** ligacao = &raiz;
+    while (*ligacao && (*ligacao)->numero != numero)
+        ligacao = numero < (*ligacao)->numero ? &(*ligacao)->esquerda : &(*ligacao)->direita;
+    struct No* alvo = *ligacao;
+    if (!alvo) return raiz;
+
+    // Dois filhos: o sucessor (menor da direita) toma o lugar do valor
+    if (alvo->esquerda && alvo->direita) {
+        struct No** sucessor = &alvo->direita;
+        while ((*sucessor)->esquerda)
+            sucessor = &(*sucessor)->esquerda;
+        alvo->numero = (*sucessor)->numero;
+        ligacao = sucessor;
+        alvo = *sucessor;
+    }
+
+    // Zero ou um filho: o filho ocupa o lugar do nó
+    *ligacao = alvo->esquerda ? alvo->esquerda : alvo->direita;
+    free(alvo);
+    return raiz;
+}
+
 /**
  * Navegação em ordem (in-order traversal)
  * @param raiz Ponteiro para a raiz da árvore
@@ -75,5 +118,11 @@ int main() {
     navegarInOrdem(raiz);
     printf("\n");
 
+    // Removendo um nó com dois filhos
+    raiz = removerArvore(raiz, 30);
+    printf("Após remover 30: ");
+    navegarInOrdem(raiz);
+    printf("(40 %s)\n", buscarArvore(raiz, 40) ? "encontrado" : "ausente");
+
     return 0;
 }
\ No newline at end of file
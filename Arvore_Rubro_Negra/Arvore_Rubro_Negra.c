@@ -6,8 +6,18 @@
  * - A raiz é sempre preta.
  * - Nós vermelhos não podem ter filhos vermelhos.
  * - Cada caminho da raiz até uma folha nula contém o mesmo número de nós pretos.
+ *
+ * Operações:
+ * - Inserir um número (descida iterativa e recoloração/rotações na subida)
+ * - Buscar um número
+ * - Gravar a árvore em uma imagem binária e consultá-la direto do arquivo
+ *   mapeado, ou restaurá-la sem refazer as inserções (opcional, compilado com
+ *   -DIMAGEM_BINARIA; ver Imagem_Binaria.h)
  */
 
+#if defined(IMAGEM_BINARIA) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE          // madvise e MADV_* com -std=c11 (ver Imagem_Binaria.h)
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -36,10 +46,292 @@ struct NoRN* criarNoRN(int numero) {
     return novoNo;
 }
 
+/**
+ * Realiza uma rotação à esquerda em torno de x
+ * @param raiz Ponteiro para a raiz da árvore
+ * @param x Nó que desce para a esquerda
+ * @return Raiz da árvore (muda se x era a raiz)
+ */
+struct NoRN* rotacaoEsquerdaRN(struct NoRN* raiz, struct NoRN* x) {
+    struct NoRN* y = x->direita;
+    x->direita = y->esquerda;
+    if (y->esquerda) y->esquerda->pai = x;
+    y->pai = x->pai;
+    if (!x->pai) raiz = y;
+    else if (x == x->pai->esquerda) x->pai->esquerda = y;
+    else x->pai->direita = y;
+    y->esquerda = x;
+    x->pai = y;
+    return raiz;
+}
+
+/**
+ * Realiza uma rotação à direita em torno de y
+ * @param raiz Ponteiro para a raiz da árvore
+ * @param y Nó que desce para a direita
+ * @return Raiz da árvore (muda se y era a raiz)
+ */
+struct NoRN* rotacaoDireitaRN(struct NoRN* raiz, struct NoRN* y) {
+    struct NoRN* x = y->esquerda;
+    y->esquerda = x->direita;
+    if (x->direita) x->direita->pai = y;
+    x->pai = y->pai;
+    if (!y->pai) raiz = x;
+    else if (y == y->pai->direita) y->pai->direita = x;
+    else y->pai->esquerda = x;
+    x->direita = y;
+    y->pai = x;
+    return raiz;
+}
+
+/**
+ * Insere um número na Árvore Rubro-Negra (números repetidos são ignorados)
+ * @param raiz Ponteiro para a raiz da árvore
+ * @param numero Valor a ser inserido
+ * @return Nova raiz da árvore
+ */
+struct NoRN* inserirRN(struct NoRN* raiz, int numero) {
+    // Descida como em uma árvore binária de busca comum
+    struct NoRN* pai = NULL;
+    struct NoRN* atual = raiz;
+    while (atual) {
+        if (numero == atual->numero) return raiz;
+        pai = atual;
+        atual = numero < atual->numero ? atual->esquerda : atual->direita;
+    }
+
+    struct NoRN* no = criarNoRN(numero);
+    no->pai = pai;
+    if (!pai) raiz = no;
+    else if (numero < pai->numero) pai->esquerda = no;
+    else pai->direita = no;
+
+    // Corrige vermelho com pai vermelho, subindo pela árvore
+    while (no->pai && no->pai->cor == VERMELHO) {
+        struct NoRN* avo = no->pai->pai;
+        if (no->pai == avo->esquerda) {
+            struct NoRN* tio = avo->direita;
+            if (tio && tio->cor == VERMELHO) {
+                // Tio vermelho: recolore e continua a partir do avô
+                no->pai->cor = PRETO;
+                tio->cor = PRETO;
+                avo->cor = VERMELHO;
+                no = avo;
+            } else {
+                // Tio preto: uma ou duas rotações resolvem
+                if (no == no->pai->direita) {
+                    no = no->pai;
+                    raiz = rotacaoEsquerdaRN(raiz, no);
+                }
+                no->pai->cor = PRETO;
+                avo->cor = VERMELHO;
+                raiz = rotacaoDireitaRN(raiz, avo);
+            }
+        } else {
+            struct NoRN* tio = avo->esquerda;
+            if (tio && tio->cor == VERMELHO) {
+                no->pai->cor = PRETO;
+                tio->cor = PRETO;
+                avo->cor = VERMELHO;
+                no = avo;
+            } else {
+                if (no == no->pai->esquerda) {
+                    no = no->pai;
+                    raiz = rotacaoDireitaRN(raiz, no);
+                }
+                no->pai->cor = PRETO;
+                avo->cor = VERMELHO;
+                raiz = rotacaoEsquerdaRN(raiz, avo);
+            }
+        }
+    }
+    raiz->cor = PRETO;
+    return raiz;
+}
+
+/**
+ * Busca um número na Árvore Rubro-Negra
+ * @param raiz Ponteiro para a raiz da árvore
+ * @param numero Valor procurado
+ * @return Ponteiro para o nó com o número ou NULL
+ */
+struct NoRN* buscarRN(struct NoRN* raiz, int numero) {
+    while (raiz && raiz->numero != numero)
+        raiz = numero < raiz->numero ? raiz->esquerda : raiz->direita;
+    return raiz;
+}
+
+/**
+ * Imprime a árvore em ordem, com a cor de cada nó (V ou P)
+ * @param raiz Ponteiro para a raiz da árvore
+ */
+void imprimirRN(struct NoRN* raiz) {
+    if (!raiz) return;
+    imprimirRN(raiz->esquerda);
+    printf("%d%c ", raiz->numero, raiz->cor == VERMELHO ? 'V' : 'P');
+    imprimirRN(raiz->direita);
+}
+
+/**
+ * Libera todos os nós da Árvore Rubro-Negra
+ * @param raiz Ponteiro para a raiz da árvore
+ */
+void liberarRN(struct NoRN* raiz) {
+    if (!raiz) return;
+    liberarRN(raiz->esquerda);
+    liberarRN(raiz->direita);
+    free(raiz);
+}
+
+#ifdef IMAGEM_BINARIA
+// Imagem binária (só POSIX: mmap). Compile com -DIMAGEM_BINARIA, ver Imagem_Binaria.h
+#include "../Imagem_Binaria/Imagem_Binaria.h"
+
+// Nó da imagem binária: filhos como índices de registro, em pós-ordem (o
+// pai não é gravado; a restauração o refaz)
+struct NoImagemRN {
+    int32_t numero;
+    int32_t cor;
+    uint32_t esquerda;
+    uint32_t direita;
+};
+
+// Árvore rubro-negra aberta de uma imagem, consultada sem reconstrução
+struct ImagemRN {
+    const struct NoImagemRN* nos;
+    uint32_t quantidade;
+    uint32_t raiz;              // SEM_LIGACAO se a árvore está vazia
+    struct imagemMapeada mapa;
+};
+
+/**
+ * Grava uma subárvore em pós-ordem (filhos antes do pai)
+ * @param g Gravação em andamento
+ * @param raiz Raiz da subárvore
+ * @param proximo Índice do próximo registro (avança a cada nó gravado)
+ * @return Índice do registro da raiz da subárvore, ou SEM_LIGACAO se vazia
+ */
+uint32_t gravarSubarvoreRN(struct gravacaoImagem* g, struct NoRN* raiz, uint32_t* proximo) {
+    if (!raiz) return SEM_LIGACAO;
+    struct NoImagemRN registro;
+    registro.esquerda = gravarSubarvoreRN(g, raiz->esquerda, proximo);
+    registro.direita = gravarSubarvoreRN(g, raiz->direita, proximo);
+    registro.numero = raiz->numero;
+    registro.cor = raiz->cor;
+    gravarRegistro(g, &registro, sizeof(registro));
+    return (*proximo)++;
+}
+
+/**
+ * Grava a Árvore Rubro-Negra em uma imagem binária, em uma passada sequencial
+ * @param raiz Ponteiro para a raiz da árvore
+ * @param caminho Arquivo da imagem
+ * @return true se gravou
+ */
+bool salvarRN(struct NoRN* raiz, const char* caminho) {
+    struct gravacaoImagem g;
+    if (!iniciarGravacaoImagem(&g, caminho)) return false;
+    uint32_t quantidade = 0;
+    struct cabecalhoImagem c;
+    memset(&c, 0, sizeof(c));
+    memcpy(c.magica, "RNIMAGEM", 8);
+    c.tamanhoRegistro = sizeof(struct NoImagemRN);
+    c.raiz = gravarSubarvoreRN(&g, raiz, &quantidade);
+    c.registros = quantidade;
+    return concluirGravacaoImagem(&g, &c);
+}
+
+/**
+ * Abre uma imagem da Árvore Rubro-Negra, mapeando-a na memória
+ * @param caminho Arquivo da imagem
+ * @param imagem Recebe a árvore mapeada
+ * @return false se o arquivo não existe ou não é uma imagem rubro-negra válida
+ */
+bool abrirImagemRN(const char* caminho, struct ImagemRN* imagem) {
+    if (!mapearImagem(caminho, "RNIMAGEM", sizeof(struct NoImagemRN), 0, &imagem->mapa)) return false;
+    imagem->nos = (const struct NoImagemRN*) imagem->mapa.registros;
+    imagem->quantidade = (uint32_t) imagem->mapa.cabecalho->registros;
+    imagem->raiz = imagem->mapa.cabecalho->raiz;
+    return true;
+}
+
+/**
+ * Busca um número direto na imagem mapeada
+ * Como em buscarImagemAVL, o índice precisa diminuir a cada descida: isso
+ * encerra a busca na falta de filho e em imagens corrompidas.
+ * @param imagem Árvore aberta com abrirImagemRN
+ * @param numero Valor procurado
+ * @return Ponteiro para o registro com o número ou NULL
+ */
+const struct NoImagemRN* buscarImagemRN(const struct ImagemRN* imagem, int numero) {
+    uint32_t i = imagem->raiz;
+    if (i == SEM_LIGACAO) return NULL;
+    for (;;) {
+        const struct NoImagemRN* no = &imagem->nos[i];
+        if (no->numero == numero) return no;
+        uint32_t filho = numero < no->numero ? no->esquerda : no->direita;
+        if (filho >= i) return NULL;
+        i = filho;
+    }
+}
+
+/**
+ * Reconstrói a Árvore Rubro-Negra em memória a partir da imagem
+ * Cores e ligações são copiadas dos registros e o pai de cada nó é
+ * preenchido quando o pai é criado (ele vem depois dos filhos): O(n), sem
+ * comparações nem rotações.
+ * @param imagem Árvore aberta com abrirImagemRN
+ * @param raiz Recebe a raiz da árvore reconstruída (NULL se vazia)
+ * @return false se as ligações da imagem não formam uma árvore (nada é alocado)
+ */
+bool restaurarRN(const struct ImagemRN* imagem, struct NoRN** raiz) {
+    *raiz = NULL;
+    if (!conferirArvoreImagem(&imagem->nos[0].esquerda, sizeof(struct NoImagemRN) / sizeof(uint32_t),
+                              imagem->quantidade, imagem->raiz))
+        return false;
+    if (imagem->quantidade == 0) return true;
+
+    struct NoRN** nos = (struct NoRN**)malloc(imagem->quantidade * sizeof(struct NoRN*));
+    if (!nos) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (uint32_t i = 0; i < imagem->quantidade; i++) {
+        const struct NoImagemRN* registro = &imagem->nos[i];
+        struct NoRN* novoNo = criarNoRN(registro->numero);
+        novoNo->cor = registro->cor;
+        novoNo->esquerda = registro->esquerda == SEM_LIGACAO ? NULL : nos[registro->esquerda];
+        novoNo->direita = registro->direita == SEM_LIGACAO ? NULL : nos[registro->direita];
+        if (novoNo->esquerda) novoNo->esquerda->pai = novoNo;
+        if (novoNo->direita) novoNo->direita->pai = novoNo;
+        nos[i] = novoNo;
+    }
+    *raiz = nos[imagem->raiz];
+    free(nos);
+    return true;
+}
+
+/**
+ * Fecha uma imagem da Árvore Rubro-Negra (desfaz o mapeamento)
+ */
+void fecharImagemRN(struct ImagemRN* imagem) {
+    desmapearImagem(&imagem->mapa);
+}
+#endif
+
 /**
  * Função principal para testar a Árvore Rubro-Negra
  */
 int main() {
-    printf("Implementação simplificada da Árvore Rubro-Negra.\n");
+    struct NoRN* raiz = NULL;
+
+    // Inserção em ordem crescente: pior caso de uma árvore sem balanceamento
+    for (int i = 1; i <= 10; i++) {
+        raiz = inserirRN(raiz, i * 10);
+    }
+
+    printf("Árvore Rubro-Negra em ordem: ");
+    imprimirRN(raiz);
+    printf("\nRaiz: %d, 70 %s\n", raiz->numero, buscarRN(raiz, 70) ? "encontrado" : "ausente");
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,901 @@
+/**
+ * Benchmark Unificado das Estruturas em C
+ *
+ * O main de cada arquivo do repositório é uma demonstração fixa (inserir de
+ * 10 a 50 na AVL, de 0 a 99 na matriz esparsa...). Este programa inclui o
+ * código das estruturas básicas, com os nomes trocados para que convivam no
+ * mesmo executável, e as submete a cargas parametrizadas:
+ * - Estruturas: avl, binaria, rubro_negra, pilha, fila, deque, lista
+ *   (duplamente encadeada), lista_circular, matriz (esparsa) e grafo
+ *   (matriz de adjacência; a chave escolhe a aresta)
+ * - Cargas: uniforme, ordenada, zipf (chaves populares repetidas, expoente
+ *   ajustável) e mista (50% inserções e 50% remoções sobre n chaves já
+ *   carregadas)
+ * - Fases de cada rodada: inserir n chaves, buscar n chaves (metade
+ *   presentes, sorteadas entre as inseridas; metade ausentes, de uma faixa
+ *   que nenhuma carga insere) e remover as n chaves na ordem de inserção.
+ *   Na carga mista, uma fase só
+ * - Por fase: vazão, latência por operação (percentis via histograma HDR),
+ *   pico de memória residente e contadores de hardware (ciclos, instruções,
+ *   faltas de cache, erros de previsão de desvio) via perf_event_open,
+ *   quando o kernel permite
+ * - Saída em JSON (um objeto por linha) ou CSV, para comparar execuções
+ *
+ * Cada rodada (estrutura, carga, n) roda em um processo filho: o pico de
+ * memória, os contadores e o estado dos alocadores não vazam de uma rodada
+ * para a outra, e uma estrutura que estoure a pilha não derruba as demais.
+ * Pilha, fila e deque não têm busca, e a remoção delas ignora a chave (tira
+ * o próximo da vez); a rubro-negra não tem remoção e a lista circular não
+ * tem busca, e a fase correspondente é omitida. Estruturas em que
+ * cada operação percorre a estrutura inteira (O(n)) são puladas acima de um
+ * limite, a menos que se passe -t.
+ *
+ * Pilha, fila e deque devolvem o item removido/atendido em vez de imprimi-lo
+ * (quem imprime é o main de cada uma), então a formatação não entra no tempo
+ * medido. O resto do que as estruturas imprimem vai para /dev/null.
+ * As duas leituras do relógio em torno de cada operação entram no tempo.
+ *
+ *   gcc -O2 -pthread Benchmark.c -o benchmark -lm
+ *   ./benchmark [-e avl,lista,...] [-c uniforme,zipf,...] [-n 1e3,1e5,...]
+ *               [-f json|csv] [-o arquivo] [-s semente] [-z expoente] [-t]
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <linux/perf_event.h>
+#include "../Histograma_HDR/Histograma_HDR.h"
+
+// Arvore_AVL.c
+#define main mainAVL
+#include "../Arvore_AVL/Arvore_AVL.c"
+#undef main
+
+// Arvore_Binaria.c
+#define main mainBinaria
+#include "../Arvore_Binaria/Arvore_Binaria.c"
+#undef main
+
+// Arvore_Rubro_Negra.c
+#define main mainRubroNegra
+#include "../Arvore_Rubro_Negra/Arvore_Rubro_Negra.c"
+#undef main
+
+// Pilha.c
+#define main mainPilha
+#define no noPilha
+#define imprimir imprimirPilha
+#include "../Pilha/Pilha.c"
+#undef main
+#undef no
+#undef imprimir
+
+// Fila.c
+#define main mainFila
+#define no noFila
+#define entrar entrarFila
+#define sair sairFila
+#define imprimir imprimirFila
+#define menu menuFila
+#include "../Fila/Fila.c"
+#undef main
+#undef no
+#undef entrar
+#undef sair
+#undef imprimir
+#undef menu
+
+// Deque_Fila_Prioritaria.c
+#define main mainDeque
+#define no noDeque
+#define entrar entrarDeque
+#define sair sairDeque
+#define imprimir imprimirDeque
+#include "../Deque/Deque_Fila_Prioritaria.c"
+#undef main
+#undef no
+#undef entrar
+#undef sair
+#undef imprimir
+
+// Lista_Duplamente_Encadeada.c
+#define main mainLista
+#define no noLista
+#define inserir inserirLista
+#define remover removerLista
+#define buscar buscarLista
+#define imprimir imprimirLista
+#define menu menuLista
+#include "../Lista_Encadeada/Lista_Duplamente_Encadeada.c"
+#undef main
+#undef no
+#undef inserir
+#undef remover
+#undef buscar
+#undef imprimir
+#undef menu
+
+// Lista_Circular.c
+#define main mainCircular
+#define no noCircular
+#define inserir inserirCircular
+#define remover removerCircular
+#define imprimir imprimirCircular
+#define menu menuCircular
+#include "../Lista_Circular/Lista_Circular.c"
+#undef main
+#undef no
+#undef inserir
+#undef remover
+#undef imprimir
+#undef menu
+
+// Matriz_Esparsa.c
+#define main mainMatriz
+#define no noMatriz
+#define inserir inserirMatriz
+#define remover removerMatriz
+#define buscar buscarMatriz
+#define imprimir imprimirMatriz
+#include "../Matriz_Esparsa/Matriz_Esparsa.c"
+#undef main
+#undef no
+#undef inserir
+#undef remover
+#undef buscar
+#undef imprimir
+
+// Grafos.c, com uma matriz de adjacência de 2048 vértices (16 MB)
+#define TAMANHO 2048
+#define main mainGrafo
+#include "../Grafos/Grafos.c"
+#undef main
+
+#define SEM_LIMITE ((size_t) -1)
+#define LIMITE_LINEAR 20000         // Maior n para estruturas com operações O(n)
+#define LIMITE_MATRIZ 50000         // A matriz divide as chaves em MODULO cadeias
+#define MAX_TAMANHOS 16
+
+#define CONTADORES_HW 4
+
+// Cargas de trabalho
+enum carga {
+    CARGA_UNIFORME,
+    CARGA_ORDENADA,
+    CARGA_ZIPF,
+    CARGA_MISTA,
+    QUANTIDADE_CARGAS
+};
+
+static const char *nomesCargas[QUANTIDADE_CARGAS] = {"uniforme", "ordenada", "zipf", "mista"};
+
+// Fases de uma rodada
+enum fase {
+    FASE_INSERIR,
+    FASE_BUSCAR,
+    FASE_REMOVER,
+    FASE_MISTA
+};
+
+static const char *nomesFases[] = {"inserir", "buscar", "remover", "mista"};
+
+// Contadores de hardware lidos em cada fase
+static const struct {
+    const char *nome;
+    uint64_t configuracao;
+} contadoresHW[CONTADORES_HW] = {
+    {"ciclos", PERF_COUNT_HW_CPU_CYCLES},
+    {"instrucoes", PERF_COUNT_HW_INSTRUCTIONS},
+    {"faltas_cache", PERF_COUNT_HW_CACHE_MISSES},
+    {"erros_desvio", PERF_COUNT_HW_BRANCH_MISSES},
+};
+
+// Operações de uma estrutura no formato comum do benchmark
+struct estruturaBench {
+    const char *nome;
+    void *(*criar)(void);
+    void *(*inserir)(void *estrutura, int chave);
+    bool (*buscar)(void *estrutura, int chave);       // NULL: sem busca
+    void *(*remover)(void *estrutura, int chave);     // NULL: sem remoção
+    size_t limite;              // Maior n sem -t
+    size_t limiteDesfavoravel;  // Maior n nas cargas ordenada e zipf
+};
+
+// Grupo de contadores de hardware (perf_event)
+struct contadores {
+    int lider;                          // Descritor do grupo ou -1
+    int descritores[CONTADORES_HW];
+    int posicao[CONTADORES_HW];         // Posição na leitura do grupo ou -1
+    int quantidade;
+};
+
+// Resultado de uma fase
+struct resultadoFase {
+    int fase;
+    size_t operacoes;
+    long acertos;               // Só na busca; -1 nas demais
+    double segundos;
+    long picoKB;
+    bool contadorValido[CONTADORES_HW];
+    uint64_t contador[CONTADORES_HW];
+};
+
+// Opções da linha de comando
+struct opcoes {
+    bool estruturas[16];
+    bool cargas[QUANTIDADE_CARGAS];
+    size_t tamanhos[MAX_TAMANHOS];
+    int quantidadeTamanhos;
+    bool csv;
+    bool ignorarLimites;
+    uint64_t semente;
+    double expoenteZipf;
+};
+
+// Gerador Zipf (Gray et al., o mesmo do YCSB): O(n) para iniciar, O(1) por sorteio
+struct zipf {
+    uint64_t n;
+    double expoente;
+    double zetaN;
+    double alfa;
+    double eta;
+    double limiteUm;            // 1 + 0.5^expoente
+};
+
+/* ---------- Adaptadores das estruturas ---------- */
+
+static void *criarVazia(void) {
+    return NULL;
+}
+
+static void *inserirBenchAVL(void *e, int chave) { return inserirAVL((struct NoAVL *) e, chave); }
+static bool buscarBenchAVL(void *e, int chave) { return buscarAVL((struct NoAVL *) e, chave) != NULL; }
+static void *removerBenchAVL(void *e, int chave) { return removerAVL((struct NoAVL *) e, chave); }
+
+static void *inserirBenchBinaria(void *e, int chave) { return inserirArvore((struct No *) e, chave); }
+static bool buscarBenchBinaria(void *e, int chave) { return buscarArvore((struct No *) e, chave) != NULL; }
+static void *removerBenchBinaria(void *e, int chave) { return removerArvore((struct No *) e, chave); }
+
+static void *inserirBenchRN(void *e, int chave) { return inserirRN((struct NoRN *) e, chave); }
+static bool buscarBenchRN(void *e, int chave) { return buscarRN((struct NoRN *) e, chave) != NULL; }
+
+static void *inserirBenchPilha(void *e, int chave) { return push((struct noPilha *) e, chave); }
+static void *removerBenchPilha(void *e, int chave) { (void) chave; return pop((struct noPilha *) e, NULL); }
+
+static void *inserirBenchFila(void *e, int chave) { return entrarFila((struct noFila *) e, chave); }
+static void *removerBenchFila(void *e, int chave) { (void) chave; return sairFila((struct noFila *) e, NULL); }
+
+// O deque guarda também o contador de atendimentos preferenciais
+struct dequeBench {
+    struct deque deque;
+    int contador;
+};
+
+static void *criarBenchDeque(void) {
+    struct dequeBench *d = (struct dequeBench *) calloc(1, sizeof(struct dequeBench));
+    if (d == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    return d;
+}
+
+// Chaves pares vão para a fila normal, ímpares para a preferencial
+static void *inserirBenchDeque(void *e, int chave) {
+    struct dequeBench *d = (struct dequeBench *) e;
+    entrarDeque(&d->deque, (chave & 1) == 0, chave);
+    return d;
+}
+
+static void *removerBenchDeque(void *e, int chave) {
+    struct dequeBench *d = (struct dequeBench *) e;
+    (void) chave;
+    atender(&d->deque, &d->contador, NULL);
+    return d;
+}
+
+static void *inserirBenchLista(void *e, int chave) { return inserirLista((struct noLista *) e, chave); }
+static bool buscarBenchLista(void *e, int chave) { return buscarLista((struct noLista *) e, chave) != NULL; }
+static void *removerBenchLista(void *e, int chave) { return removerLista((struct noLista *) e, chave); }
+
+static void *inserirBenchCircular(void *e, int chave) { return inserirCircular((struct noCircular *) e, chave); }
+static void *removerBenchCircular(void *e, int chave) { return removerCircular((struct noCircular *) e, chave); }
+
+static void *inserirBenchMatriz(void *e, int chave) { return inserirMatriz((struct diretor *) e, chave); }
+static bool buscarBenchMatriz(void *e, int chave) { return buscarMatriz((struct diretor *) e, chave) != NULL; }
+static void *removerBenchMatriz(void *e, int chave) {
+    removerMatriz((struct diretor *) e, chave);
+    return e;
+}
+
+// Grafo: a chave escolhe a aresta (origem, destino) da matriz de adjacência
+static int grafoBench[TAMANHO][TAMANHO];
+
+static void *criarBenchGrafo(void) {
+    memset(grafoBench, 0, sizeof(grafoBench));
+    return grafoBench;
+}
+
+static void *inserirBenchGrafo(void *e, int chave) {
+    unsigned c = (unsigned) chave;
+    grafoBench[c / TAMANHO % TAMANHO][c % TAMANHO] = 1;
+    return e;
+}
+
+static bool buscarBenchGrafo(void *e, int chave) {
+    unsigned c = (unsigned) chave;
+    (void) e;
+    return grafoBench[c / TAMANHO % TAMANHO][c % TAMANHO] != 0;
+}
+
+static void *removerBenchGrafo(void *e, int chave) {
+    unsigned c = (unsigned) chave;
+    grafoBench[c / TAMANHO % TAMANHO][c % TAMANHO] = 0;
+    return e;
+}
+
+static const struct estruturaBench estruturas[] = {
+    {"avl", criarVazia, inserirBenchAVL, buscarBenchAVL, removerBenchAVL, SEM_LIMITE, SEM_LIMITE},
+    {"binaria", criarVazia, inserirBenchBinaria, buscarBenchBinaria, removerBenchBinaria, SEM_LIMITE, LIMITE_LINEAR},
+    {"rubro_negra", criarVazia, inserirBenchRN, buscarBenchRN, NULL, SEM_LIMITE, SEM_LIMITE},
+    {"pilha", criarVazia, inserirBenchPilha, NULL, removerBenchPilha, SEM_LIMITE, SEM_LIMITE},
+    {"fila", criarVazia, inserirBenchFila, NULL, removerBenchFila, LIMITE_LINEAR, LIMITE_LINEAR},
+    {"deque", criarBenchDeque, inserirBenchDeque, NULL, removerBenchDeque, LIMITE_LINEAR, LIMITE_LINEAR},
+    {"lista", criarVazia, inserirBenchLista, buscarBenchLista, removerBenchLista, LIMITE_LINEAR, LIMITE_LINEAR},
+    {"lista_circular", criarVazia, inserirBenchCircular, NULL, removerBenchCircular, LIMITE_LINEAR, LIMITE_LINEAR},
+    {"matriz", criarVazia, inserirBenchMatriz, buscarBenchMatriz, removerBenchMatriz, LIMITE_MATRIZ, LIMITE_MATRIZ},
+    {"grafo", criarBenchGrafo, inserirBenchGrafo, buscarBenchGrafo, removerBenchGrafo, SEM_LIMITE, SEM_LIMITE},
+};
+
+#define QUANTIDADE_ESTRUTURAS ((int) (sizeof(estruturas) / sizeof(estruturas[0])))
+
+/* ---------- Medição ---------- */
+
+/**
+ * Lê o relógio monotônico
+ * @return Instante atual em nanossegundos
+ */
+static inline uint64_t agoraNs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t) t.tv_sec * 1000000000u + (uint64_t) t.tv_nsec;
+}
+
+/**
+ * Retorna o pico de memória residente do processo
+ * @return Pico em kilobytes
+ */
+static long picoMemoriaKB(void) {
+    struct rusage uso;
+    getrusage(RUSAGE_SELF, &uso);
+    return uso.ru_maxrss;
+}
+
+/**
+ * Abre os contadores de hardware como um grupo (o primeiro que abrir lidera)
+ * Em contêineres e máquinas virtuais é comum o kernel negar o acesso; nesse
+ * caso os campos saem nulos.
+ * @param c Ponteiro para o grupo
+ */
+static void abrirContadores(struct contadores *c) {
+    c->lider = -1;
+    c->quantidade = 0;
+    for (int i = 0; i < CONTADORES_HW; i++) {
+        struct perf_event_attr atributos;
+        memset(&atributos, 0, sizeof(atributos));
+        atributos.type = PERF_TYPE_HARDWARE;
+        atributos.size = sizeof(atributos);
+        atributos.config = contadoresHW[i].configuracao;
+        atributos.disabled = c->lider < 0;
+        atributos.exclude_kernel = 1;
+        atributos.exclude_hv = 1;
+        atributos.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        c->descritores[i] = (int) syscall(SYS_perf_event_open, &atributos, 0, -1, c->lider, 0);
+        c->posicao[i] = -1;
+        if (c->descritores[i] >= 0) {
+            if (c->lider < 0) {
+                c->lider = c->descritores[i];
+            }
+            c->posicao[i] = c->quantidade++;
+        }
+    }
+}
+
+/**
+ * Zera e liga o grupo de contadores
+ */
+static void iniciarContadores(const struct contadores *c) {
+    if (c->lider >= 0) {
+        ioctl(c->lider, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(c->lider, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+/**
+ * Desliga o grupo e copia os valores para o resultado da fase
+ * Se o kernel multiplexou os contadores, os valores são extrapolados pelo
+ * tempo em que estiveram ativos.
+ */
+static void pararContadores(const struct contadores *c, struct resultadoFase *r) {
+    uint64_t leitura[3 + CONTADORES_HW];
+    memset(r->contadorValido, 0, sizeof(r->contadorValido));
+    if (c->lider < 0) {
+        return;
+    }
+    ioctl(c->lider, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    if (read(c->lider, leitura, sizeof(leitura)) < (ssize_t) (3 * sizeof(uint64_t)) || leitura[2] == 0) {
+        return;
+    }
+    double escala = (double) leitura[1] / (double) leitura[2];
+    for (int i = 0; i < CONTADORES_HW; i++) {
+        if (c->posicao[i] >= 0 && (uint64_t) c->posicao[i] < leitura[0]) {
+            r->contadorValido[i] = true;
+            r->contador[i] = (uint64_t) ((double) leitura[3 + c->posicao[i]] * escala);
+        }
+    }
+}
+
+/* ---------- Geração das cargas ---------- */
+
+/**
+ * Avança o gerador xorshift64
+ * @param estado Estado do gerador (não pode ser zero)
+ * @return Próximo número pseudoaleatório
+ */
+static inline uint64_t proximoAleatorio(uint64_t *estado) {
+    uint64_t x = *estado;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *estado = x;
+    return x;
+}
+
+/**
+ * Mistura de 64 bits (finalizador do MurmurHash3), usada para espalhar as
+ * posições do Zipf pelo espaço de chaves
+ */
+static inline uint64_t misturar(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * Chave aleatória de 30 bits: as chaves inseridas ficam abaixo de 2^30
+ */
+static inline int chaveAleatoria(uint64_t *estado) {
+    return (int) (proximoAleatorio(estado) >> 34);
+}
+
+/**
+ * Chave aleatória entre 2^30 e 2^31 - 1, que nenhuma carga insere
+ */
+static inline int chaveAusente(uint64_t *estado) {
+    return (int) (proximoAleatorio(estado) >> 34 | UINT64_C(1) << 30);
+}
+
+/**
+ * Prepara o gerador Zipf para n posições
+ * @param z Ponteiro para o gerador
+ * @param n Quantidade de posições distintas
+ * @param expoente Expoente da distribuição (0 < expoente < 1)
+ */
+static void iniciarZipf(struct zipf *z, uint64_t n, double expoente) {
+    z->n = n;
+    z->expoente = expoente;
+    z->zetaN = 0.0;
+    for (uint64_t i = 1; i <= n; i++) {
+        z->zetaN += 1.0 / pow((double) i, expoente);
+    }
+    double zeta2 = 1.0 + pow(0.5, expoente);
+    z->alfa = 1.0 / (1.0 - expoente);
+    z->eta = (1.0 - pow(2.0 / (double) n, 1.0 - expoente)) / (1.0 - zeta2 / z->zetaN);
+    z->limiteUm = zeta2;
+}
+
+/**
+ * Sorteia uma posição: 0 é a mais popular
+ */
+static inline uint64_t proximoZipf(const struct zipf *z, uint64_t *estado) {
+    double u = (double) (proximoAleatorio(estado) >> 11) * 0x1.0p-53;
+    double uz = u * z->zetaN;
+    if (uz < 1.0) return 0;
+    if (uz < z->limiteUm) return 1;
+    uint64_t posicao = (uint64_t) ((double) z->n * pow(z->eta * u - z->eta + 1.0, z->alfa));
+    return posicao < z->n ? posicao : z->n - 1;
+}
+
+/**
+ * Gera as n chaves inseridas por uma carga
+ * @param carga Carga de trabalho (a mista usa chaves uniformes)
+ * @param chaves Vetor de destino com n posições
+ * @param n Quantidade de chaves
+ * @param o Opções (semente e expoente do Zipf)
+ */
+static void gerarChaves(int carga, int *chaves, size_t n, const struct opcoes *o) {
+    uint64_t estado = o->semente;
+    if (carga == CARGA_ORDENADA) {
+        for (size_t i = 0; i < n; i++) {
+            chaves[i] = (int) i;
+        }
+    } else if (carga == CARGA_ZIPF) {
+        struct zipf z;
+        iniciarZipf(&z, n, o->expoenteZipf);
+        for (size_t i = 0; i < n; i++) {
+            chaves[i] = (int) (misturar(proximoZipf(&z, &estado)) >> 34);
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            chaves[i] = chaveAleatoria(&estado);
+        }
+    }
+}
+
+/**
+ * Gera as consultas da fase de busca: metade sorteada entre as chaves
+ * inseridas (segue a distribuição da carga), metade ausente, de uma faixa
+ * que não cruza a das inseridas (o grafo, que reduz a chave a uma aresta,
+ * ainda pode achar uma ausente)
+ */
+static void gerarConsultas(int carga, const int *chaves, int *consultas, size_t n, uint64_t semente) {
+    uint64_t estado = semente ^ 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t sorteio = proximoAleatorio(&estado);
+        if (sorteio & 1) {
+            consultas[i] = chaves[(sorteio >> 1) % n];
+        } else if (carga == CARGA_ORDENADA) {
+            consultas[i] = (int) (n + (sorteio >> 1) % n);
+        } else {
+            consultas[i] = chaveAusente(&estado);
+        }
+    }
+}
+
+/**
+ * Gera a sequência da carga mista a partir de n chaves já inseridas:
+ * cada operação insere uma chave nova ou remove uma presente, sorteada
+ * @param chaves As n chaves carregadas antes da fase
+ * @param tipos Recebe true para inserção, false para remoção
+ * @param operandos Recebe a chave de cada operação
+ */
+static void gerarMista(const int *chaves, bool *tipos, int *operandos, size_t n, uint64_t semente) {
+    int *presentes = (int *) malloc(2 * n * sizeof(int));
+    if (presentes == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(presentes, chaves, n * sizeof(int));
+    size_t quantidade = n;
+    uint64_t estado = semente ^ 0xD1B54A32D192ED03ull;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t sorteio = proximoAleatorio(&estado);
+        tipos[i] = (sorteio & 1) || quantidade == 0;
+        if (tipos[i]) {
+            operandos[i] = chaveAleatoria(&estado);
+            presentes[quantidade++] = operandos[i];
+        } else {
+            size_t posicao = (sorteio >> 1) % quantidade;
+            operandos[i] = presentes[posicao];
+            presentes[posicao] = presentes[--quantidade];
+        }
+    }
+    free(presentes);
+}
+
+/* ---------- Saída ---------- */
+
+/**
+ * Imprime o cabeçalho do CSV
+ */
+static void imprimirCabecalhoCSV(FILE *saida) {
+    fprintf(saida, "estrutura,carga,n,fase,operacoes,segundos,ops_por_s,p50_ns,p90_ns,p99_ns,p999_ns,max_ns,"
+                   "acertos,pico_rss_kb");
+    for (int i = 0; i < CONTADORES_HW; i++) {
+        fprintf(saida, ",%s", contadoresHW[i].nome);
+    }
+    fprintf(saida, "\n");
+}
+
+/**
+ * Imprime o resultado de uma fase (uma linha de JSON ou de CSV)
+ */
+static void emitirResultado(FILE *saida, bool csv, const char *estrutura, int carga, size_t n,
+                            const struct resultadoFase *r, const struct histograma *h) {
+    double vazao = r->segundos > 0 ? (double) r->operacoes / r->segundos : 0.0;
+    unsigned long long p50 = percentilHistograma(h, 50.0), p90 = percentilHistograma(h, 90.0);
+    unsigned long long p99 = percentilHistograma(h, 99.0), p999 = percentilHistograma(h, 99.9);
+
+    if (csv) {
+        fprintf(saida, "%s,%s,%zu,%s,%zu,%.6f,%.1f,%llu,%llu,%llu,%llu,%llu,", estrutura, nomesCargas[carga], n,
+                nomesFases[r->fase], r->operacoes, r->segundos, vazao, p50, p90, p99, p999,
+                (unsigned long long) h->maximo);
+        if (r->acertos >= 0) fprintf(saida, "%ld", r->acertos);
+        fprintf(saida, ",%ld", r->picoKB);
+        for (int i = 0; i < CONTADORES_HW; i++) {
+            fprintf(saida, ",");
+            if (r->contadorValido[i]) fprintf(saida, "%llu", (unsigned long long) r->contador[i]);
+        }
+        fprintf(saida, "\n");
+        return;
+    }
+
+    fprintf(saida, "{\"estrutura\":\"%s\",\"carga\":\"%s\",\"n\":%zu,\"fase\":\"%s\",\"operacoes\":%zu,"
+                   "\"segundos\":%.6f,\"ops_por_s\":%.1f,\"latencia_ns\":{\"p50\":%llu,\"p90\":%llu,"
+                   "\"p99\":%llu,\"p999\":%llu,\"max\":%llu},",
+            estrutura, nomesCargas[carga], n, nomesFases[r->fase], r->operacoes, r->segundos, vazao,
+            p50, p90, p99, p999, (unsigned long long) h->maximo);
+    if (r->acertos >= 0) {
+        fprintf(saida, "\"acertos\":%ld,", r->acertos);
+    } else {
+        fprintf(saida, "\"acertos\":null,");
+    }
+    fprintf(saida, "\"pico_rss_kb\":%ld", r->picoKB);
+    for (int i = 0; i < CONTADORES_HW; i++) {
+        if (r->contadorValido[i]) {
+            fprintf(saida, ",\"%s\":%llu", contadoresHW[i].nome, (unsigned long long) r->contador[i]);
+        } else {
+            fprintf(saida, ",\"%s\":null", contadoresHW[i].nome);
+        }
+    }
+    fprintf(saida, "}\n");
+}
+
+/* ---------- Execução ---------- */
+
+// Mede uma operação e registra sua latência
+#define MEDIR(operacao) do { \
+    uint64_t antes = agoraNs(); \
+    operacao; \
+    registrarHistograma(h, agoraNs() - antes); \
+} while (0)
+
+/**
+ * Executa uma rodada completa (todas as fases) de uma estrutura
+ * Roda no processo filho e escreve os resultados em saida.
+ */
+static void executarRodada(const struct estruturaBench *e, int carga, size_t n, const struct opcoes *o,
+                           FILE *saida) {
+    int *chaves = (int *) malloc(n * sizeof(int));
+    int *operandos = (int *) malloc(n * sizeof(int));
+    bool *tipos = (bool *) malloc(n * sizeof(bool));
+    struct histograma *h = (struct histograma *) malloc(sizeof(struct histograma));
+    if (chaves == NULL || operandos == NULL || tipos == NULL || h == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    gerarChaves(carga, chaves, n, o);
+
+    struct contadores contadores;
+    abrirContadores(&contadores);
+    void *estrutura = e->criar();
+    struct resultadoFase r;
+
+    int fases[3];
+    int quantidadeFases = 0;
+    if (carga == CARGA_MISTA) {
+        for (size_t i = 0; i < n; i++) {
+            estrutura = e->inserir(estrutura, chaves[i]);
+        }
+        gerarMista(chaves, tipos, operandos, n, o->semente);
+        fases[quantidadeFases++] = FASE_MISTA;
+    } else {
+        fases[quantidadeFases++] = FASE_INSERIR;
+        if (e->buscar != NULL) fases[quantidadeFases++] = FASE_BUSCAR;
+        if (e->remover != NULL) fases[quantidadeFases++] = FASE_REMOVER;
+    }
+
+    for (int f = 0; f < quantidadeFases; f++) {
+        zerarHistograma(h);
+        r.fase = fases[f];
+        r.operacoes = n;
+        r.acertos = -1;
+        if (r.fase == FASE_BUSCAR) {
+            gerarConsultas(carga, chaves, operandos, n, o->semente);
+            r.acertos = 0;
+        }
+
+        iniciarContadores(&contadores);
+        uint64_t inicio = agoraNs();
+        switch (r.fase) {
+            case FASE_INSERIR:
+                for (size_t i = 0; i < n; i++) {
+                    MEDIR(estrutura = e->inserir(estrutura, chaves[i]));
+                }
+                break;
+            case FASE_BUSCAR:
+                for (size_t i = 0; i < n; i++) {
+                    MEDIR(r.acertos += e->buscar(estrutura, operandos[i]));
+                }
+                break;
+            case FASE_REMOVER:
+                for (size_t i = 0; i < n; i++) {
+                    MEDIR(estrutura = e->remover(estrutura, chaves[i]));
+                }
+                break;
+            case FASE_MISTA:
+                for (size_t i = 0; i < n; i++) {
+                    if (tipos[i]) {
+                        MEDIR(estrutura = e->inserir(estrutura, operandos[i]));
+                    } else {
+                        MEDIR(estrutura = e->remover(estrutura, operandos[i]));
+                    }
+                }
+                break;
+        }
+        r.segundos = (double) (agoraNs() - inicio) / 1e9;
+        pararContadores(&contadores, &r);
+        r.picoKB = picoMemoriaKB();
+        emitirResultado(saida, o->csv, e->nome, carga, n, &r, h);
+    }
+    fflush(saida);
+
+    // O processo termina logo em seguida: as estruturas não precisam ser liberadas
+    free(h);
+    free(tipos);
+    free(operandos);
+    free(chaves);
+}
+
+/**
+ * Procura uma estrutura ou carga pelo nome em uma lista separada por vírgulas
+ * @param lista Texto como "avl,lista"
+ * @param nomes Nomes válidos
+ * @param quantidade Quantidade de nomes
+ * @param marcados Recebe true nas posições escolhidas
+ * @return false se algum nome não existe
+ */
+static bool marcarNomes(const char *lista, const char *const *nomes, int quantidade, bool *marcados) {
+    char copia[256];
+    snprintf(copia, sizeof(copia), "%s", lista);
+    memset(marcados, 0, (size_t) quantidade * sizeof(bool));
+    for (char *nome = strtok(copia, ","); nome != NULL; nome = strtok(NULL, ",")) {
+        int i = 0;
+        while (i < quantidade && strcmp(nome, nomes[i]) != 0) i++;
+        if (i == quantidade) {
+            fprintf(stderr, "Nome desconhecido: %s\n", nome);
+            return false;
+        }
+        marcados[i] = true;
+    }
+    return true;
+}
+
+/**
+ * Lê a lista de tamanhos (aceita notação científica: 1e3,1e6)
+ * @return false se algum tamanho é inválido
+ */
+static bool lerTamanhos(const char *lista, struct opcoes *o) {
+    const char *p = lista;
+    o->quantidadeTamanhos = 0;
+    while (*p != '\0' && o->quantidadeTamanhos < MAX_TAMANHOS) {
+        char *fim;
+        double valor = strtod(p, &fim);
+        if (fim == p || valor < 1 || valor > 2e9) {
+            return false;
+        }
+        o->tamanhos[o->quantidadeTamanhos++] = (size_t) valor;
+        p = *fim == ',' ? fim + 1 : fim;
+    }
+    return o->quantidadeTamanhos > 0;
+}
+
+int main(int argc, char *argv[]) {
+    struct opcoes o;
+    const char *nomesEstruturas[QUANTIDADE_ESTRUTURAS];
+    const char *caminho = NULL;
+    memset(&o, 0, sizeof(o));
+    for (int i = 0; i < QUANTIDADE_ESTRUTURAS; i++) {
+        nomesEstruturas[i] = estruturas[i].nome;
+        o.estruturas[i] = true;
+    }
+    for (int c = 0; c < QUANTIDADE_CARGAS; c++) {
+        o.cargas[c] = true;
+    }
+    lerTamanhos("1e3,1e4,1e5,1e6", &o);
+    o.semente = 0x2545F4914F6CDD1Dull;
+    o.expoenteZipf = 0.99;
+
+    for (int i = 1; i < argc; i++) {
+        bool temValor = i + 1 < argc;
+        if (strcmp(argv[i], "-e") == 0 && temValor) {
+            if (!marcarNomes(argv[++i], nomesEstruturas, QUANTIDADE_ESTRUTURAS, o.estruturas)) return EXIT_FAILURE;
+        } else if (strcmp(argv[i], "-c") == 0 && temValor) {
+            if (!marcarNomes(argv[++i], nomesCargas, QUANTIDADE_CARGAS, o.cargas)) return EXIT_FAILURE;
+        } else if (strcmp(argv[i], "-n") == 0 && temValor) {
+            if (!lerTamanhos(argv[++i], &o)) {
+                fprintf(stderr, "Tamanhos inválidos: %s\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        } else if (strcmp(argv[i], "-f") == 0 && temValor) {
+            o.csv = strcmp(argv[++i], "csv") == 0;
+        } else if (strcmp(argv[i], "-o") == 0 && temValor) {
+            caminho = argv[++i];
+        } else if (strcmp(argv[i], "-s") == 0 && temValor) {
+            o.semente = strtoull(argv[++i], NULL, 0) | 1;
+        } else if (strcmp(argv[i], "-z") == 0 && temValor) {
+            o.expoenteZipf = atof(argv[++i]);
+            if (o.expoenteZipf <= 0.0 || o.expoenteZipf >= 1.0) {
+                fprintf(stderr, "O expoente do Zipf deve estar entre 0 e 1 (exclusive)\n");
+                return EXIT_FAILURE;
+            }
+        } else if (strcmp(argv[i], "-t") == 0) {
+            o.ignorarLimites = true;
+        } else {
+            fprintf(stderr, "Uso: %s [-e estruturas] [-c cargas] [-n tamanhos] [-f json|csv] [-o arquivo] "
+                            "[-s semente] [-z expoente] [-t]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Os resultados saem por uma cópia da saída padrão (ou pelo arquivo);
+    // a saída padrão em si passa a ser /dev/null, onde as estruturas ainda imprimem
+    FILE *saida = caminho != NULL ? fopen(caminho, "w") : fdopen(dup(STDOUT_FILENO), "w");
+    if (saida == NULL) {
+        fprintf(stderr, "Erro ao abrir a saída\n");
+        return EXIT_FAILURE;
+    }
+    fflush(stdout);
+    int nulo = open("/dev/null", O_WRONLY);
+    dup2(nulo, STDOUT_FILENO);
+    close(nulo);
+
+    if (o.csv) {
+        imprimirCabecalhoCSV(saida);
+    }
+    for (int i = 0; i < QUANTIDADE_ESTRUTURAS; i++) {
+        if (!o.estruturas[i]) continue;
+        const struct estruturaBench *e = &estruturas[i];
+        for (int carga = 0; carga < QUANTIDADE_CARGAS; carga++) {
+            if (!o.cargas[carga]) continue;
+            if (carga == CARGA_MISTA && e->remover == NULL) {
+                fprintf(stderr, "Pulando %s/%s: a estrutura não tem remoção\n", e->nome, nomesCargas[carga]);
+                continue;
+            }
+            for (int t = 0; t < o.quantidadeTamanhos; t++) {
+                size_t n = o.tamanhos[t];
+                bool desfavoravel = carga == CARGA_ORDENADA || carga == CARGA_ZIPF;
+                size_t limite = desfavoravel ? e->limiteDesfavoravel : e->limite;
+                if (n > limite && !o.ignorarLimites) {
+                    fprintf(stderr, "Pulando %s/%s/n=%zu: acima do limite de %zu (use -t para forçar)\n",
+                            e->nome, nomesCargas[carga], n, limite);
+                    continue;
+                }
+
+                fflush(saida);
+                pid_t filho = fork();
+                if (filho < 0) {
+                    fprintf(stderr, "Erro ao criar processo\n");
+                    return EXIT_FAILURE;
+                }
+                if (filho == 0) {
+                    executarRodada(e, carga, n, &o, saida);
+                    _exit(0);
+                }
+                int estado;
+                waitpid(filho, &estado, 0);
+                if (!WIFEXITED(estado) || WEXITSTATUS(estado) != 0) {
+                    fprintf(stderr, "Rodada %s/%s/n=%zu falhou (%s %d)\n", e->nome, nomesCargas[carga], n,
+                            WIFSIGNALED(estado) ? "sinal" : "código",
+                            WIFSIGNALED(estado) ? WTERMSIG(estado) : WEXITSTATUS(estado));
+                }
+            }
+        }
+    }
+    fclose(saida);
+    return 0;
+}
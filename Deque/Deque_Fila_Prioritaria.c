@@ -8,15 +8,52 @@
  * Regra de atendimento:
  * - A cada 5 atendimentos preferenciais, 1 pessoa da fila normal é atendida
  * - Se uma das filas estiver vazia, atende-se a outra fila
+ *
+ * Instrumentação opcional (compile com -DINSTRUMENTAR):
+ * - Marca o instante de entrada de cada pessoa na fila
+ * - Histograma HDR do tempo de espera por classe (normal/preferencial)
+ * - Pico de profundidade de cada fila e contadores de atendimento
+ * - Contagem de vezes em que a fila normal foi preterida
+ * Sem a flag, as macros de métrica não geram código algum.
+ *
+ *   gcc -O2 -DINSTRUMENTAR Deque_Fila_Prioritaria.c -o deque
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
 
+#ifdef INSTRUMENTAR
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "../Histograma_HDR/Histograma_HDR.h"
+
+// Métricas de uma das classes de atendimento
+struct metricasClasse {
+    struct histograma espera;   // Tempo entre entrar e ser atendido (ns)
+    uint64_t entradas;
+    uint64_t atendimentos;
+    uint64_t profundidade;      // Pessoas aguardando agora
+    uint64_t picoProfundidade;  // Maior profundidade já observada
+};
+
+// Conjunto de métricas do deque
+struct metricas {
+    struct metricasClasse normal;
+    struct metricasClasse preferencial;
+    uint64_t preteridas;        // Preferenciais atendidos com a fila normal ocupada
+    uint64_t sequenciaAtual;    // Preteridas consecutivas desde o último normal
+    uint64_t maiorSequencia;    // Maior sequência de preteridas
+};
+#endif
+
 // Estrutura de um nó da fila
 struct no {
     int numero;
+#ifdef INSTRUMENTAR
+    uint64_t entrada;           // Instante de entrada na fila (ns)
+#endif
     struct no *proximo;
 };
 
@@ -24,14 +61,88 @@ struct no {
 struct deque {
     struct no *filaNormal;
     struct no *filaPreferencial;
+#ifdef INSTRUMENTAR
+    struct metricas metricas;
+#endif
 };
 
+#ifdef INSTRUMENTAR
+/**
+ * Lê o relógio monotônico
+ * @return Instante atual em nanossegundos
+ */
+static inline uint64_t agoraNs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t) t.tv_sec * 1000000000u + (uint64_t) t.tv_nsec;
+}
+
+/**
+ * Zera todas as métricas do deque
+ * @param m Ponteiro para as métricas
+ */
+void iniciarMetricas(struct metricas *m) {
+    memset(m, 0, sizeof(*m));
+    zerarHistograma(&m->normal.espera);
+    zerarHistograma(&m->preferencial.espera);
+}
+
+/**
+ * Registra a entrada de uma pessoa em uma das filas
+ * @param m Ponteiro para as métricas
+ * @param tipo true para fila normal, false para preferencial
+ * @param no Nó recém inserido
+ */
+static inline void registrarEntrada(struct metricas *m, bool tipo, struct no *no) {
+    struct metricasClasse *classe = tipo ? &m->normal : &m->preferencial;
+    no->entrada = agoraNs();
+    classe->entradas++;
+    if (++classe->profundidade > classe->picoProfundidade) {
+        classe->picoProfundidade = classe->profundidade;
+    }
+}
+
+/**
+ * Registra o atendimento de uma pessoa
+ * @param cabeca Ponteiro para o deque (antes da remoção)
+ * @param tipo true para fila normal, false para preferencial
+ * @param no Nó que está sendo atendido
+ */
+static inline void registrarSaida(struct deque *cabeca, bool tipo, struct no *no) {
+    struct metricas *m = &cabeca->metricas;
+    struct metricasClasse *classe = tipo ? &m->normal : &m->preferencial;
+    registrarHistograma(&classe->espera, agoraNs() - no->entrada);
+    classe->atendimentos++;
+    classe->profundidade--;
+
+    if (tipo) {
+        m->sequenciaAtual = 0;
+    } else if (cabeca->filaNormal != NULL) {
+        m->preteridas++;
+        if (++m->sequenciaAtual > m->maiorSequencia) {
+            m->maiorSequencia = m->sequenciaAtual;
+        }
+    }
+}
+
+#define METRICA_INICIAR(cabeca) iniciarMetricas(&(cabeca)->metricas)
+#define METRICA_ENTRADA(cabeca, tipo, no) registrarEntrada(&(cabeca)->metricas, tipo, no)
+#define METRICA_SAIDA(cabeca, tipo, no) registrarSaida(cabeca, tipo, no)
+#else
+#define METRICA_INICIAR(cabeca) ((void) 0)
+#define METRICA_ENTRADA(cabeca, tipo, no) ((void) (cabeca), (void) (tipo), (void) (no))
+#define METRICA_SAIDA(cabeca, tipo, no) ((void) (cabeca), (void) (tipo), (void) (no))
+#endif
+
 /**
- * Remove e retorna o último elemento de uma fila
+ * Remove o último elemento de uma fila
+ * @param cabeca Ponteiro para o deque (usado pela instrumentação)
  * @param fila Ponteiro para o início da fila
+ * @param tipo true para fila normal, false para preferencial
+ * @param numero Recebe o valor atendido (pode ser NULL)
  * @return Novo ponteiro para o início da fila
  */
-struct no *sair(struct no *fila) {
+struct no *sair(struct deque *cabeca, struct no *fila, bool tipo, int *numero) {
     // Fila vazia
     if (fila == NULL) {
         return NULL;
@@ -39,7 +150,10 @@ struct no *sair(struct no *fila) {
     
     // Fila com um elemento
     if (fila->proximo == NULL) {
-        printf("Atendido: %d\n", fila->numero);
+        if (numero != NULL) {
+            *numero = fila->numero;
+        }
+        METRICA_SAIDA(cabeca, tipo, fila);
         free(fila);
         return NULL;
     }
@@ -50,7 +164,10 @@ struct no *sair(struct no *fila) {
         penultimo = penultimo->proximo;
     }
     
-    printf("Atendido: %d\n", penultimo->proximo->numero);
+    if (numero != NULL) {
+        *numero = penultimo->proximo->numero;
+    }
+    METRICA_SAIDA(cabeca, tipo, penultimo->proximo);
     free(penultimo->proximo);
     penultimo->proximo = NULL;
     return fila;
@@ -82,6 +199,7 @@ struct deque *entrar(struct deque *cabeca, bool tipo, int numero) {
         cabeca->filaPreferencial = novoNo;
     }
     
+    METRICA_ENTRADA(cabeca, tipo, novoNo);
     return cabeca;
 }
 
@@ -89,35 +207,37 @@ struct deque *entrar(struct deque *cabeca, bool tipo, int numero) {
  * Realiza o atendimento seguindo as regras de prioridade
  * @param cabeca Ponteiro para o deque
  * @param contador Contador de atendimentos preferenciais
+ * @param numero Recebe o valor atendido (pode ser NULL)
+ * @return false se as duas filas estão vazias
  */
-void atender(struct deque *cabeca, int *contador) {
+bool atender(struct deque *cabeca, int *contador, int *numero) {
     // Deque vazio
     if (!cabeca->filaNormal && !cabeca->filaPreferencial) {
-        printf("Nenhuma fila para atender!\n");
-        return;
+        return false;
     }
     
     // Apenas fila normal tem pessoas
     if (!cabeca->filaPreferencial) {
-        cabeca->filaNormal = sair(cabeca->filaNormal);
-        return;
+        cabeca->filaNormal = sair(cabeca, cabeca->filaNormal, true, numero);
+        return true;
     }
     
     // Apenas fila preferencial tem pessoas
     if (!cabeca->filaNormal) {
-        cabeca->filaPreferencial = sair(cabeca->filaPreferencial);
+        cabeca->filaPreferencial = sair(cabeca, cabeca->filaPreferencial, false, numero);
         *contador += 1;
-        return;
+        return true;
     }
     
     // Ambas as filas têm pessoas
     if (*contador > 4) {  // Após 5 preferenciais, atende 1 normal
-        cabeca->filaNormal = sair(cabeca->filaNormal);
+        cabeca->filaNormal = sair(cabeca, cabeca->filaNormal, true, numero);
         *contador = 0;
     } else {
-        cabeca->filaPreferencial = sair(cabeca->filaPreferencial);
+        cabeca->filaPreferencial = sair(cabeca, cabeca->filaPreferencial, false, numero);
         *contador += 1;
     }
+    return true;
 }
 
 /**
@@ -141,6 +261,84 @@ void imprimir(struct deque *cabeca) {
     printf("\n");
 }
 
+#ifdef INSTRUMENTAR
+/**
+ * Exporta as métricas de uma classe
+ * @param saida Arquivo de destino
+ * @param nome Nome da classe
+ * @param c Ponteiro para as métricas da classe
+ * @param json true para JSON, false para texto
+ */
+static void exportarClasse(FILE *saida, const char *nome,
+                           const struct metricasClasse *c, bool json) {
+    const struct histograma *h = &c->espera;
+    double media = h->total ? (double) h->soma / (double) h->total : 0.0;
+    uint64_t minimo = h->total ? h->minimo : 0;
+
+    if (json) {
+        fprintf(saida,
+                "\"%s\":{\"entradas\":%llu,\"atendimentos\":%llu,"
+                "\"profundidade\":%llu,\"pico_profundidade\":%llu,"
+                "\"espera_ns\":{\"min\":%llu,\"media\":%.1f,\"p50\":%llu,"
+                "\"p90\":%llu,\"p99\":%llu,\"p999\":%llu,\"max\":%llu}}",
+                nome,
+                (unsigned long long) c->entradas,
+                (unsigned long long) c->atendimentos,
+                (unsigned long long) c->profundidade,
+                (unsigned long long) c->picoProfundidade,
+                (unsigned long long) minimo, media,
+                (unsigned long long) percentilHistograma(h, 50.0),
+                (unsigned long long) percentilHistograma(h, 90.0),
+                (unsigned long long) percentilHistograma(h, 99.0),
+                (unsigned long long) percentilHistograma(h, 99.9),
+                (unsigned long long) h->maximo);
+        return;
+    }
+
+    fprintf(saida, "Fila %s:\n", nome);
+    fprintf(saida, "  entradas=%llu atendimentos=%llu profundidade=%llu pico=%llu\n",
+            (unsigned long long) c->entradas,
+            (unsigned long long) c->atendimentos,
+            (unsigned long long) c->profundidade,
+            (unsigned long long) c->picoProfundidade);
+    fprintf(saida, "  espera (ns): min=%llu media=%.1f p50=%llu p90=%llu "
+                   "p99=%llu p99.9=%llu max=%llu\n",
+            (unsigned long long) minimo, media,
+            (unsigned long long) percentilHistograma(h, 50.0),
+            (unsigned long long) percentilHistograma(h, 90.0),
+            (unsigned long long) percentilHistograma(h, 99.0),
+            (unsigned long long) percentilHistograma(h, 99.9),
+            (unsigned long long) h->maximo);
+}
+
+/**
+ * Exporta um retrato (snapshot) das métricas do deque
+ * @param saida Arquivo de destino
+ * @param cabeca Ponteiro para o deque
+ * @param json true para JSON, false para texto
+ */
+void exportarMetricas(FILE *saida, const struct deque *cabeca, bool json) {
+    const struct metricas *m = &cabeca->metricas;
+
+    if (json) {
+        fprintf(saida, "{");
+        exportarClasse(saida, "preferencial", &m->preferencial, true);
+        fprintf(saida, ",");
+        exportarClasse(saida, "normal", &m->normal, true);
+        fprintf(saida, ",\"preteridas\":%llu,\"maior_sequencia_preteridas\":%llu}\n",
+                (unsigned long long) m->preteridas,
+                (unsigned long long) m->maiorSequencia);
+        return;
+    }
+
+    exportarClasse(saida, "preferencial", &m->preferencial, false);
+    exportarClasse(saida, "normal", &m->normal, false);
+    fprintf(saida, "Fila normal preterida %llu vezes (maior sequencia: %llu)\n",
+            (unsigned long long) m->preteridas,
+            (unsigned long long) m->maiorSequencia);
+}
+#endif
+
 int main() {
     // Inicialização do deque
     struct deque *cabeca = (struct deque *) malloc(sizeof(struct deque));
@@ -151,6 +349,7 @@ int main() {
     
     cabeca->filaNormal = NULL;
     cabeca->filaPreferencial = NULL;
+    METRICA_INICIAR(cabeca);
     int contador = 0;
     
     // Exemplo de uso
@@ -169,12 +368,23 @@ int main() {
     
     printf("\nRealizando atendimentos:\n");
     for (int i = 0; i < 15; i++) {
-        atender(cabeca, &contador); 
+        int numero;
+        if (atender(cabeca, &contador, &numero)) {
+            printf("Atendido: %d\n", numero);
+        } else {
+            printf("Nenhuma fila para atender!\n");
+        }
     }
     
     printf("\nEstado final das filas:\n");
     imprimir(cabeca);
     
+#ifdef INSTRUMENTAR
+    printf("\nMetricas de atendimento:\n");
+    exportarMetricas(stdout, cabeca, false);
+    exportarMetricas(stdout, cabeca, true);
+#endif
+    
     // Libera memória
     while (cabeca->filaNormal != NULL) {
         struct no *temp = cabeca->filaNormal;
@@ -9,12 +9,16 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include "../Alocador_Nos/Alocador_Nos.h"
 
 struct no {
     int numero;
     struct no *proximo;
 };
 
+// Alocador dos nós (caches por thread, ver Alocador_Nos.h)
+static struct alocadorNos alocadorFila = ALOCADOR_NOS_INICIALIZADOR(struct no);
+
 /**
  * Insere um novo número no início da fila
  * @param inicio Ponteiro para o início da fila
@@ -22,28 +26,30 @@ struct no {
  * @return Novo ponteiro para o início da fila
  */
 struct no *entrar(struct no *inicio, int numero) {
-    struct no *novoNo = (struct no *) malloc(sizeof(struct no));
+    struct no *novoNo = (struct no *) alocarNo(&alocadorFila);
     novoNo->numero = numero;
     novoNo->proximo = inicio;
     return novoNo;
 }
 
 /**
- * Remove e retorna o último elemento da fila
- * @param inicio Ponteiro para o início da fila
+ * Remove o último elemento da fila
+ * @param inicio Ponteiro para o início da fila (não vazia)
+ * @param numero Recebe o valor removido (pode ser NULL)
  * @return Novo ponteiro para o início da fila
  */
-struct no *sair(struct no *inicio) {
+struct no *sair(struct no *inicio, int *numero) {
     // Fila vazia
     if (inicio == NULL) {
-        printf("Fila vazia!\n");
         return NULL;
     }
 
     // Fila com um único elemento
     if (inicio->proximo == NULL) {
-        printf("Removido: %d\n", inicio->numero);
-        free(inicio);
+        if (numero != NULL) {
+            *numero = inicio->numero;
+        }
+        liberarNo(&alocadorFila, inicio);
         return NULL;
     }
 
@@ -54,8 +60,10 @@ struct no *sair(struct no *inicio) {
     }
 
     // Remove o último elemento
-    printf("Removido: %d\n", penultimo->proximo->numero);
-    free(penultimo->proximo);
+    if (numero != NULL) {
+        *numero = penultimo->proximo->numero;
+    }
+    liberarNo(&alocadorFila, penultimo->proximo);
     penultimo->proximo = NULL;
     return inicio;
 }
@@ -103,7 +111,12 @@ int main() {
                 fila = entrar(fila, numero);
                 break;
             case 2:
-                fila = sair(fila);
+                if (fila == NULL) {
+                    printf("Fila vazia!\n");
+                    break;
+                }
+                fila = sair(fila, &numero);
+                printf("Removido: %d\n", numero);
                 break;
             case 3:
                 imprimir(fila);
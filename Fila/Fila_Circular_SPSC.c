@@ -0,0 +1,336 @@
+/**
+ * Implementação de Fila Circular SPSC (Single Producer, Single Consumer) em C
+ *
+ * Este código implementa uma fila limitada sem travas (lock-free) para a
+ * passagem de itens entre exatamente duas threads, onde:
+ * - Os itens ficam em um vetor circular de capacidade potência de 2
+ * - O produtor só escreve o índice de fim e o consumidor só escreve o de início
+ * - Cada índice fica em sua própria linha de cache, junto de uma cópia local
+ *   do índice do outro lado, evitando tráfego de coerência a cada operação
+ * - A sincronização usa apenas atomics com semântica acquire/release
+ * - Entradas e saídas podem ser feitas em lote (até N itens por chamada)
+ *
+ * Diferente de Fila.c, nenhuma operação aloca memória ou percorre a fila:
+ * todas são O(1) por item.
+ *
+ *   gcc -O2 -pthread Fila_Circular_SPSC.c -o fila_spsc
+ *   ./fila_spsc [itens] [lote]
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <time.h>
+
+#define LINHA_CACHE 64
+
+// Estrutura da fila circular SPSC
+struct filaSPSC {
+    // Lado do produtor
+    alignas(LINHA_CACHE) atomic_size_t fim;  // Próxima posição de escrita
+    size_t inicioCache;                      // Última leitura conhecida de início
+
+    // Lado do consumidor
+    alignas(LINHA_CACHE) atomic_size_t inicio; // Próxima posição de leitura
+    size_t fimCache;                           // Última leitura conhecida de fim
+
+    // Campos imutáveis após a criação
+    alignas(LINHA_CACHE) size_t capacidade;
+    size_t mascara;
+    int *itens;
+};
+
+/**
+ * Cria uma fila SPSC
+ * @param capacidade Número mínimo de itens (arredondado para potência de 2)
+ * @return Ponteiro para a nova fila
+ */
+struct filaSPSC *criarFilaSPSC(size_t capacidade) {
+    size_t tamanho = 2;
+    while (tamanho < capacidade) {
+        tamanho <<= 1;
+    }
+
+    struct filaSPSC *fila = (struct filaSPSC *) aligned_alloc(LINHA_CACHE, sizeof(struct filaSPSC));
+    // aligned_alloc exige tamanho múltiplo do alinhamento
+    size_t bytes = (tamanho * sizeof(int) + LINHA_CACHE - 1) / LINHA_CACHE * LINHA_CACHE;
+    int *itens = (int *) aligned_alloc(LINHA_CACHE, bytes);
+    if (fila == NULL || itens == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    atomic_init(&fila->fim, 0);
+    atomic_init(&fila->inicio, 0);
+    fila->inicioCache = 0;
+    fila->fimCache = 0;
+    fila->capacidade = tamanho;
+    fila->mascara = tamanho - 1;
+    fila->itens = itens;
+    return fila;
+}
+
+/**
+ * Libera a memória da fila
+ * @param fila Ponteiro para a fila
+ */
+void liberarFilaSPSC(struct filaSPSC *fila) {
+    free(fila->itens);
+    free(fila);
+}
+
+/**
+ * Insere até n itens no fim da fila (somente a thread produtora)
+ * @param fila Ponteiro para a fila
+ * @param itens Vetor com os valores a inserir
+ * @param n Quantidade de itens desejada
+ * @return Quantidade de itens realmente inseridos (pode ser menor se encher)
+ */
+size_t entrarLoteSPSC(struct filaSPSC *fila, const int *itens, size_t n) {
+    size_t fim = atomic_load_explicit(&fila->fim, memory_order_relaxed);
+    size_t livre = fila->capacidade - (fim - fila->inicioCache);
+
+    // Só consulta o índice do consumidor quando a cópia local não basta
+    if (livre < n) {
+        fila->inicioCache = atomic_load_explicit(&fila->inicio, memory_order_acquire);
+        livre = fila->capacidade - (fim - fila->inicioCache);
+        if (livre == 0) {
+            return 0;
+        }
+        if (n > livre) {
+            n = livre;
+        }
+    }
+
+    // Copia em até dois trechos por causa da volta no vetor circular
+    size_t posicao = fim & fila->mascara;
+    size_t primeiro = fila->capacidade - posicao;
+    if (primeiro > n) {
+        primeiro = n;
+    }
+    memcpy(fila->itens + posicao, itens, primeiro * sizeof(int));
+    memcpy(fila->itens, itens + primeiro, (n - primeiro) * sizeof(int));
+
+    atomic_store_explicit(&fila->fim, fim + n, memory_order_release);
+    return n;
+}
+
+/**
+ * Remove até n itens do início da fila (somente a thread consumidora)
+ * @param fila Ponteiro para a fila
+ * @param itens Vetor que recebe os valores removidos
+ * @param n Quantidade máxima de itens
+ * @return Quantidade de itens realmente removidos (0 se vazia)
+ */
+size_t sairLoteSPSC(struct filaSPSC *fila, int *itens, size_t n) {
+    size_t inicio = atomic_load_explicit(&fila->inicio, memory_order_relaxed);
+    size_t disponivel = fila->fimCache - inicio;
+
+    // Só consulta o índice do produtor quando a cópia local não basta
+    if (disponivel < n) {
+        fila->fimCache = atomic_load_explicit(&fila->fim, memory_order_acquire);
+        disponivel = fila->fimCache - inicio;
+        if (disponivel == 0) {
+            return 0;
+        }
+        if (n > disponivel) {
+            n = disponivel;
+        }
+    }
+
+    size_t posicao = inicio & fila->mascara;
+    size_t primeiro = fila->capacidade - posicao;
+    if (primeiro > n) {
+        primeiro = n;
+    }
+    memcpy(itens, fila->itens + posicao, primeiro * sizeof(int));
+    memcpy(itens + primeiro, fila->itens, (n - primeiro) * sizeof(int));
+
+    atomic_store_explicit(&fila->inicio, inicio + n, memory_order_release);
+    return n;
+}
+
+/**
+ * Insere um único número no fim da fila (somente a thread produtora)
+ * @param fila Ponteiro para a fila
+ * @param numero Valor a ser inserido
+ * @return true se inseriu, false se a fila estava cheia
+ */
+static inline bool entrarSPSC(struct filaSPSC *fila, int numero) {
+    size_t fim = atomic_load_explicit(&fila->fim, memory_order_relaxed);
+    if (fim - fila->inicioCache == fila->capacidade) {
+        fila->inicioCache = atomic_load_explicit(&fila->inicio, memory_order_acquire);
+        if (fim - fila->inicioCache == fila->capacidade) {
+            return false;
+        }
+    }
+    fila->itens[fim & fila->mascara] = numero;
+    atomic_store_explicit(&fila->fim, fim + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * Remove um único número do início da fila (somente a thread consumidora)
+ * @param fila Ponteiro para a fila
+ * @param numero Recebe o valor removido
+ * @return true se removeu, false se a fila estava vazia
+ */
+static inline bool sairSPSC(struct filaSPSC *fila, int *numero) {
+    size_t inicio = atomic_load_explicit(&fila->inicio, memory_order_relaxed);
+    if (inicio == fila->fimCache) {
+        fila->fimCache = atomic_load_explicit(&fila->fim, memory_order_acquire);
+        if (inicio == fila->fimCache) {
+            return false;
+        }
+    }
+    *numero = fila->itens[inicio & fila->mascara];
+    atomic_store_explicit(&fila->inicio, inicio + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * Espera ativa curta; cede o processador após muitas tentativas seguidas
+ * @param tentativas Contador de tentativas sem sucesso
+ */
+static inline void aguardar(unsigned *tentativas) {
+    if (++*tentativas < 64) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    } else {
+        *tentativas = 0;
+        sched_yield();
+    }
+}
+
+// Parâmetros compartilhados pelas threads do teste de vazão
+struct parametrosTeste {
+    struct filaSPSC *fila;
+    size_t total;
+    size_t lote;
+    int nucleo;
+    bool ordemCorreta;
+};
+
+/**
+ * Fixa a thread atual em um núcleo, se houver núcleos suficientes
+ * @param nucleo Índice do núcleo desejado
+ */
+static void fixarNucleo(int nucleo) {
+    cpu_set_t conjunto;
+    if (sysconf(_SC_NPROCESSORS_ONLN) <= nucleo) {
+        return;
+    }
+    CPU_ZERO(&conjunto);
+    CPU_SET(nucleo, &conjunto);
+    pthread_setaffinity_np(pthread_self(), sizeof(conjunto), &conjunto);
+}
+
+/**
+ * Thread produtora: insere os números 0..total-1 em lotes
+ */
+static void *produtor(void *arg) {
+    struct parametrosTeste *p = (struct parametrosTeste *) arg;
+    int *lote = (int *) malloc(p->lote * sizeof(int));
+    size_t enviados = 0;
+    unsigned tentativas = 0;
+
+    fixarNucleo(p->nucleo);
+    while (enviados < p->total) {
+        size_t n = p->total - enviados < p->lote ? p->total - enviados : p->lote;
+        for (size_t i = 0; i < n; i++) {
+            lote[i] = (int) (enviados + i);
+        }
+        size_t feitos = 0;
+        while (feitos < n) {
+            size_t k = entrarLoteSPSC(p->fila, lote + feitos, n - feitos);
+            if (k == 0) {
+                aguardar(&tentativas);
+            }
+            feitos += k;
+        }
+        enviados += n;
+    }
+    free(lote);
+    return NULL;
+}
+
+/**
+ * Thread consumidora: remove em lotes e confere a ordem FIFO
+ */
+static void *consumidor(void *arg) {
+    struct parametrosTeste *p = (struct parametrosTeste *) arg;
+    int *lote = (int *) malloc(p->lote * sizeof(int));
+    size_t recebidos = 0;
+    unsigned tentativas = 0;
+
+    fixarNucleo(p->nucleo);
+    p->ordemCorreta = true;
+    while (recebidos < p->total) {
+        size_t k = sairLoteSPSC(p->fila, lote, p->lote);
+        if (k == 0) {
+            aguardar(&tentativas);
+            continue;
+        }
+        for (size_t i = 0; i < k; i++) {
+            if (lote[i] != (int) (recebidos + i)) {
+                p->ordemCorreta = false;
+            }
+        }
+        recebidos += k;
+    }
+    free(lote);
+    return NULL;
+}
+
+int main(int argc, char *argv[]) {
+    size_t total = argc > 1 ? strtoull(argv[1], NULL, 10) : 100000000u;
+    size_t tamanhoLote = argc > 2 ? strtoull(argv[2], NULL, 10) : 64;
+    if (tamanhoLote == 0) {
+        tamanhoLote = 1;
+    }
+
+    // Exemplo de uso em uma única thread
+    struct filaSPSC *fila = criarFilaSPSC(8);
+    int numero;
+    for (int i = 0; i < 10; i++) {
+        if (!entrarSPSC(fila, i)) {
+            printf("Fila cheia ao inserir %d\n", i);
+        }
+    }
+    printf("Fila: ");
+    while (sairSPSC(fila, &numero)) {
+        printf("%d ", numero);
+    }
+    printf("\n");
+    liberarFilaSPSC(fila);
+
+    // Teste de vazão entre duas threads
+    fila = criarFilaSPSC(1 << 16);
+    struct parametrosTeste paramProdutor = {fila, total, tamanhoLote, 0, true};
+    struct parametrosTeste paramConsumidor = {fila, total, tamanhoLote, 1, true};
+    pthread_t threadProdutor, threadConsumidor;
+    struct timespec t0, t1;
+
+    printf("\nTransferindo %zu itens em lotes de %zu...\n", total, tamanhoLote);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    pthread_create(&threadConsumidor, NULL, consumidor, &paramConsumidor);
+    pthread_create(&threadProdutor, NULL, produtor, &paramProdutor);
+    pthread_join(threadProdutor, NULL);
+    pthread_join(threadConsumidor, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    double segundos = (double) (t1.tv_sec - t0.tv_sec) + (double) (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    printf("Ordem FIFO %s\n", paramConsumidor.ordemCorreta ? "preservada" : "VIOLADA");
+    printf("Tempo: %.3f s - %.1f milhoes de itens/s\n", segundos, (double) total / segundos / 1e6);
+
+    liberarFilaSPSC(fila);
+    return paramConsumidor.ordemCorreta ? 0 : 1;
+}
@@ -0,0 +1,515 @@
+/**
+ * Implementação de Fila Persistente em Disco com Cache em Memória em C
+ *
+ * Este código implementa uma fila FIFO gravada em disco, onde:
+ * - Todo item que entra é gravado no fim de um log de arquivos de segmento,
+ *   mapeados em memória (mmap) e escritos só no final
+ * - Um vetor circular de tamanho fixo guarda uma cópia do início da fila e
+ *   serve as leituras sem tocar nas páginas mapeadas. Ele só recebe um item
+ *   enquanto contém todos os anteriores; cheio, os itens seguintes são lidos
+ *   direto do disco, e ao esvaziar a fila o vetor volta a ser usado
+ * - A leitura de um segmento não copia dados: espiar() devolve um ponteiro
+ *   direto para a região mapeada
+ * - Segmentos totalmente consumidos são apagados
+ *
+ * Recuperação após falha:
+ * Cada segmento tem um cabeçalho com as contagens de itens escritos e lidos.
+ * O item é gravado antes de a contagem ser incrementada, e todo consumo,
+ * inclusive o servido pelo vetor, avança a contagem de lidos. Como o
+ * mapeamento é compartilhado, o conteúdo sobrevive ao término abrupto do
+ * processo: ao reabrir o diretório, exatamente os itens não consumidos são
+ * recuperados, na ordem original. Para sobreviver a uma queda de energia,
+ * chame sincronizarFilaPersistente() (msync) nos pontos desejados.
+ *
+ *   gcc -O2 Fila_Persistente.c -o fila_persistente
+ *   ./fila_persistente [diretorio] [itens]
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#define MAGICO_SEGMENTO 0x414C4946u   // "FILA" em little-endian
+#define VERSAO_SEGMENTO 1u
+#define ITENS_POR_SEGMENTO (1u << 20) // 4 MB de itens por segmento
+
+// Cabeçalho gravado no início de cada arquivo de segmento
+struct cabecalhoSegmento {
+    uint32_t magico;
+    uint32_t versao;
+    uint64_t capacidade;   // Itens que cabem no segmento
+    uint64_t escritos;     // Itens já gravados (confirmados)
+    uint64_t lidos;        // Itens já consumidos
+};
+
+// Segmento mapeado em memória
+struct segmento {
+    unsigned numero;
+    struct cabecalhoSegmento *cabecalho;
+    int *itens;
+    size_t bytes;
+    struct segmento *proximo;
+};
+
+// Estrutura da fila persistente
+struct filaPersistente {
+    char diretorio[1024];
+
+    // Cópia do início da fila em memória (vetor circular)
+    int *anel;
+    size_t capacidadeAnel;
+    size_t inicioAnel;
+    size_t quantidadeAnel;
+
+    // Log em disco, do segmento mais antigo ao mais novo
+    struct segmento *primeiroSegmento;
+    struct segmento *ultimoSegmento;
+    unsigned proximoNumero;
+    size_t itensEmDisco;        // Todos os itens pendentes, inclusive os copiados no vetor
+};
+
+/**
+ * Monta o caminho do arquivo de um segmento
+ * @param fila Ponteiro para a fila
+ * @param numero Número do segmento
+ * @param caminho Buffer de destino
+ * @param tamanho Tamanho do buffer
+ */
+static void caminhoSegmento(const struct filaPersistente *fila, unsigned numero,
+                            char *caminho, size_t tamanho) {
+    snprintf(caminho, tamanho, "%s/segmento-%010u.fila", fila->diretorio, numero);
+}
+
+/**
+ * Mapeia um arquivo de segmento, criando-o se necessário
+ * @param fila Ponteiro para a fila
+ * @param numero Número do segmento
+ * @param criar true para criar um segmento novo e vazio
+ * @return Ponteiro para o segmento ou NULL se o arquivo for inválido
+ */
+static struct segmento *mapearSegmento(struct filaPersistente *fila, unsigned numero, bool criar) {
+    char caminho[1200];
+    caminhoSegmento(fila, numero, caminho, sizeof(caminho));
+
+    int fd = open(caminho, criar ? O_RDWR | O_CREAT | O_TRUNC : O_RDWR, 0644);
+    if (fd < 0) {
+        fprintf(stderr, "Erro ao abrir %s: %s\n", caminho, strerror(errno));
+        return NULL;
+    }
+
+    size_t bytes = sizeof(struct cabecalhoSegmento) + (size_t) ITENS_POR_SEGMENTO * sizeof(int);
+    if (criar) {
+        if (ftruncate(fd, (off_t) bytes) != 0) {
+            fprintf(stderr, "Erro ao dimensionar %s: %s\n", caminho, strerror(errno));
+            close(fd);
+            return NULL;
+        }
+    } else {
+        struct stat info;
+        if (fstat(fd, &info) != 0 || (size_t) info.st_size < sizeof(struct cabecalhoSegmento)) {
+            close(fd);
+            return NULL;
+        }
+        bytes = (size_t) info.st_size;
+    }
+
+    void *mapa = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapa == MAP_FAILED) {
+        fprintf(stderr, "Erro ao mapear %s: %s\n", caminho, strerror(errno));
+        return NULL;
+    }
+
+    struct cabecalhoSegmento *cabecalho = (struct cabecalhoSegmento *) mapa;
+    if (criar) {
+        cabecalho->magico = MAGICO_SEGMENTO;
+        cabecalho->versao = VERSAO_SEGMENTO;
+        cabecalho->capacidade = ITENS_POR_SEGMENTO;
+        cabecalho->escritos = 0;
+        cabecalho->lidos = 0;
+    } else if (cabecalho->magico != MAGICO_SEGMENTO ||
+               cabecalho->versao != VERSAO_SEGMENTO ||
+               sizeof(struct cabecalhoSegmento) + cabecalho->capacidade * sizeof(int) > bytes ||
+               cabecalho->escritos > cabecalho->capacidade ||
+               cabecalho->lidos > cabecalho->escritos) {
+        fprintf(stderr, "Segmento corrompido ignorado: %s\n", caminho);
+        munmap(mapa, bytes);
+        return NULL;
+    }
+
+    struct segmento *seg = (struct segmento *) malloc(sizeof(struct segmento));
+    if (seg == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    seg->numero = numero;
+    seg->cabecalho = cabecalho;
+    seg->itens = (int *) (cabecalho + 1);
+    seg->bytes = bytes;
+    seg->proximo = NULL;
+    return seg;
+}
+
+/**
+ * Desmapeia um segmento, apagando o arquivo se pedido
+ * @param fila Ponteiro para a fila
+ * @param seg Segmento a liberar
+ * @param apagar true para remover o arquivo do disco
+ */
+static void liberarSegmento(struct filaPersistente *fila, struct segmento *seg, bool apagar) {
+    if (apagar) {
+        char caminho[1200];
+        caminhoSegmento(fila, seg->numero, caminho, sizeof(caminho));
+        unlink(caminho);
+    }
+    munmap(seg->cabecalho, seg->bytes);
+    free(seg);
+}
+
+/**
+ * Compara números de segmento (para qsort)
+ */
+static int compararNumeros(const void *a, const void *b) {
+    unsigned x = *(const unsigned *) a;
+    unsigned y = *(const unsigned *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Recupera os segmentos existentes no diretório, em ordem
+ * @param fila Ponteiro para a fila
+ */
+static void recuperarSegmentos(struct filaPersistente *fila) {
+    DIR *dir = opendir(fila->diretorio);
+    if (dir == NULL) {
+        return;
+    }
+
+    unsigned *numeros = NULL;
+    size_t quantidade = 0, capacidade = 0;
+    struct dirent *entrada;
+    while ((entrada = readdir(dir)) != NULL) {
+        unsigned numero;
+        char sufixo[8];
+        if (sscanf(entrada->d_name, "segmento-%10u.%5s", &numero, sufixo) == 2 &&
+            strcmp(sufixo, "fila") == 0) {
+            if (quantidade == capacidade) {
+                capacidade = capacidade ? capacidade * 2 : 16;
+                numeros = (unsigned *) realloc(numeros, capacidade * sizeof(unsigned));
+                if (numeros == NULL) {
+                    fprintf(stderr, "Erro na alocação de memória.\n");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            numeros[quantidade++] = numero;
+        }
+    }
+    closedir(dir);
+    if (quantidade > 0) {
+        qsort(numeros, quantidade, sizeof(unsigned), compararNumeros);
+    }
+
+    for (size_t i = 0; i < quantidade; i++) {
+        struct segmento *seg = mapearSegmento(fila, numeros[i], false);
+        if (seg == NULL) {
+            continue;
+        }
+
+        size_t pendentes = (size_t) (seg->cabecalho->escritos - seg->cabecalho->lidos);
+        if (pendentes == 0) {
+            liberarSegmento(fila, seg, true);
+            continue;
+        }
+
+        if (fila->ultimoSegmento == NULL) {
+            fila->primeiroSegmento = seg;
+        } else {
+            fila->ultimoSegmento->proximo = seg;
+        }
+        fila->ultimoSegmento = seg;
+        fila->itensEmDisco += pendentes;
+        if (seg->numero >= fila->proximoNumero) {
+            fila->proximoNumero = seg->numero + 1;
+        }
+    }
+    free(numeros);
+}
+
+/**
+ * Abre (ou cria) uma fila persistente em um diretório
+ * @param diretorio Diretório dos segmentos (criado se não existir)
+ * @param capacidadeAnel Quantidade de itens mantidos em memória
+ * @return Ponteiro para a fila
+ */
+struct filaPersistente *abrirFilaPersistente(const char *diretorio, size_t capacidadeAnel) {
+    struct filaPersistente *fila = (struct filaPersistente *) calloc(1, sizeof(struct filaPersistente));
+    if (fila == NULL || capacidadeAnel == 0) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    snprintf(fila->diretorio, sizeof(fila->diretorio), "%s", diretorio);
+    if (mkdir(diretorio, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "Erro ao criar %s: %s\n", diretorio, strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    fila->anel = (int *) malloc(capacidadeAnel * sizeof(int));
+    if (fila->anel == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    fila->capacidadeAnel = capacidadeAnel;
+
+    recuperarSegmentos(fila);
+    return fila;
+}
+
+/**
+ * Grava um número no fim do log em disco
+ * @param fila Ponteiro para a fila
+ * @param numero Valor a ser gravado
+ * @return false se um segmento novo não pôde ser criado
+ */
+static bool gravarNoDisco(struct filaPersistente *fila, int numero) {
+    struct segmento *seg = fila->ultimoSegmento;
+    if (seg == NULL || seg->cabecalho->escritos == seg->cabecalho->capacidade) {
+        struct segmento *novo = mapearSegmento(fila, fila->proximoNumero, true);
+        if (novo == NULL) {
+            return false;
+        }
+        fila->proximoNumero++;
+        if (seg == NULL) {
+            fila->primeiroSegmento = novo;
+        } else {
+            seg->proximo = novo;
+        }
+        fila->ultimoSegmento = seg = novo;
+    }
+
+    // Grava o item antes de publicá-lo na contagem
+    uint64_t posicao = seg->cabecalho->escritos;
+    seg->itens[posicao] = numero;
+    __atomic_store_n(&seg->cabecalho->escritos, posicao + 1, __ATOMIC_RELEASE);
+    fila->itensEmDisco++;
+    return true;
+}
+
+/**
+ * Insere um número no fim da fila
+ * @param fila Ponteiro para a fila
+ * @param numero Valor a ser inserido
+ * @return true se inseriu, false se o item não pôde ser gravado em disco
+ */
+bool entrarFilaPersistente(struct filaPersistente *fila, int numero) {
+    if (!gravarNoDisco(fila, numero)) {
+        return false;
+    }
+
+    // O vetor só recebe a cópia se já tem todos os itens anteriores
+    if (fila->quantidadeAnel + 1 == fila->itensEmDisco && fila->quantidadeAnel < fila->capacidadeAnel) {
+        size_t posicao = fila->inicioAnel + fila->quantidadeAnel;
+        if (posicao >= fila->capacidadeAnel) {
+            posicao -= fila->capacidadeAnel;
+        }
+        fila->anel[posicao] = numero;
+        fila->quantidadeAnel++;
+    }
+    return true;
+}
+
+/**
+ * Retorna um ponteiro para os próximos itens contíguos da fila, sem copiar
+ * @param fila Ponteiro para a fila
+ * @param itens Recebe o ponteiro para o primeiro item
+ * @return Quantidade de itens contíguos disponíveis (0 se vazia)
+ */
+size_t espiarFilaPersistente(struct filaPersistente *fila, const int **itens) {
+    if (fila->quantidadeAnel > 0) {
+        size_t contiguos = fila->capacidadeAnel - fila->inicioAnel;
+        *itens = fila->anel + fila->inicioAnel;
+        return contiguos < fila->quantidadeAnel ? contiguos : fila->quantidadeAnel;
+    }
+
+    struct segmento *seg = fila->primeiroSegmento;
+    if (seg == NULL) {
+        *itens = NULL;
+        return 0;
+    }
+    uint64_t lidos = seg->cabecalho->lidos;
+    *itens = seg->itens + lidos;
+    return (size_t) (seg->cabecalho->escritos - lidos);
+}
+
+/**
+ * Descarta itens do início da fila (após espiarFilaPersistente)
+ * @param fila Ponteiro para a fila
+ * @param n Quantidade de itens a descartar (no máximo o valor retornado por espiar)
+ */
+void consumirFilaPersistente(struct filaPersistente *fila, size_t n) {
+    if (fila->quantidadeAnel > 0) {
+        fila->inicioAnel += n;
+        if (fila->inicioAnel >= fila->capacidadeAnel) {
+            fila->inicioAnel -= fila->capacidadeAnel;
+        }
+        fila->quantidadeAnel -= n;
+    }
+
+    // Registra o consumo no disco; itens lidos do vetor podem cruzar segmentos
+    while (n > 0 && fila->primeiroSegmento != NULL) {
+        struct segmento *seg = fila->primeiroSegmento;
+        uint64_t disponiveis = seg->cabecalho->escritos - seg->cabecalho->lidos;
+        size_t k = n < disponiveis ? n : (size_t) disponiveis;
+        __atomic_store_n(&seg->cabecalho->lidos, seg->cabecalho->lidos + k, __ATOMIC_RELEASE);
+        fila->itensEmDisco -= k;
+        n -= k;
+
+        // Segmento totalmente lido que não receberá mais escritas: apaga o arquivo
+        if (seg->cabecalho->lidos == seg->cabecalho->escritos &&
+            (seg->cabecalho->lidos == seg->cabecalho->capacidade || seg != fila->ultimoSegmento)) {
+            fila->primeiroSegmento = seg->proximo;
+            if (fila->ultimoSegmento == seg) {
+                fila->ultimoSegmento = NULL;
+            }
+            liberarSegmento(fila, seg, true);
+        } else if (k == 0) {
+            break;
+        }
+    }
+}
+
+/**
+ * Remove o número do início da fila
+ * @param fila Ponteiro para a fila
+ * @param numero Recebe o valor removido
+ * @return true se removeu, false se a fila estava vazia
+ */
+bool sairFilaPersistente(struct filaPersistente *fila, int *numero) {
+    const int *itens;
+    if (espiarFilaPersistente(fila, &itens) == 0) {
+        return false;
+    }
+    *numero = itens[0];
+    consumirFilaPersistente(fila, 1);
+    return true;
+}
+
+/**
+ * Retorna a quantidade total de itens na fila
+ * @param fila Ponteiro para a fila
+ * @return Itens pendentes (todos estão em disco)
+ */
+size_t tamanhoFilaPersistente(const struct filaPersistente *fila) {
+    return fila->itensEmDisco;
+}
+
+/**
+ * Força a gravação dos segmentos em disco (durabilidade contra queda de energia)
+ * @param fila Ponteiro para a fila
+ */
+void sincronizarFilaPersistente(struct filaPersistente *fila) {
+    for (struct segmento *seg = fila->primeiroSegmento; seg != NULL; seg = seg->proximo) {
+        msync(seg->cabecalho, seg->bytes, MS_SYNC);
+    }
+}
+
+/**
+ * Fecha a fila: todos os itens pendentes já estão em disco
+ * @param fila Ponteiro para a fila
+ */
+void fecharFilaPersistente(struct filaPersistente *fila) {
+    sincronizarFilaPersistente(fila);
+    while (fila->primeiroSegmento != NULL) {
+        struct segmento *seg = fila->primeiroSegmento;
+        fila->primeiroSegmento = seg->proximo;
+        liberarSegmento(fila, seg, false);
+    }
+    free(fila->anel);
+    free(fila);
+}
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+int main(int argc, char *argv[]) {
+    const char *diretorio = argc > 1 ? argv[1] : "fila_dados";
+    int total = argc > 2 ? atoi(argv[2]) : 5000000;
+    struct timespec t0;
+    int numero = 0;
+    bool ordemCorreta = true;
+
+    // Produz e consome metade em um processo filho que termina sem fechar a
+    // fila, simulando uma queda do serviço
+    fflush(stdout);
+    pid_t filho = fork();
+    if (filho < 0) {
+        fprintf(stderr, "Erro ao criar processo: %s\n", strerror(errno));
+        return 1;
+    }
+    if (filho == 0) {
+        struct filaPersistente *fila = abrirFilaPersistente(diretorio, 4096);
+        printf("Itens recuperados do disco: %zu\n", tamanhoFilaPersistente(fila));
+        while (sairFilaPersistente(fila, &numero)) {
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int i = 0; i < total; i++) {
+            if (!entrarFilaPersistente(fila, i)) {
+                _exit(EXIT_FAILURE);
+            }
+        }
+        double tempoEntrada = segundosDesde(&t0);
+        printf("Inseridos %d itens em %.3f s - %.1f milhoes/s\n",
+               total, tempoEntrada, total / tempoEntrada / 1e6);
+
+        for (int i = 0; i < total / 2; i++) {
+            sairFilaPersistente(fila, &numero);
+            ordemCorreta &= numero == i;
+        }
+        fflush(stdout);
+        _exit(ordemCorreta ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    int status;
+    if (waitpid(filho, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+        fprintf(stderr, "O processo produtor falhou.\n");
+        return 1;
+    }
+
+    // Reabre e consome o restante usando leitura sem cópia
+    struct filaPersistente *fila = abrirFilaPersistente(diretorio, 4096);
+    printf("Após a queda: %zu itens pendentes\n", tamanhoFilaPersistente(fila));
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    int esperado = total / 2;
+    const int *itens;
+    size_t n;
+    while ((n = espiarFilaPersistente(fila, &itens)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            ordemCorreta &= itens[i] == esperado++;
+        }
+        consumirFilaPersistente(fila, n);
+    }
+    double tempoSaida = segundosDesde(&t0);
+    printf("Consumidos %d itens em %.3f s\n", total - total / 2, tempoSaida);
+    printf("Ordem FIFO %s\n", ordemCorreta && esperado == total ? "preservada" : "VIOLADA");
+
+    fecharFilaPersistente(fila);
+    return ordemCorreta && esperado == total ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+/**
+ * Demonstração do Filtro de Bloom na Frente das Estruturas em C
+ *
+ * Este código liga Filtro_Bloom.h a três estruturas do repositório, sem
+ * alterar a lógica delas (cada arquivo é incluído com os nomes trocados):
+ * - Matriz_Esparsa.c: filtro de contadores, porque há remoções
+ * - Arvore_AVL.c: filtro comum
+ * - Lista_Duplamente_Encadeada.c: filtro de contadores
+ *
+ * Para cada uma, mede o tempo médio de consulta sem e com o filtro, com a
+ * maioria das consultas procurando chaves ausentes, e mostra a taxa de
+ * falsos positivos medida. Na matriz, metade das chaves é removida depois,
+ * e as consultas a elas passam a ser evitadas pelo filtro.
+ *
+ *   gcc -O2 -pthread Filtro_Bloom.c -o filtro_bloom -lm
+ *   ./filtro_bloom [taxa_de_falsos_positivos]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "Filtro_Bloom.h"
+
+// Matriz_Esparsa.c
+#define main mainMatriz
+#define no noMatriz
+#define inserir inserirMatriz
+#define remover removerMatriz
+#define buscar buscarMatriz
+#define imprimir imprimirMatriz
+#include "../Matriz_Esparsa/Matriz_Esparsa.c"
+#undef main
+#undef no
+#undef inserir
+#undef remover
+#undef buscar
+#undef imprimir
+
+// Arvore_AVL.c
+#define main mainAVL
+#include "../Arvore_AVL/Arvore_AVL.c"
+#undef main
+
+// Lista_Duplamente_Encadeada.c
+#define main mainLista
+#define no noLista
+#define inserir inserirLista
+#define remover removerLista
+#define buscar buscarLista
+#define imprimir imprimirLista
+#define menu menuLista
+#include "../Lista_Encadeada/Lista_Duplamente_Encadeada.c"
+#undef main
+#undef no
+#undef inserir
+#undef remover
+#undef buscar
+#undef imprimir
+#undef menu
+
+#define PORCENTAGEM_AUSENTES 90
+
+// Funções de busca no formato de consultarComFiltro
+static bool buscarNaMatriz(void *estrutura, int chave) {
+    return buscarMatriz((struct diretor *) estrutura, chave) != NULL;
+}
+
+static bool buscarNaAVL(void *estrutura, int chave) {
+    return buscarAVL((struct NoAVL *) estrutura, chave) != NULL;
+}
+
+static bool buscarNaLista(void *estrutura, int chave) {
+    return buscarLista((struct noLista *) estrutura, chave) != NULL;
+}
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+/**
+ * Sorteia as consultas: chaves presentes são os pares 2i (i < n), ausentes
+ * são ímpares
+ */
+static int *sortearConsultas(int n, int quantidade, uint64_t semente) {
+    int *consultas = (int *) malloc((size_t) quantidade * sizeof(int));
+    if (consultas == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int q = 0; q < quantidade; q++) {
+        semente ^= semente << 13;
+        semente ^= semente >> 7;
+        semente ^= semente << 17;
+        int i = (int) ((semente >> 8) % (uint64_t) n);
+        consultas[q] = (int) ((semente >> 40) % 100) < PORCENTAGEM_AUSENTES ? 2 * i + 1 : 2 * i;
+    }
+    return consultas;
+}
+
+/**
+ * Compara as consultas sem e com o filtro e imprime o resultado
+ * @return Quantidade de consultas em que as duas formas discordaram
+ */
+static int compararConsultas(const char *nome, struct filtroBloom *f, bool (*buscarEstrutura)(void *, int),
+                             void *estrutura, const int *consultas, int quantidade) {
+    struct timespec t0;
+    bool *semFiltro = (bool *) malloc((size_t) quantidade * sizeof(bool));
+    if (semFiltro == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int q = 0; q < quantidade; q++) {
+        semFiltro[q] = buscarEstrutura(estrutura, consultas[q]);
+    }
+    double tempoSem = segundosDesde(&t0);
+
+    int divergencias = 0;
+    zerarEstatisticasBloom(f);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int q = 0; q < quantidade; q++) {
+        divergencias += consultarComFiltro(f, consultas[q], buscarEstrutura, estrutura) != semFiltro[q];
+    }
+    double tempoCom = segundosDesde(&t0);
+    free(semFiltro);
+
+    printf("[%s] consulta: %.1f ns sem filtro, %.1f ns com filtro (%.1fx)%s\n", nome,
+           tempoSem * 1e9 / quantidade, tempoCom * 1e9 / quantidade, tempoSem / tempoCom,
+           divergencias == 0 ? "" : "  (RESULTADOS DIFERENTES)");
+    imprimirEstatisticasBloom(f, nome);
+    return divergencias;
+}
+
+int main(int argc, char *argv[]) {
+    double taxa = argc > 1 ? atof(argv[1]) : 0.01;
+    printf("Taxa de falsos positivos desejada: %.3f%%, %d%% das consultas a chaves ausentes\n\n",
+           100.0 * taxa, PORCENTAGEM_AUSENTES);
+
+    // Matriz esparsa: 5 cadeias, cada falta percorre n/5 nós
+    int n = 20000, quantidade = 100000;
+    struct diretor *matriz = NULL;
+    struct filtroBloom *filtroMatriz = criarFiltroBloom((size_t) n, taxa, true);
+    for (int i = 0; i < n; i++) {
+        matriz = inserirMatriz(matriz, 2 * i);
+        adicionarBloom(filtroMatriz, 2 * i);
+    }
+    int *consultas = sortearConsultas(n, quantidade, 0x9E3779B97F4A7C15ull);
+    compararConsultas("Matriz", filtroMatriz, buscarNaMatriz, matriz, consultas, quantidade);
+
+    // Remove a primeira metade das chaves da matriz e do filtro
+    for (int i = 0; i < n / 2; i++) {
+        if (buscarMatriz(matriz, 2 * i) != NULL) {
+            removerMatriz(matriz, 2 * i);
+            removerBloom(filtroMatriz, 2 * i);
+        }
+    }
+    int removidasEvitadas = 0, restantesAchadas = 0;
+    for (int i = 0; i < n; i++) {
+        bool talvez = talvezContem(filtroMatriz, 2 * i);
+        if (i < n / 2) {
+            removidasEvitadas += !talvez;
+        } else {
+            restantesAchadas += talvez;
+        }
+    }
+    printf("[Matriz] depois de remover %d chaves: %d delas já barradas pelo filtro, %d de %d restantes aceitas\n\n",
+           n / 2, removidasEvitadas, restantesAchadas, n - n / 2);
+    free(consultas);
+    liberarMemoria(matriz);
+    liberarFiltroBloom(filtroMatriz);
+
+    // Árvore AVL: cada falta desce log2(n) níveis, com faltas de cache
+    n = 1000000;
+    quantidade = 1000000;
+    struct NoAVL *raiz = NULL;
+    struct filtroBloom *filtroAVL = criarFiltroBloom((size_t) n, taxa, false);
+    for (int i = 0; i < n; i++) {
+        // Ordem embaralhada: i * ímpar é uma permutação de [0, n) quando n é par e mdc = 1
+        int chave = 2 * (int) (((uint64_t) i * 7919u) % (uint64_t) n);
+        raiz = inserirAVL(raiz, chave);
+        adicionarBloom(filtroAVL, chave);
+    }
+    consultas = sortearConsultas(n, quantidade, 0x2545F4914F6CDD1Dull);
+    compararConsultas("AVL", filtroAVL, buscarNaAVL, raiz, consultas, quantidade);
+    printf("\n");
+    free(consultas);
+    liberarAVL(raiz);
+    liberarFiltroBloom(filtroAVL);
+
+    // Lista duplamente encadeada: cada falta percorre a lista inteira
+    n = 10000;
+    quantidade = 20000;
+    struct noLista *lista = NULL;
+    struct filtroBloom *filtroLista = criarFiltroBloom((size_t) n, taxa, true);
+    for (int i = 0; i < n; i++) {
+        lista = inserirLista(lista, 2 * i);
+        adicionarBloom(filtroLista, 2 * i);
+    }
+    consultas = sortearConsultas(n, quantidade, 0xD1B54A32D192ED03ull);
+    compararConsultas("Lista", filtroLista, buscarNaLista, lista, consultas, quantidade);
+    free(consultas);
+    while (lista != NULL) {
+        lista = removerLista(lista, lista->numero);
+    }
+    liberarFiltroBloom(filtroLista);
+    return 0;
+}
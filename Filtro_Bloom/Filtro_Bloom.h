@@ -0,0 +1,352 @@
+/**
+ * Filtro de Bloom em Blocos de Uma Linha de Cache em C
+ *
+ * A maior parte das consultas às estruturas do repositório procura chaves
+ * que não estão lá, e cada uma dessas consultas paga a busca inteira: a
+ * cadeia do resto em Matriz_Esparsa.c, a descida na Árvore AVL ou a
+ * varredura da lista. Um filtro de Bloom na frente da estrutura responde
+ * "com certeza não está" sem tocar nela:
+ * - Filtro em blocos: o hash escolhe um bloco de 64 bytes (512 bits,
+ *   alinhado à linha de cache) e todos os k bits da chave ficam nesse
+ *   bloco. Uma consulta negativa custa no máximo uma falta de cache
+ * - Variante de contadores: cada posição é um contador de 4 bits (128 por
+ *   bloco de 64 bytes), o que permite remover chaves. Um contador que chega
+ *   a 15 fica saturado para sempre, para nunca gerar falso negativo
+ * - O tamanho e k saem de um modelo do filtro em blocos (chaves por bloco
+ *   seguem Poisson), não da fórmula clássica: com as mesmas fórmulas, os
+ *   blocos deixariam a taxa real acima do alvo, até 2,5x na variante de
+ *   contadores. O filtro fica de 4% a 15% maior que o clássico, e a taxa
+ *   alvo passa a ser a esperada (cada filtro varia alguns % em torno dela)
+ * - consultarComFiltro liga o filtro a qualquer estrutura por meio de uma
+ *   função de busca, e conta os falsos positivos de verdade: consultas em
+ *   que o filtro disse "talvez" e a estrutura não tinha a chave
+ *
+ * Uso:
+ *   struct filtroBloom *f = criarFiltroBloom(elementos, 0.01, false);
+ *   adicionarBloom(f, chave);                  // junto com cada inserção
+ *   bool achou = consultarComFiltro(f, chave, buscarNaEstrutura, estrutura);
+ *   imprimirEstatisticasBloom(f, "AVL");
+ *
+ * Todas as funções são static inline: o arquivo é incluído por cada programa.
+ */
+
+#ifndef FILTRO_BLOOM_H
+#define FILTRO_BLOOM_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#define BYTES_BLOCO_BLOOM 64                // Uma linha de cache
+#define BITS_BLOCO_BLOOM 512                // Posições por bloco no filtro comum
+#define CONTADORES_BLOCO_BLOOM 128          // Posições por bloco na variante de contadores
+#define MAXIMO_CONTADOR_BLOOM 15
+#define MAXIMO_FUNCOES_BLOOM 16
+#define BITS_POSICAO_BLOOM 9                // log2(BITS_BLOCO_BLOOM)
+#define BITS_POSICAO_CONTADOR_BLOOM 7       // log2(CONTADORES_BLOCO_BLOOM)
+
+// Filtro de Bloom em blocos
+struct filtroBloom {
+    uint8_t *blocos;            // quantidadeBlocos * 64 bytes, alinhado a 64
+    size_t quantidadeBlocos;
+    int funcoes;                // k: posições marcadas por chave
+    bool contadores;            // true = variante de contadores de 4 bits
+    size_t elementos;           // Chaves adicionadas menos removidas
+    unsigned long negativos;    // Consultas respondidas só pelo filtro
+    unsigned long positivos;    // Consultas em que o filtro disse "talvez" e a chave estava lá
+    unsigned long falsosPositivos;
+};
+
+/**
+ * Mistura de 64 bits (finalizador do MurmurHash3)
+ */
+static inline uint64_t misturarBloom(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * Taxa de falsos positivos de um filtro em blocos
+ * As chaves de um bloco seguem Poisson com média chavesPorBloco. Com j
+ * chaves no bloco (jk posições sorteadas), a chance de as d posições
+ * distintas de uma consulta estarem todas marcadas é, por
+ * inclusão-exclusão, a soma de (-1)^i C(d, i) (1 - i/s)^(jk). A fórmula
+ * clássica, (1 - (1 - 1/s)^(jk))^k, subestima a taxa com blocos pequenos.
+ * @param chavesPorBloco Média de chaves por bloco (n / blocos)
+ * @param posicoes Posições por bloco (s)
+ * @param funcoes Posições marcadas por chave (k)
+ * @return Probabilidade de uma chave ausente passar pelo filtro
+ */
+static inline double taxaFalsosBlocos(double chavesPorBloco, int posicoes, int funcoes) {
+    if (chavesPorBloco <= 0.0) {
+        return 0.0;
+    }
+
+    // Distribuição do número de posições distintas entre as k da consulta
+    double distintas[MAXIMO_FUNCOES_BLOOM + 1] = {1.0};
+    for (int sorteio = 0; sorteio < funcoes; sorteio++) {
+        for (int d = sorteio + 1; d >= 1; d--) {
+            distintas[d] = distintas[d] * d / posicoes + distintas[d - 1] * (posicoes - d + 1) / posicoes;
+        }
+        distintas[0] = 0.0;
+    }
+    double logLivres[MAXIMO_FUNCOES_BLOOM + 1];  // ln(1 - i/s)
+    for (int i = 0; i <= funcoes; i++) {
+        logLivres[i] = log(1.0 - (double) i / posicoes);
+    }
+
+    double desvio = sqrt(chavesPorBloco);
+    long primeiro = (long) floor(chavesPorBloco - 12.0 * desvio - 12.0);
+    long ultimo = (long) ceil(chavesPorBloco + 12.0 * desvio + 12.0);
+    double taxa = 0.0;
+    for (long j = primeiro < 0 ? 0 : primeiro; j <= ultimo; j++) {
+        double livres[MAXIMO_FUNCOES_BLOOM + 1];  // (1 - i/s)^(jk)
+        for (int i = 0; i <= funcoes; i++) {
+            livres[i] = exp((double) j * funcoes * logLivres[i]);
+        }
+        double todas = 0.0;
+        for (int d = 1; d <= funcoes; d++) {
+            double soma = 0.0, combinacoes = 1.0;
+            for (int i = 0; i <= d; i++) {
+                soma += (i & 1 ? -combinacoes : combinacoes) * livres[i];
+                combinacoes = combinacoes * (d - i) / (i + 1);
+            }
+            todas += distintas[d] * soma;
+        }
+        double probabilidade = exp((double) j * log(chavesPorBloco) - chavesPorBloco - lgamma((double) j + 1.0));
+        taxa += probabilidade * todas;
+    }
+    return taxa;
+}
+
+/**
+ * Cria um filtro dimensionado para uma quantidade de chaves
+ * Parte do tamanho do filtro clássico (m = -n ln p / ln² 2) e acrescenta
+ * blocos, 1% por vez, até que algum k atinja a taxa pedida pelo modelo em
+ * blocos (taxaFalsosBlocos); fica com o menor k que a atinge. A taxa cai
+ * e depois sobe com k, então a procura por k para quando ela volta a subir.
+ * @param elementosEsperados Quantidade de chaves prevista
+ * @param taxaFalsos Taxa de falsos positivos desejada (ex.: 0.01)
+ * @param contadores true para a variante que aceita remoção
+ * @return Filtro criado
+ */
+static inline struct filtroBloom *criarFiltroBloom(size_t elementosEsperados, double taxaFalsos, bool contadores) {
+    struct filtroBloom *f = (struct filtroBloom *) calloc(1, sizeof(struct filtroBloom));
+    if (f == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (elementosEsperados == 0) {
+        elementosEsperados = 1;
+    }
+    if (taxaFalsos <= 0.0 || taxaFalsos >= 1.0) {
+        taxaFalsos = 0.01;
+    }
+    double posicoes = -(double) elementosEsperados * log(taxaFalsos) / (log(2.0) * log(2.0));
+    int porBloco = contadores ? CONTADORES_BLOCO_BLOOM : BITS_BLOCO_BLOOM;
+    f->quantidadeBlocos = (size_t) ceil(posicoes / porBloco);
+    if (f->quantidadeBlocos == 0) {
+        f->quantidadeBlocos = 1;
+    }
+    for (f->funcoes = 0; f->funcoes == 0;) {
+        double chavesPorBloco = (double) elementosEsperados / (double) f->quantidadeBlocos;
+        double anterior = 1.0;
+        for (int k = 1; k <= MAXIMO_FUNCOES_BLOOM; k++) {
+            double taxa = taxaFalsosBlocos(chavesPorBloco, porBloco, k);
+            if (taxa <= taxaFalsos) {
+                f->funcoes = k;
+                break;
+            }
+            if (taxa > anterior) {
+                break;
+            }
+            anterior = taxa;
+        }
+        if (f->funcoes == 0) {
+            f->quantidadeBlocos += (f->quantidadeBlocos + 99) / 100;
+        }
+    }
+    f->contadores = contadores;
+    f->blocos = (uint8_t *) aligned_alloc(BYTES_BLOCO_BLOOM, f->quantidadeBlocos * BYTES_BLOCO_BLOOM);
+    if (f->blocos == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(f->blocos, 0, f->quantidadeBlocos * BYTES_BLOCO_BLOOM);
+    return f;
+}
+
+/**
+ * Bloco da chave e a semente das posições dentro dele
+ * Os 32 bits altos do hash escolhem o bloco (multiplicação em vez de
+ * resto); um segundo hash fornece as posições (ver posicaoBloom).
+ */
+static inline uint8_t *blocoBloom(const struct filtroBloom *f, int chave, uint64_t *semente) {
+    uint64_t h = misturarBloom((uint64_t) (uint32_t) chave);
+    *semente = misturarBloom(h ^ 0x9E3779B97F4A7C15ull);
+    return f->blocos + (size_t) (((h >> 32) * (uint64_t) f->quantidadeBlocos) >> 32) * BYTES_BLOCO_BLOOM;
+}
+
+/**
+ * i-ésima posição da chave dentro do bloco
+ * Cada posição usa bits próprios da semente, que é misturada de novo
+ * quando os 64 bits acabam. O hashing duplo (a + i*b) gera só 128 * 64
+ * combinações num bloco de 128 contadores, e chaves inteiras colidem.
+ * @param semente Semente de blocoBloom, atualizada aqui
+ * @param i Índice da posição (chamadas em ordem, a partir de 0)
+ * @param bits Bits por posição (log2 das posições do bloco)
+ */
+static inline uint32_t posicaoBloom(uint64_t *semente, int i, int bits) {
+    int porPalavra = 64 / bits;
+    int deslocamento = i % porPalavra;
+    if (deslocamento == 0 && i > 0) {
+        *semente = misturarBloom(*semente + 0x9E3779B97F4A7C15ull);
+    }
+    return (uint32_t) (*semente >> (deslocamento * bits)) & ((1u << bits) - 1);
+}
+
+/**
+ * Adiciona uma chave ao filtro
+ */
+static inline void adicionarBloom(struct filtroBloom *f, int chave) {
+    uint64_t semente;
+    uint8_t *bloco = blocoBloom(f, chave, &semente);
+    for (int i = 0; i < f->funcoes; i++) {
+        if (f->contadores) {
+            uint32_t posicao = posicaoBloom(&semente, i, BITS_POSICAO_CONTADOR_BLOOM);
+            int deslocamento = (posicao & 1) * 4;
+            int contador = (bloco[posicao >> 1] >> deslocamento) & 0xF;
+            if (contador < MAXIMO_CONTADOR_BLOOM) {
+                bloco[posicao >> 1] += (uint8_t) (1 << deslocamento);
+            }
+        } else {
+            uint32_t posicao = posicaoBloom(&semente, i, BITS_POSICAO_BLOOM);
+            bloco[posicao >> 3] |= (uint8_t) (1 << (posicao & 7));
+        }
+    }
+    f->elementos++;
+}
+
+/**
+ * Verifica se a chave pode estar no conjunto
+ * @return false = com certeza ausente; true = talvez presente
+ */
+static inline bool talvezContem(const struct filtroBloom *f, int chave) {
+    uint64_t semente;
+    const uint8_t *bloco = blocoBloom(f, chave, &semente);
+    for (int i = 0; i < f->funcoes; i++) {
+        if (f->contadores) {
+            uint32_t posicao = posicaoBloom(&semente, i, BITS_POSICAO_CONTADOR_BLOOM);
+            if (((bloco[posicao >> 1] >> ((posicao & 1) * 4)) & 0xF) == 0) {
+                return false;
+            }
+        } else {
+            uint32_t posicao = posicaoBloom(&semente, i, BITS_POSICAO_BLOOM);
+            if ((bloco[posicao >> 3] & (1 << (posicao & 7))) == 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Remove uma chave (só na variante de contadores)
+ * Deve ser chamada apenas para chaves que de fato estavam na estrutura;
+ * contadores saturados não são decrementados.
+ * @return false se o filtro não tem contadores
+ */
+static inline bool removerBloom(struct filtroBloom *f, int chave) {
+    if (!f->contadores) {
+        return false;
+    }
+    uint64_t semente;
+    uint8_t *bloco = blocoBloom(f, chave, &semente);
+    for (int i = 0; i < f->funcoes; i++) {
+        uint32_t posicao = posicaoBloom(&semente, i, BITS_POSICAO_CONTADOR_BLOOM);
+        int deslocamento = (posicao & 1) * 4;
+        int contador = (bloco[posicao >> 1] >> deslocamento) & 0xF;
+        if (contador > 0 && contador < MAXIMO_CONTADOR_BLOOM) {
+            bloco[posicao >> 1] -= (uint8_t) (1 << deslocamento);
+        }
+    }
+    f->elementos--;
+    return true;
+}
+
+/**
+ * Consulta uma estrutura passando antes pelo filtro
+ * @param f Filtro com as chaves da estrutura
+ * @param chave Chave procurada
+ * @param buscar Busca na estrutura; true se a chave está lá
+ * @param estrutura Repassada à função de busca
+ * @return true se a chave está na estrutura
+ */
+static inline bool consultarComFiltro(struct filtroBloom *f, int chave, bool (*buscar)(void *, int), void *estrutura) {
+    if (!talvezContem(f, chave)) {
+        f->negativos++;
+        return false;
+    }
+    if (buscar(estrutura, chave)) {
+        f->positivos++;
+        return true;
+    }
+    f->falsosPositivos++;
+    return false;
+}
+
+/**
+ * Taxa de falsos positivos medida: entre as consultas a chaves ausentes,
+ * a fração em que o filtro não evitou a busca
+ */
+static inline double taxaFalsosMedida(const struct filtroBloom *f) {
+    unsigned long ausentes = f->negativos + f->falsosPositivos;
+    return ausentes > 0 ? (double) f->falsosPositivos / (double) ausentes : 0.0;
+}
+
+/**
+ * Taxa de falsos positivos esperada pelo modelo em blocos com a ocupação
+ * atual (taxaFalsosBlocos)
+ */
+static inline double taxaFalsosTeorica(const struct filtroBloom *f) {
+    return taxaFalsosBlocos((double) f->elementos / (double) f->quantidadeBlocos,
+                            f->contadores ? CONTADORES_BLOCO_BLOOM : BITS_BLOCO_BLOOM, f->funcoes);
+}
+
+/**
+ * Imprime tamanho e taxas do filtro
+ */
+static inline void imprimirEstatisticasBloom(const struct filtroBloom *f, const char *nome) {
+    printf("[%s] %zu chaves, %zu blocos (%.1f KB), k = %d%s\n", nome, f->elementos, f->quantidadeBlocos,
+           (double) f->quantidadeBlocos * BYTES_BLOCO_BLOOM / 1024.0, f->funcoes, f->contadores ? ", contadores de 4 bits" : "");
+    printf("[%s] consultas: %lu evitadas, %lu encontradas, %lu falsos positivos\n", nome, f->negativos, f->positivos,
+           f->falsosPositivos);
+    printf("[%s] falsos positivos: %.3f%% medidos, %.3f%% pelo modelo em blocos\n", nome, 100.0 * taxaFalsosMedida(f),
+           100.0 * taxaFalsosTeorica(f));
+}
+
+/**
+ * Zera os contadores de consultas (mantém as chaves)
+ */
+static inline void zerarEstatisticasBloom(struct filtroBloom *f) {
+    f->negativos = 0;
+    f->positivos = 0;
+    f->falsosPositivos = 0;
+}
+
+/**
+ * Libera o filtro
+ */
+static inline void liberarFiltroBloom(struct filtroBloom *f) {
+    free(f->blocos);
+    free(f);
+}
+
+#endif
@@ -0,0 +1,182 @@
+/**
+ * Árvore AVL Genérica Especializada na Compilação em C
+ *
+ * Arvore_AVL.c só guarda int. Em vez de trocar o int por void* (um ponteiro
+ * a mais por nó e uma chamada indireta por comparação), a macro DEFINIR_AVL
+ * gera uma árvore inteira para o tipo pedido:
+ * - O elemento fica dentro do nó, como o int no original: com int, o nó tem
+ *   os mesmos 24 bytes de struct NoAVL
+ * - A comparação é uma função static inline chamada pelo nome no código
+ *   gerado, então o compilador a expande em cada descida
+ * - Mapas: use como elemento uma struct com chave e valor e um comparador
+ *   que olha só a chave. Inserir um elemento que já existe substitui o
+ *   guardado, o que atualiza o valor
+ *
+ * DEFINIR_AVL(nome, Tipo, comparar) gera:
+ *   struct nomeNo                                    Nó (elemento, altura, filhos)
+ *   struct nomeNo *nomeInserir(raiz, Tipo elemento)  Insere ou substitui
+ *   struct nomeNo *nomeBuscar(raiz, const Tipo *)    Nó com a chave ou NULL
+ *   struct nomeNo *nomeRemover(raiz, const Tipo *)   Remove, se existir
+ *   void nomeEmOrdem(raiz, visitar, contexto)        Percorre em ordem
+ *   void nomeLiberar(raiz)                           Libera todos os nós
+ * comparar(const Tipo *a, const Tipo *b) devolve < 0, 0 ou > 0.
+ *
+ * Uso:
+ *   DEFINIR_AVL(arvoreIds, uint64_t, compararU64)
+ *   struct arvoreIdsNo *raiz = NULL;
+ *   raiz = arvoreIdsInserir(raiz, 123456789012ull);
+ *   if (arvoreIdsBuscar(raiz, &(uint64_t) {123456789012ull})) ...
+ */
+
+#ifndef ARVORE_AVL_GENERICA_H
+#define ARVORE_AVL_GENERICA_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DEFINIR_AVL(nome, Tipo, comparar)                                                          \
+                                                                                                   \
+/* "const Tipo *" com Tipo = const char * viraria const char **; o typedef evita isso */           \
+typedef Tipo nome##Elemento;                                                                       \
+                                                                                                   \
+struct nome##No {                                                                                  \
+    Tipo elemento;                                                                                 \
+    int altura;                                                                                    \
+    struct nome##No *esquerda;                                                                     \
+    struct nome##No *direita;                                                                      \
+};                                                                                                 \
+                                                                                                   \
+static inline int nome##Altura(const struct nome##No *n) {                                         \
+    return n ? n->altura : 0;                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline void nome##AtualizarAltura(struct nome##No *n) {                                     \
+    int e = nome##Altura(n->esquerda), d = nome##Altura(n->direita);                               \
+    n->altura = 1 + (e > d ? e : d);                                                               \
+}                                                                                                  \
+                                                                                                   \
+static inline int nome##Fator(const struct nome##No *n) {                                          \
+    return n ? nome##Altura(n->esquerda) - nome##Altura(n->direita) : 0;                           \
+}                                                                                                  \
+                                                                                                   \
+static inline struct nome##No *nome##RotacaoDireita(struct nome##No *y) {                          \
+    struct nome##No *x = y->esquerda;                                                              \
+    y->esquerda = x->direita;                                                                      \
+    x->direita = y;                                                                                \
+    nome##AtualizarAltura(y);                                                                      \
+    nome##AtualizarAltura(x);                                                                      \
+    return x;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline struct nome##No *nome##RotacaoEsquerda(struct nome##No *x) {                         \
+    struct nome##No *y = x->direita;                                                               \
+    x->direita = y->esquerda;                                                                      \
+    y->esquerda = x;                                                                               \
+    nome##AtualizarAltura(x);                                                                      \
+    nome##AtualizarAltura(y);                                                                      \
+    return y;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline struct nome##No *nome##Inserir(struct nome##No *no, Tipo elemento) {                 \
+    if (!no) {                                                                                     \
+        struct nome##No *novoNo = (struct nome##No *) malloc(sizeof(struct nome##No));             \
+        if (!novoNo) {                                                                             \
+            fprintf(stderr, "Erro na alocação de memória.\n");                                     \
+            exit(EXIT_FAILURE);                                                                    \
+        }                                                                                          \
+        novoNo->elemento = elemento;                                                               \
+        novoNo->esquerda = novoNo->direita = NULL;                                                 \
+        novoNo->altura = 1;                                                                        \
+        return novoNo;                                                                             \
+    }                                                                                              \
+                                                                                                   \
+    int c = comparar(&elemento, &no->elemento);                                                    \
+    if (c < 0) {                                                                                   \
+        no->esquerda = nome##Inserir(no->esquerda, elemento);                                      \
+    } else if (c > 0) {                                                                            \
+        no->direita = nome##Inserir(no->direita, elemento);                                        \
+    } else {                                                                                       \
+        no->elemento = elemento;    /* Já existe: substitui (atualiza o valor) */                  \
+        return no;                                                                                 \
+    }                                                                                              \
+                                                                                                   \
+    nome##AtualizarAltura(no);                                                                     \
+    int balance = nome##Fator(no);                                                                 \
+                                                                                                   \
+    if (balance > 1) {                                                                             \
+        if (comparar(&elemento, &no->esquerda->elemento) > 0)                                      \
+            no->esquerda = nome##RotacaoEsquerda(no->esquerda);                                    \
+        return nome##RotacaoDireita(no);                                                           \
+    }                                                                                              \
+    if (balance < -1) {                                                                            \
+        if (comparar(&elemento, &no->direita->elemento) < 0)                                       \
+            no->direita = nome##RotacaoDireita(no->direita);                                       \
+        return nome##RotacaoEsquerda(no);                                                          \
+    }                                                                                              \
+    return no;                                                                                     \
+}                                                                                                  \
+                                                                                                   \
+static inline struct nome##No *nome##Buscar(struct nome##No *no, const nome##Elemento *chave) {    \
+    int c;                                                                                         \
+    /* Mesma forma de buscarAVL: a escolha do filho vira cmov, sem desvio a errar */               \
+    while (no && (c = comparar(chave, &no->elemento)) != 0)                                        \
+        no = c < 0 ? no->esquerda : no->direita;                                                   \
+    return no;                                                                                     \
+}                                                                                                  \
+                                                                                                   \
+static inline struct nome##No *nome##Remover(struct nome##No *no, const nome##Elemento *chave) {   \
+    if (!no)                                                                                       \
+        return NULL;                                                                               \
+                                                                                                   \
+    int c = comparar(chave, &no->elemento);                                                        \
+    if (c < 0) {                                                                                   \
+        no->esquerda = nome##Remover(no->esquerda, chave);                                         \
+    } else if (c > 0) {                                                                            \
+        no->direita = nome##Remover(no->direita, chave);                                           \
+    } else if (!no->esquerda || !no->direita) {                                                    \
+        struct nome##No *filho = no->esquerda ? no->esquerda : no->direita;                        \
+        free(no);                                                                                  \
+        return filho;                                                                              \
+    } else {                                                                                       \
+        /* Dois filhos: copia o sucessor e o remove da subárvore direita */                        \
+        struct nome##No *sucessor = no->direita;                                                   \
+        while (sucessor->esquerda)                                                                 \
+            sucessor = sucessor->esquerda;                                                         \
+        no->elemento = sucessor->elemento;                                                         \
+        no->direita = nome##Remover(no->direita, &no->elemento);                                   \
+    }                                                                                              \
+                                                                                                   \
+    nome##AtualizarAltura(no);                                                                     \
+    int balance = nome##Fator(no);                                                                 \
+                                                                                                   \
+    if (balance > 1) {                                                                             \
+        if (nome##Fator(no->esquerda) < 0)                                                         \
+            no->esquerda = nome##RotacaoEsquerda(no->esquerda);                                    \
+        return nome##RotacaoDireita(no);                                                           \
+    }                                                                                              \
+    if (balance < -1) {                                                                            \
+        if (nome##Fator(no->direita) > 0)                                                          \
+            no->direita = nome##RotacaoDireita(no->direita);                                       \
+        return nome##RotacaoEsquerda(no);                                                          \
+    }                                                                                              \
+    return no;                                                                                     \
+}                                                                                                  \
+                                                                                                   \
+static inline void nome##EmOrdem(const struct nome##No *no,                                        \
+                                 void (*visitar)(const nome##Elemento *, void *), void *contexto) { \
+    if (!no)                                                                                       \
+        return;                                                                                    \
+    nome##EmOrdem(no->esquerda, visitar, contexto);                                                \
+    visitar(&no->elemento, contexto);                                                              \
+    nome##EmOrdem(no->direita, visitar, contexto);                                                 \
+}                                                                                                  \
+                                                                                                   \
+static inline void nome##Liberar(struct nome##No *no) {                                            \
+    if (!no)                                                                                       \
+        return;                                                                                    \
+    nome##Liberar(no->esquerda);                                                                   \
+    nome##Liberar(no->direita);                                                                    \
+    free(no);                                                                                      \
+}
+
+#endif
@@ -0,0 +1,153 @@
+/**
+ * Chave de Texto Curta com Prefixo em Linha em C
+ *
+ * Uma chave de texto comum é um char* para outro lugar da memória: cada
+ * comparação segue o ponteiro, mesmo quando as duas chaves diferem já no
+ * primeiro caractere. A chaveCurta tem 16 bytes e cabe no próprio nó ou na
+ * própria posição da tabela:
+ * - tamanho (4 bytes) e os 4 primeiros caracteres (prefixo) sempre em linha:
+ *   igualdade compara os dois de uma vez como um inteiro de 64 bits, e a
+ *   ordem compara o prefixo como inteiro big-endian
+ * - Textos de até 12 caracteres ficam inteiros em linha (prefixo + 8 bytes)
+ *   e nunca seguem ponteiro
+ * - Textos maiores guardam, no lugar dos 8 bytes, um ponteiro para o texto
+ *   completo, que só é seguido quando tamanho e prefixo empatam
+ *
+ * A chave não é dona do texto longo: ele precisa continuar válido enquanto
+ * a chave estiver em uso (como um string_view).
+ *
+ * Uso:
+ *   struct chaveCurta nome = criarChaveCurta("Ana");
+ *   DEFINIR_AVL(arvoreNomes, struct chaveCurta, compararChaveCurta)
+ *   printf("%.*s", (int) nome.tamanho, textoChaveCurta(&nome));
+ */
+
+#ifndef CHAVE_CURTA_H
+#define CHAVE_CURTA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "Tipos_Basicos.h"
+
+#define CHAVE_CURTA_EM_LINHA 12     // Maior texto guardado inteiro na chave
+
+// Texto curto em linha ou prefixo + ponteiro para o texto longo
+struct chaveCurta {
+    uint32_t tamanho;
+    char prefixo[4];
+    union {
+        char resto[8];              // Caracteres 4 a 11 (texto de até 12)
+        const char *texto;          // Texto completo (mais de 12)
+    };
+};
+
+/**
+ * Cria uma chave a partir de um texto com tamanho conhecido
+ * @param texto Caracteres da chave (não precisa terminar em '\0')
+ * @param tamanho Quantidade de caracteres
+ * @return Chave criada
+ */
+static inline struct chaveCurta criarChaveCurtaN(const char *texto, size_t tamanho) {
+    struct chaveCurta c;
+    memset(&c, 0, sizeof(c));
+    c.tamanho = (uint32_t) tamanho;
+    memcpy(c.prefixo, texto, tamanho < 4 ? tamanho : 4);
+    if (tamanho <= CHAVE_CURTA_EM_LINHA) {
+        if (tamanho > 4) {
+            memcpy(c.resto, texto + 4, tamanho - 4);
+        }
+    } else {
+        c.texto = texto;
+    }
+    return c;
+}
+
+/**
+ * Cria uma chave a partir de um texto terminado em '\0'
+ */
+static inline struct chaveCurta criarChaveCurta(const char *texto) {
+    return criarChaveCurtaN(texto, strlen(texto));
+}
+
+/**
+ * Caracteres da chave (sem '\0' no fim: use junto com c->tamanho)
+ */
+static inline const char *textoChaveCurta(const struct chaveCurta *c) {
+    if (c->tamanho <= CHAVE_CURTA_EM_LINHA) {
+        return (const char *) c + offsetof(struct chaveCurta, prefixo);
+    }
+    return c->texto;
+}
+
+/**
+ * Verifica se duas chaves são iguais
+ * Tamanho e prefixo são comparados juntos; só textos longos com o mesmo
+ * começo chegam a seguir o ponteiro.
+ */
+static inline bool igualChaveCurta(const struct chaveCurta *a, const struct chaveCurta *b) {
+    uint64_t cabecaA, cabecaB, restoA, restoB;
+    memcpy(&cabecaA, a, 8);
+    memcpy(&cabecaB, b, 8);
+    if (cabecaA != cabecaB) {
+        return false;
+    }
+    memcpy(&restoA, a->resto, 8);
+    memcpy(&restoB, b->resto, 8);
+    if (a->tamanho <= CHAVE_CURTA_EM_LINHA || restoA == restoB) {
+        return restoA == restoB;    // Em linha, ou o mesmo ponteiro
+    }
+    return memcmp(a->texto + 4, b->texto + 4, a->tamanho - 4) == 0;
+}
+
+/**
+ * Compara duas chaves na ordem lexicográfica (como strcmp)
+ * @return < 0, 0 ou > 0
+ */
+static inline int compararChaveCurta(const struct chaveCurta *a, const struct chaveCurta *b) {
+    uint32_t prefixoA, prefixoB;
+    memcpy(&prefixoA, a->prefixo, 4);
+    memcpy(&prefixoB, b->prefixo, 4);
+    if (prefixoA != prefixoB) {
+        // Em big-endian, a ordem dos inteiros é a ordem dos caracteres
+        prefixoA = __builtin_bswap32(prefixoA);
+        prefixoB = __builtin_bswap32(prefixoB);
+        return prefixoA < prefixoB ? -1 : 1;
+    }
+    uint32_t menor = a->tamanho < b->tamanho ? a->tamanho : b->tamanho;
+    if (menor > 4) {
+        int r = memcmp(textoChaveCurta(a) + 4, textoChaveCurta(b) + 4, menor - 4);
+        if (r != 0) {
+            return r;
+        }
+    }
+    return (a->tamanho > b->tamanho) - (a->tamanho < b->tamanho);
+}
+
+/**
+ * Hash de 64 bits do texto da chave
+ * Textos em linha são lidos direto da chave, em duas palavras de 64 bits.
+ */
+static inline uint64_t hashChaveCurta(const struct chaveCurta *c) {
+    uint64_t h;
+    if (c->tamanho <= CHAVE_CURTA_EM_LINHA) {
+        uint64_t cabeca, resto;
+        memcpy(&cabeca, c, 8);
+        memcpy(&resto, c->resto, 8);
+        return misturarGenerico(cabeca ^ misturarGenerico(resto));
+    }
+    const char *texto = c->texto;
+    h = c->tamanho;
+    size_t i = 0;
+    for (; i + 8 <= c->tamanho; i += 8) {
+        uint64_t palavra;
+        memcpy(&palavra, texto + i, 8);
+        h = misturarGenerico(h ^ palavra);
+    }
+    uint64_t ultima = 0;
+    memcpy(&ultima, texto + i, c->tamanho - i);
+    return misturarGenerico(h ^ ultima ^ 0x9E3779B97F4A7C15ull);
+}
+
+#endif
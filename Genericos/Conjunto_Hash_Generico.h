@@ -0,0 +1,300 @@
+/**
+ * Conjunto Hash Genérico (Swiss Table) Especializado na Compilação em C
+ *
+ * O conjunto de Matriz_Esparsa/Conjunto_Hash.c (bytes de controle lidos em
+ * grupos de 16 com SSE2, sondagem quadrática por grupos, redimensionamento
+ * incremental) gerado pela macro DEFINIR_CONJUNTO para qualquer tipo:
+ * - Os elementos ficam no vetor da tabela, sem ponteiro por elemento
+ * - hash e igual são funções static inline chamadas pelo nome no código
+ *   gerado; com int e hashInt o código é o mesmo de Conjunto_Hash.c
+ * - Mapas: use como elemento uma struct com chave e valor e funções que
+ *   olham só a chave; nomeBuscar devolve o elemento guardado, cujo valor
+ *   pode ser alterado no lugar (a chave não)
+ *
+ * DEFINIR_CONJUNTO(nome, Tipo, hash, igual) gera:
+ *   struct nome *nomeCriar(capacidade, fatorCarga)   Conjunto vazio
+ *   Tipo *nomeBuscar(c, const Tipo *chave)           Elemento guardado ou NULL
+ *   bool nomeContem(c, const Tipo *chave)
+ *   bool nomeInserir(c, Tipo elemento)               false se a chave já existe
+ *   bool nomeRemover(c, const Tipo *chave)           false se a chave não existe
+ *   void nomeParaCada(c, visitar, contexto)          Visita todos os elementos
+ *   void nomeLiberar(c)
+ * hash(const Tipo *) devolve 64 bits; igual(const Tipo *, const Tipo *).
+ * O campo tamanho de struct nome tem a quantidade de elementos.
+ *
+ * Uso:
+ *   DEFINIR_CONJUNTO(conjuntoIds, uint64_t, hashU64, igualU64)
+ *   struct conjuntoIds *c = conjuntoIdsCriar(0, 0.875);
+ *   conjuntoIdsInserir(c, 123456789012ull);
+ */
+
+#ifndef CONJUNTO_HASH_GENERICO_H
+#define CONJUNTO_HASH_GENERICO_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define GRUPO_GENERICO 16
+#define GRUPOS_POR_PASSO_GENERICO 2     // Grupos migrados a cada inserção ou remoção
+
+#define CONTROLE_VAZIO_GENERICO 0x00
+#define CONTROLE_APAGADO_GENERICO 0x01
+#define CONTROLE_OCUPADO_GENERICO 0x80  // Ocupado: 0x80 | 7 bits do hash
+
+/**
+ * Máscara das posições do grupo cujo controle é igual a valor
+ */
+static inline uint32_t compararGrupoGenerico(const uint8_t *grupo, uint8_t valor) {
+#ifdef __SSE2__
+    __m128i controles = _mm_loadu_si128((const __m128i *) grupo);
+    return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(controles, _mm_set1_epi8((char) valor)));
+#else
+    uint32_t mascara = 0;
+    for (int i = 0; i < GRUPO_GENERICO; i++) {
+        mascara |= (uint32_t) (grupo[i] == valor) << i;
+    }
+    return mascara;
+#endif
+}
+
+/**
+ * Máscara das posições livres do grupo (vazias ou apagadas: bit alto 0)
+ */
+static inline uint32_t livresGrupoGenerico(const uint8_t *grupo) {
+#ifdef __SSE2__
+    __m128i controles = _mm_loadu_si128((const __m128i *) grupo);
+    return (uint32_t) _mm_movemask_epi8(controles) ^ 0xFFFFu;
+#else
+    uint32_t mascara = 0;
+    for (int i = 0; i < GRUPO_GENERICO; i++) {
+        mascara |= (uint32_t) (grupo[i] < CONTROLE_OCUPADO_GENERICO) << i;
+    }
+    return mascara;
+#endif
+}
+
+#define DEFINIR_CONJUNTO(nome, Tipo, hash, igual)                                                  \
+                                                                                                   \
+/* Com Tipo ponteiro, const nome##Elemento * é o ponteiro constante certo */                       \
+typedef Tipo nome##Elemento;                                                                       \
+                                                                                                   \
+struct nome##Tabela {                                                                              \
+    uint8_t *controle;                                                                             \
+    Tipo *elementos;                                                                               \
+    size_t capacidade;                                                                             \
+    size_t ocupados;                                                                               \
+    size_t apagados;                                                                               \
+};                                                                                                 \
+                                                                                                   \
+struct nome {                                                                                      \
+    struct nome##Tabela atual;                                                                     \
+    struct nome##Tabela antiga;                                                                    \
+    bool migrando;                                                                                 \
+    size_t cursorMigracao;                                                                         \
+    double fatorCarga;                                                                             \
+    size_t tamanho;                                                                                \
+};                                                                                                 \
+                                                                                                   \
+static inline struct nome##Tabela nome##CriarTabela(size_t capacidade) {                           \
+    struct nome##Tabela t;                                                                         \
+    t.capacidade = capacidade;                                                                     \
+    t.ocupados = 0;                                                                                \
+    t.apagados = 0;                                                                                \
+    t.controle = (uint8_t *) calloc(capacidade, 1);                                                \
+    t.elementos = (Tipo *) malloc(capacidade * sizeof(Tipo));                                      \
+    if (t.controle == NULL || t.elementos == NULL) {                                               \
+        fprintf(stderr, "Erro na alocação de memória.\n");                                         \
+        exit(EXIT_FAILURE);                                                                        \
+    }                                                                                              \
+    return t;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline void nome##LiberarTabela(struct nome##Tabela *t) {                                   \
+    free(t->controle);                                                                             \
+    free(t->elementos);                                                                            \
+    memset(t, 0, sizeof(*t));                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline long nome##Procurar(const struct nome##Tabela *t, const nome##Elemento *chave,       \
+                                  uint64_t h) {                                                    \
+    if (t->capacidade == 0) {                                                                      \
+        return -1;                                                                                 \
+    }                                                                                              \
+    size_t mascaraGrupos = t->capacidade / GRUPO_GENERICO - 1;                                     \
+    size_t grupo = (h >> 7) & mascaraGrupos;                                                       \
+    uint8_t marca = (uint8_t) (CONTROLE_OCUPADO_GENERICO | (h & 0x7F));                            \
+    for (size_t passo = 1;; passo++) {                                                             \
+        const uint8_t *controles = t->controle + grupo * GRUPO_GENERICO;                           \
+        uint32_t candidatos = compararGrupoGenerico(controles, marca);                             \
+        while (candidatos != 0) {                                                                  \
+            size_t posicao = grupo * GRUPO_GENERICO + (size_t) __builtin_ctz(candidatos);          \
+            if (igual(&t->elementos[posicao], chave)) {                                            \
+                return (long) posicao;                                                             \
+            }                                                                                      \
+            candidatos &= candidatos - 1;                                                          \
+        }                                                                                          \
+        if (compararGrupoGenerico(controles, CONTROLE_VAZIO_GENERICO) != 0 ||                      \
+            passo > mascaraGrupos) {                                                               \
+            return -1;                                                                             \
+        }                                                                                          \
+        grupo = (grupo + passo) & mascaraGrupos;                                                   \
+    }                                                                                              \
+}                                                                                                  \
+                                                                                                   \
+static inline void nome##Colocar(struct nome##Tabela *t, const nome##Elemento *elemento, uint64_t h) { \
+    size_t mascaraGrupos = t->capacidade / GRUPO_GENERICO - 1;                                     \
+    size_t grupo = (h >> 7) & mascaraGrupos;                                                       \
+    for (size_t passo = 1;; passo++) {                                                             \
+        uint32_t livres = livresGrupoGenerico(t->controle + grupo * GRUPO_GENERICO);               \
+        if (livres != 0) {                                                                         \
+            size_t posicao = grupo * GRUPO_GENERICO + (size_t) __builtin_ctz(livres);              \
+            if (t->controle[posicao] == CONTROLE_APAGADO_GENERICO) {                               \
+                t->apagados--;                                                                     \
+            }                                                                                      \
+            t->controle[posicao] = (uint8_t) (CONTROLE_OCUPADO_GENERICO | (h & 0x7F));             \
+            t->elementos[posicao] = *elemento;                                                     \
+            t->ocupados++;                                                                         \
+            return;                                                                                \
+        }                                                                                          \
+        grupo = (grupo + passo) & mascaraGrupos;                                                   \
+    }                                                                                              \
+}                                                                                                  \
+                                                                                                   \
+static inline void nome##Esvaziar(struct nome##Tabela *t, size_t posicao) {                        \
+    const uint8_t *grupo = t->controle + (posicao / GRUPO_GENERICO) * GRUPO_GENERICO;              \
+    if (compararGrupoGenerico(grupo, CONTROLE_VAZIO_GENERICO) != 0) {                              \
+        t->controle[posicao] = CONTROLE_VAZIO_GENERICO;                                            \
+    } else {                                                                                       \
+        t->controle[posicao] = CONTROLE_APAGADO_GENERICO;                                          \
+        t->apagados++;                                                                             \
+    }                                                                                              \
+    t->ocupados--;                                                                                 \
+}                                                                                                  \
+                                                                                                   \
+static inline struct nome *nome##Criar(size_t capacidadeInicial, double fatorCarga) {              \
+    struct nome *c = (struct nome *) calloc(1, sizeof(struct nome));                               \
+    if (c == NULL) {                                                                               \
+        fprintf(stderr, "Erro na alocação de memória.\n");                                         \
+        exit(EXIT_FAILURE);                                                                        \
+    }                                                                                              \
+    size_t capacidade = GRUPO_GENERICO;                                                            \
+    while (capacidade < capacidadeInicial) {                                                       \
+        capacidade *= 2;                                                                           \
+    }                                                                                              \
+    c->atual = nome##CriarTabela(capacidade);                                                      \
+    c->fatorCarga = fatorCarga < 0.25 ? 0.25 : fatorCarga > 0.9375 ? 0.9375 : fatorCarga;          \
+    return c;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline void nome##Migrar(struct nome *c, size_t grupos) {                                   \
+    size_t totalGrupos = c->antiga.capacidade / GRUPO_GENERICO;                                    \
+    for (size_t g = 0; g < grupos && c->cursorMigracao < totalGrupos; g++, c->cursorMigracao++) {  \
+        size_t base = c->cursorMigracao * GRUPO_GENERICO;                                          \
+        uint32_t ocupadas = livresGrupoGenerico(c->antiga.controle + base) ^ 0xFFFFu;              \
+        while (ocupadas != 0) {                                                                    \
+            size_t posicao = base + (size_t) __builtin_ctz(ocupadas);                              \
+            const nome##Elemento *elemento = &c->antiga.elementos[posicao];                        \
+            nome##Colocar(&c->atual, elemento, hash(elemento));                                    \
+            c->antiga.controle[posicao] = CONTROLE_APAGADO_GENERICO;                               \
+            ocupadas &= ocupadas - 1;                                                              \
+        }                                                                                          \
+    }                                                                                              \
+    if (c->cursorMigracao >= totalGrupos) {                                                        \
+        nome##LiberarTabela(&c->antiga);                                                           \
+        c->migrando = false;                                                                       \
+    }                                                                                              \
+}                                                                                                  \
+                                                                                                   \
+static inline void nome##VerificarCarga(struct nome *c) {                                          \
+    struct nome##Tabela *t = &c->atual;                                                            \
+    if ((double) (t->ocupados + t->apagados + 1) <= c->fatorCarga * (double) t->capacidade) {      \
+        return;                                                                                    \
+    }                                                                                              \
+    if (c->migrando) {                                                                             \
+        nome##Migrar(c, SIZE_MAX);                                                                 \
+    }                                                                                              \
+    size_t capacidade = t->capacidade;                                                             \
+    if ((double) (c->tamanho + 1) > c->fatorCarga * (double) capacidade / 2) {                     \
+        capacidade *= 2;                                                                           \
+    }                                                                                              \
+    c->antiga = c->atual;                                                                          \
+    c->atual = nome##CriarTabela(capacidade);                                                      \
+    c->cursorMigracao = 0;                                                                         \
+    c->migrando = true;                                                                            \
+}                                                                                                  \
+                                                                                                   \
+static inline Tipo *nome##BuscarHash(struct nome *c, const nome##Elemento *chave, uint64_t h) {    \
+    long posicao = nome##Procurar(&c->atual, chave, h);                                            \
+    if (posicao >= 0) {                                                                            \
+        return &c->atual.elementos[posicao];                                                       \
+    }                                                                                              \
+    if (c->migrando && (posicao = nome##Procurar(&c->antiga, chave, h)) >= 0) {                    \
+        return &c->antiga.elementos[posicao];                                                      \
+    }                                                                                              \
+    return NULL;                                                                                   \
+}                                                                                                  \
+                                                                                                   \
+static inline Tipo *nome##Buscar(struct nome *c, const nome##Elemento *chave) {                    \
+    return nome##BuscarHash(c, chave, hash(chave));                                                \
+}                                                                                                  \
+                                                                                                   \
+static inline bool nome##Contem(struct nome *c, const nome##Elemento *chave) {                     \
+    return nome##Buscar(c, chave) != NULL;                                                         \
+}                                                                                                  \
+                                                                                                   \
+static inline bool nome##Inserir(struct nome *c, Tipo elemento) {                                  \
+    if (c->migrando) {                                                                             \
+        nome##Migrar(c, GRUPOS_POR_PASSO_GENERICO);                                                \
+    }                                                                                              \
+    uint64_t h = hash(&elemento);                                                                  \
+    if (nome##BuscarHash(c, &elemento, h) != NULL) {                                               \
+        return false;                                                                              \
+    }                                                                                              \
+    nome##VerificarCarga(c);                                                                       \
+    nome##Colocar(&c->atual, &elemento, h);                                                        \
+    c->tamanho++;                                                                                  \
+    return true;                                                                                   \
+}                                                                                                  \
+                                                                                                   \
+static inline bool nome##Remover(struct nome *c, const nome##Elemento *chave) {                    \
+    if (c->migrando) {                                                                             \
+        nome##Migrar(c, GRUPOS_POR_PASSO_GENERICO);                                                \
+    }                                                                                              \
+    uint64_t h = hash(chave);                                                                      \
+    long posicao = nome##Procurar(&c->atual, chave, h);                                            \
+    if (posicao >= 0) {                                                                            \
+        nome##Esvaziar(&c->atual, (size_t) posicao);                                               \
+    } else if (c->migrando && (posicao = nome##Procurar(&c->antiga, chave, h)) >= 0) {             \
+        nome##Esvaziar(&c->antiga, (size_t) posicao);                                              \
+    } else {                                                                                       \
+        return false;                                                                              \
+    }                                                                                              \
+    c->tamanho--;                                                                                  \
+    return true;                                                                                   \
+}                                                                                                  \
+                                                                                                   \
+static inline void nome##ParaCada(struct nome *c, void (*visitar)(const nome##Elemento *, void *), \
+                                  void *contexto) {                                                \
+    const struct nome##Tabela *tabelas[2] = {&c->atual, &c->antiga};                               \
+    for (int k = 0; k < (c->migrando ? 2 : 1); k++) {                                              \
+        for (size_t i = 0; i < tabelas[k]->capacidade; i++) {                                      \
+            if (tabelas[k]->controle[i] >= CONTROLE_OCUPADO_GENERICO) {                            \
+                visitar(&tabelas[k]->elementos[i], contexto);                                      \
+            }                                                                                      \
+        }                                                                                          \
+    }                                                                                              \
+}                                                                                                  \
+                                                                                                   \
+static inline void nome##Liberar(struct nome *c) {                                                 \
+    nome##LiberarTabela(&c->atual);                                                                \
+    nome##LiberarTabela(&c->antiga);                                                               \
+    free(c);                                                                                       \
+}
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * Fila Genérica Especializada na Compilação em C
+ *
+ * Fila encadeada gerada pela macro DEFINIR_FILA para qualquer tipo de
+ * valor, com os nós do alocador de Alocador_Nos.h como em Fila.c. Fila.c
+ * guarda só o início e percorre a fila inteira para achar o último a cada
+ * saída; aqui a fila guarda início e fim, então entrar (no fim) e sair (do
+ * início) são O(1).
+ *
+ * DEFINIR_FILA(nome, Tipo) gera:
+ *   struct nome                                    Fila (início, fim, tamanho); zerada = vazia
+ *   struct nomeNo                                  Nó (valor, próximo)
+ *   void nomeEntrar(struct nome *f, Tipo valor)    Insere no fim
+ *   bool nomeSair(struct nome *f, Tipo *valor)     Remove do início; false se vazia
+ *   void nomeLiberar(struct nome *f)               Libera todos os nós
+ *
+ * Uso:
+ *   DEFINIR_FILA(filaIds, uint64_t)
+ *   struct filaIds fila = {0};
+ *   filaIdsEntrar(&fila, 42);
+ *   uint64_t id;
+ *   while (filaIdsSair(&fila, &id)) ...
+ */
+
+#ifndef FILA_GENERICA_H
+#define FILA_GENERICA_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "../Alocador_Nos/Alocador_Nos.h"
+
+#define DEFINIR_FILA(nome, Tipo)                                                                   \
+                                                                                                   \
+struct nome##No {                                                                                  \
+    Tipo valor;                                                                                    \
+    struct nome##No *proximo;                                                                      \
+};                                                                                                 \
+                                                                                                   \
+struct nome {                                                                                      \
+    struct nome##No *inicio;                                                                       \
+    struct nome##No *fim;                                                                          \
+    size_t tamanho;                                                                                \
+};                                                                                                 \
+                                                                                                   \
+static struct alocadorNos nome##Alocador = ALOCADOR_NOS_INICIALIZADOR(struct nome##No);            \
+                                                                                                   \
+static inline void nome##Entrar(struct nome *f, Tipo valor) {                                      \
+    struct nome##No *novoNo = (struct nome##No *) alocarNo(&nome##Alocador);                       \
+    if (novoNo == NULL) {                                                                          \
+        fprintf(stderr, "Erro na alocação de memória.\n");                                         \
+        exit(EXIT_FAILURE);                                                                        \
+    }                                                                                              \
+    novoNo->valor = valor;                                                                         \
+    novoNo->proximo = NULL;                                                                        \
+    if (f->fim != NULL) {                                                                          \
+        f->fim->proximo = novoNo;                                                                  \
+    } else {                                                                                       \
+        f->inicio = novoNo;                                                                        \
+    }                                                                                              \
+    f->fim = novoNo;                                                                               \
+    f->tamanho++;                                                                                  \
+}                                                                                                  \
+                                                                                                   \
+static inline bool nome##Sair(struct nome *f, Tipo *valor) {                                       \
+    struct nome##No *primeiro = f->inicio;                                                         \
+    if (primeiro == NULL) {                                                                        \
+        return false;                                                                              \
+    }                                                                                              \
+    if (valor != NULL) {                                                                           \
+        *valor = primeiro->valor;                                                                  \
+    }                                                                                              \
+    f->inicio = primeiro->proximo;                                                                 \
+    if (f->inicio == NULL) {                                                                       \
+        f->fim = NULL;                                                                             \
+    }                                                                                              \
+    f->tamanho--;                                                                                  \
+    liberarNo(&nome##Alocador, primeiro);                                                          \
+    return true;                                                                                   \
+}                                                                                                  \
+                                                                                                   \
+static inline void nome##Liberar(struct nome *f) {                                                 \
+    while (nome##Sair(f, NULL)) {                                                                  \
+    }                                                                                              \
+}
+
+#endif
@@ -0,0 +1,343 @@
+/**
+ * Demonstração dos Contêineres Genéricos Especializados na Compilação em C
+ *
+ * Mostra a AVL, a pilha, a fila e o conjunto hash genéricos com tipos que
+ * as versões originais não aceitam (identificadores de 64 bits, textos com
+ * chaveCurta, um mapa nome -> idade) e compara a velocidade das instâncias
+ * com int contra o código original só de int:
+ * - Arvore_AVL.c x DEFINIR_AVL(..., int, compararInt)
+ * - Pilha.c x DEFINIR_PILHA(..., int)
+ * - Fila.c x DEFINIR_FILA(..., int) (só a entrada: a saída de Fila.c é O(n))
+ * - Conjunto_Hash.c x DEFINIR_CONJUNTO(..., int, hashInt, igualInt)
+ * Por fim compara uma AVL de chaveCurta com uma AVL de char* com strcmp.
+ *
+ *   gcc -O2 -pthread Genericos.c -o genericos
+ *   ./genericos [elementos]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "Tipos_Basicos.h"
+#include "Chave_Curta.h"
+#include "Arvore_AVL_Generica.h"
+#include "Pilha_Generica.h"
+#include "Fila_Generica.h"
+#include "Conjunto_Hash_Generico.h"
+
+// Versões originais, só de int, para a comparação
+#define main mainAVL
+#include "../Arvore_AVL/Arvore_AVL.c"
+#undef main
+
+#define main mainPilha
+#define no noPilha
+#define imprimir imprimirPilha
+#include "../Pilha/Pilha.c"
+#undef main
+#undef no
+#undef imprimir
+
+#define main mainFila
+#define no noFila
+#define imprimir imprimirFila
+#define menu menuFila
+#include "../Fila/Fila.c"
+#undef main
+#undef no
+#undef imprimir
+#undef menu
+
+#define main mainConjunto
+#define imprimir imprimirConjunto
+#define segundosDesde segundosDesdeConjunto
+#define chaveTeste chaveTesteConjunto
+#include "../Matriz_Esparsa/Conjunto_Hash.c"
+#undef main
+#undef imprimir
+#undef segundosDesde
+#undef chaveTeste
+
+// Mapa nome -> idade: o comparador e o hash olham só o nome
+struct pessoa {
+    struct chaveCurta nome;
+    int idade;
+};
+
+static inline int compararPessoa(const struct pessoa *a, const struct pessoa *b) {
+    return compararChaveCurta(&a->nome, &b->nome);
+}
+
+static inline bool igualPessoa(const struct pessoa *a, const struct pessoa *b) {
+    return igualChaveCurta(&a->nome, &b->nome);
+}
+
+static inline uint64_t hashPessoa(const struct pessoa *p) {
+    return hashChaveCurta(&p->nome);
+}
+
+// Textos comuns, para comparar com a chaveCurta
+static inline int compararTexto(const char *const *a, const char *const *b) {
+    return strcmp(*a, *b);
+}
+
+// Instâncias usadas no programa
+DEFINIR_AVL(avlInt, int, compararInt)
+DEFINIR_AVL(avlIds, uint64_t, compararU64)
+DEFINIR_AVL(avlPessoas, struct pessoa, compararPessoa)
+DEFINIR_AVL(avlChaves, struct chaveCurta, compararChaveCurta)
+DEFINIR_AVL(avlTextos, const char *, compararTexto)
+DEFINIR_PILHA(pilhaInt, int)
+DEFINIR_PILHA(pilhaReais, double)
+DEFINIR_FILA(filaInt, int)
+DEFINIR_FILA(filaIds, uint64_t)
+DEFINIR_CONJUNTO(conjuntoInt, int, hashInt, igualInt)
+DEFINIR_CONJUNTO(mapaPessoas, struct pessoa, hashPessoa, igualPessoa)
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+/**
+ * i-ésima chave do teste: multiplicação por um ímpar é uma bijeção em 32
+ * bits, então as chaves são distintas e espalhadas
+ */
+static inline int chaveTeste(size_t i) {
+    return (int) (uint32_t) ((uint32_t) i * 2654435761u);
+}
+
+static void imprimirPessoa(const struct pessoa *p, void *contexto) {
+    (void) contexto;
+    printf("%.*s (%d)  ", (int) p->nome.tamanho, textoChaveCurta(&p->nome), p->idade);
+}
+
+static void imprimirId(const uint64_t *id, void *contexto) {
+    (void) contexto;
+    printf("%llu ", (unsigned long long) *id);
+}
+
+/**
+ * Imprime uma linha da comparação (melhor de 3 repetições de cada lado)
+ */
+static void imprimirComparacao(const char *operacao, double original, double generica, size_t n) {
+    printf("%-24s %12.1f %12.1f %9.2f\n", operacao, original * 1e9 / (double) n, generica * 1e9 / (double) n,
+           generica / original);
+}
+
+#define REPETICOES 3
+#define MINIMO(a, b) ((b) < (a) ? (b) : (a))
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000000;
+    struct timespec t0;
+
+    // Exemplos com tipos que as versões originais não aceitam
+    struct avlIdsNo *ids = NULL;
+    uint64_t exemplosIds[] = {9007199254740993ull, 42, 18446744073709551615ull, 4294967296ull};
+    for (int i = 0; i < 4; i++) {
+        ids = avlIdsInserir(ids, exemplosIds[i]);
+    }
+    printf("AVL de identificadores de 64 bits: ");
+    avlIdsEmOrdem(ids, imprimirId, NULL);
+    printf("\n");
+    avlIdsLiberar(ids);
+
+    const char *nomes[] = {"Ana", "Bruno", "Carla", "Maria Eduarda Albuquerque", "Maria Eduarda Almeida", "Zeca"};
+    int idades[] = {31, 25, 47, 19, 52, 60};
+    struct avlPessoasNo *pessoas = NULL;
+    struct mapaPessoas *mapa = mapaPessoasCriar(0, 0.875);
+    for (int i = 0; i < 6; i++) {
+        struct pessoa p = {criarChaveCurta(nomes[i]), idades[i]};
+        pessoas = avlPessoasInserir(pessoas, p);
+        mapaPessoasInserir(mapa, p);
+    }
+    printf("AVL de pessoas em ordem de nome: ");
+    avlPessoasEmOrdem(pessoas, imprimirPessoa, NULL);
+    struct pessoa procurada = {criarChaveCurta("Maria Eduarda Almeida"), 0};
+    struct pessoa *achada = mapaPessoasBuscar(mapa, &procurada);
+    if (achada != NULL) {
+        achada->idade++;    // Atualiza o valor no lugar
+    }
+    printf("\nMapa hash: %s tem %d anos (após o aniversário); %zu pessoas\n", nomes[4],
+           achada != NULL ? achada->idade : -1, mapa->tamanho);
+    avlPessoasLiberar(pessoas);
+    mapaPessoasLiberar(mapa);
+
+    struct pilhaReaisNo *reais = NULL;
+    for (int i = 1; i <= 3; i++) {
+        reais = pilhaReaisEmpilhar(reais, i * 1.5);
+    }
+    printf("Pilha de double:");
+    double real;
+    while (reais != NULL) {
+        reais = pilhaReaisDesempilhar(reais, &real);
+        printf(" %.1f", real);
+    }
+    struct filaIds filaIds = {0};
+    for (uint64_t id = 1ull << 40; id < (1ull << 40) + 3; id++) {
+        filaIdsEntrar(&filaIds, id);
+    }
+    printf("\nFila de uint64_t:");
+    uint64_t id;
+    while (filaIdsSair(&filaIds, &id)) {
+        printf(" %llu", (unsigned long long) id);
+    }
+    printf("\n\n");
+
+    // Comparação com as versões só de int
+    double original[9], generica[9];
+    for (int k = 0; k < 9; k++) {
+        original[k] = generica[k] = 1e30;
+    }
+    size_t conferencia = 0;
+    for (int r = 0; r < REPETICOES; r++) {
+        // AVL
+        struct NoAVL *raiz = NULL;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) raiz = inserirAVL(raiz, chaveTeste(i));
+        original[0] = MINIMO(original[0], segundosDesde(&t0));
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) conferencia += buscarAVL(raiz, chaveTeste(i)) != NULL;
+        original[1] = MINIMO(original[1], segundosDesde(&t0));
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) raiz = removerAVL(raiz, chaveTeste(i));
+        original[2] = MINIMO(original[2], segundosDesde(&t0));
+
+        struct avlIntNo *raizGenerica = NULL;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) raizGenerica = avlIntInserir(raizGenerica, chaveTeste(i));
+        generica[0] = MINIMO(generica[0], segundosDesde(&t0));
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) conferencia -= avlIntBuscar(raizGenerica, &(int) {chaveTeste(i)}) != NULL;
+        generica[1] = MINIMO(generica[1], segundosDesde(&t0));
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) raizGenerica = avlIntRemover(raizGenerica, &(int) {chaveTeste(i)});
+        generica[2] = MINIMO(generica[2], segundosDesde(&t0));
+
+        // Pilha: empilhar n e esvaziar
+        struct noPilha *topo = NULL;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) topo = push(topo, (int) i);
+        original[3] = MINIMO(original[3], segundosDesde(&t0));
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        liberarPilha(topo);
+        original[4] = MINIMO(original[4], segundosDesde(&t0));
+
+        struct pilhaIntNo *topoGenerico = NULL;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) topoGenerico = pilhaIntEmpilhar(topoGenerico, (int) i);
+        generica[3] = MINIMO(generica[3], segundosDesde(&t0));
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        pilhaIntLiberar(topoGenerico);
+        generica[4] = MINIMO(generica[4], segundosDesde(&t0));
+
+        // Fila: só a entrada (a saída de Fila.c percorre a fila inteira)
+        struct noFila *inicio = NULL;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) inicio = entrar(inicio, (int) i);
+        original[5] = MINIMO(original[5], segundosDesde(&t0));
+        while (inicio != NULL) {
+            struct noFila *proximo = inicio->proximo;
+            liberarNo(&alocadorFila, inicio);
+            inicio = proximo;
+        }
+
+        struct filaInt fila = {0};
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) filaIntEntrar(&fila, (int) i);
+        generica[5] = MINIMO(generica[5], segundosDesde(&t0));
+        filaIntLiberar(&fila);
+
+        // Conjunto hash
+        struct conjuntoHash *conjunto = criarConjunto(0, 0.875);
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) inserirConjunto(conjunto, chaveTeste(i));
+        original[6] = MINIMO(original[6], segundosDesde(&t0));
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) conferencia += contemConjunto(conjunto, chaveTeste(i));
+        original[7] = MINIMO(original[7], segundosDesde(&t0));
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) removerConjunto(conjunto, chaveTeste(i));
+        original[8] = MINIMO(original[8], segundosDesde(&t0));
+        liberarConjunto(conjunto);
+
+        struct conjuntoInt *conjuntoGenerico = conjuntoIntCriar(0, 0.875);
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) conjuntoIntInserir(conjuntoGenerico, chaveTeste(i));
+        generica[6] = MINIMO(generica[6], segundosDesde(&t0));
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) conferencia -= conjuntoIntContem(conjuntoGenerico, &(int) {chaveTeste(i)});
+        generica[7] = MINIMO(generica[7], segundosDesde(&t0));
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) conjuntoIntRemover(conjuntoGenerico, &(int) {chaveTeste(i)});
+        generica[8] = MINIMO(generica[8], segundosDesde(&t0));
+        conjuntoIntLiberar(conjuntoGenerico);
+    }
+
+    printf("%zu elementos, int, melhor de %d repetições\n", n, REPETICOES);
+    printf("%-24s %12s %12s %9s\n", "Operação", "original ns", "genérica ns", "razão");
+    const char *operacoes[9] = {"AVL inserir", "AVL buscar", "AVL remover", "Pilha empilhar", "Pilha esvaziar",
+                                "Fila entrar", "Conjunto inserir", "Conjunto buscar", "Conjunto remover"};
+    for (int k = 0; k < 9; k++) {
+        imprimirComparacao(operacoes[k], original[k], generica[k], n);
+    }
+    printf("(buscas com resultados %s)\n\n", conferencia == 0 ? "iguais" : "DIFERENTES");
+
+    // Textos: chaveCurta x char* com strcmp, com chaves curtas e longas
+    char (*textos)[32] = (char (*)[32]) malloc(n * sizeof(*textos));
+    if (textos == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        return EXIT_FAILURE;
+    }
+    printf("%-24s %12s %12s %9s\n", "AVL de textos", "char* ns", "chaveCurta ns", "razão");
+    for (int longos = 0; longos < 2; longos++) {
+        for (size_t i = 0; i < n; i++) {
+            snprintf(textos[i], sizeof(textos[i]), longos ? "%08x-cadastro-geral" : "%x",
+                     (unsigned) chaveTeste(i));
+        }
+        double tempoTexto[2] = {1e30, 1e30}, tempoChave[2] = {1e30, 1e30};
+        size_t achados = 0;
+        for (int r = 0; r < REPETICOES; r++) {
+            struct avlTextosNo *arvoreTextos = NULL;
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            for (size_t i = 0; i < n; i++) arvoreTextos = avlTextosInserir(arvoreTextos, textos[i]);
+            tempoTexto[0] = MINIMO(tempoTexto[0], segundosDesde(&t0));
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            for (size_t i = 0; i < n; i++) {
+                const char *texto = textos[i];
+                achados += avlTextosBuscar(arvoreTextos, &texto) != NULL;
+            }
+            tempoTexto[1] = MINIMO(tempoTexto[1], segundosDesde(&t0));
+            avlTextosLiberar(arvoreTextos);
+
+            struct avlChavesNo *arvoreChaves = NULL;
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            for (size_t i = 0; i < n; i++) arvoreChaves = avlChavesInserir(arvoreChaves, criarChaveCurta(textos[i]));
+            tempoChave[0] = MINIMO(tempoChave[0], segundosDesde(&t0));
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            for (size_t i = 0; i < n; i++) {
+                struct chaveCurta chave = criarChaveCurta(textos[i]);
+                achados -= avlChavesBuscar(arvoreChaves, &chave) != NULL;
+            }
+            tempoChave[1] = MINIMO(tempoChave[1], segundosDesde(&t0));
+            avlChavesLiberar(arvoreChaves);
+        }
+        const char *tipo = longos ? "longos" : "curtos";
+        char rotulo[2][32];
+        snprintf(rotulo[0], sizeof(rotulo[0]), "inserir (%s)", tipo);
+        snprintf(rotulo[1], sizeof(rotulo[1]), "buscar (%s)%s", tipo, achados == 0 ? "" : " ERRO");
+        for (int k = 0; k < 2; k++) {
+            imprimirComparacao(rotulo[k], tempoTexto[k], tempoChave[k], n);
+        }
+    }
+    free(textos);
+    return 0;
+}
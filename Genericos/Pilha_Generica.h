@@ -0,0 +1,69 @@
+/**
+ * Pilha Genérica Especializada na Compilação em C
+ *
+ * A mesma pilha encadeada de Pilha.c (push e pop no topo, nós do alocador
+ * com caches por thread), gerada pela macro DEFINIR_PILHA para qualquer
+ * tipo de valor. O valor fica dentro do nó; com int, o nó é igual ao
+ * struct no de Pilha.c. Cada instância tem o próprio alocador (o limite é
+ * MAX_ALOCADORES por programa, ver Alocador_Nos.h).
+ *
+ * DEFINIR_PILHA(nome, Tipo) gera:
+ *   struct nomeNo                                          Nó (valor, próximo)
+ *   struct nomeNo *nomeEmpilhar(topo, Tipo valor)          Push
+ *   struct nomeNo *nomeDesempilhar(topo, Tipo *valor)      Pop (valor pode ser NULL)
+ *   void nomeLiberar(topo)                                 Libera todos os nós
+ *
+ * Uso:
+ *   DEFINIR_PILHA(pilhaReais, double)
+ *   struct pilhaReaisNo *topo = NULL;
+ *   topo = pilhaReaisEmpilhar(topo, 3.5);
+ *   double valor;
+ *   topo = pilhaReaisDesempilhar(topo, &valor);
+ */
+
+#ifndef PILHA_GENERICA_H
+#define PILHA_GENERICA_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../Alocador_Nos/Alocador_Nos.h"
+
+#define DEFINIR_PILHA(nome, Tipo)                                                                  \
+                                                                                                   \
+struct nome##No {                                                                                  \
+    Tipo valor;                                                                                    \
+    struct nome##No *proximo;                                                                      \
+};                                                                                                 \
+                                                                                                   \
+static struct alocadorNos nome##Alocador = ALOCADOR_NOS_INICIALIZADOR(struct nome##No);            \
+                                                                                                   \
+static inline struct nome##No *nome##Empilhar(struct nome##No *topo, Tipo valor) {                 \
+    struct nome##No *novoNo = (struct nome##No *) alocarNo(&nome##Alocador);                       \
+    if (novoNo == NULL) {                                                                          \
+        fprintf(stderr, "Erro na alocação de memória.\n");                                         \
+        exit(EXIT_FAILURE);                                                                        \
+    }                                                                                              \
+    novoNo->valor = valor;                                                                         \
+    novoNo->proximo = topo;                                                                        \
+    return novoNo;                                                                                 \
+}                                                                                                  \
+                                                                                                   \
+static inline struct nome##No *nome##Desempilhar(struct nome##No *topo, Tipo *valor) {             \
+    if (topo == NULL) {                                                                            \
+        return NULL;                                                                               \
+    }                                                                                              \
+    struct nome##No *proximo = topo->proximo;                                                      \
+    if (valor != NULL) {                                                                           \
+        *valor = topo->valor;                                                                      \
+    }                                                                                              \
+    liberarNo(&nome##Alocador, topo);                                                              \
+    return proximo;                                                                                \
+}                                                                                                  \
+                                                                                                   \
+static inline void nome##Liberar(struct nome##No *topo) {                                          \
+    while (topo != NULL) {                                                                         \
+        topo = nome##Desempilhar(topo, NULL);                                                      \
+    }                                                                                              \
+}
+
+#endif
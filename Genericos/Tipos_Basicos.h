@@ -0,0 +1,66 @@
+/**
+ * Comparadores e Funções de Hash dos Tipos Básicos em C
+ *
+ * Os contêineres genéricos (Arvore_AVL_Generica.h, Conjunto_Hash_Generico.h)
+ * recebem o nome de uma função de comparação ou de hash e a chamam
+ * diretamente no código gerado, então uma função static inline como as
+ * daqui é expandida no lugar, sem chamada indireta:
+ * - compararInt, igualInt, hashInt: int (o mesmo hash de Conjunto_Hash.c)
+ * - compararU64, igualU64, hashU64: uint64_t (identificadores de 64 bits)
+ *
+ * Convenções usadas por todos os contêineres:
+ * - comparar(a, b) devolve < 0, 0 ou > 0, como strcmp
+ * - igual(a, b) devolve true se as chaves são iguais
+ * - hash(a) devolve 64 bits bem misturados: os 7 bits baixos e os altos são
+ *   usados separadamente pelo conjunto hash
+ * Todas recebem ponteiros para os elementos.
+ */
+
+#ifndef TIPOS_BASICOS_H
+#define TIPOS_BASICOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Mistura de 64 bits (finalizador do MurmurHash3)
+ */
+static inline uint64_t misturarGenerico(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+/*
+ * Igualdade primeiro: o compilador reaproveita a mesma comparação para o
+ * teste de parada e para a escolha do filho (cmov) na busca da AVL. Com
+ * (a > b) - (a < b) a busca de 10^6 int ficou quase 4x mais lenta
+ */
+static inline int compararInt(const int *a, const int *b) {
+    return *a == *b ? 0 : (*a < *b ? -1 : 1);
+}
+
+static inline bool igualInt(const int *a, const int *b) {
+    return *a == *b;
+}
+
+static inline uint64_t hashInt(const int *a) {
+    return misturarGenerico((uint32_t) *a);
+}
+
+static inline int compararU64(const uint64_t *a, const uint64_t *b) {
+    return *a == *b ? 0 : (*a < *b ? -1 : 1);
+}
+
+static inline bool igualU64(const uint64_t *a, const uint64_t *b) {
+    return *a == *b;
+}
+
+static inline uint64_t hashU64(const uint64_t *a) {
+    return misturarGenerico(*a);
+}
+
+#endif
@@ -8,7 +8,9 @@
 
 #include <stdio.h>
 
-#define TAMANHO 5
+#ifndef TAMANHO
+#define TAMANHO 5  // Número de vértices (pode ser definido na compilação)
+#endif
 
 /**
  * Constrói o grafo com base na entrada do usuário
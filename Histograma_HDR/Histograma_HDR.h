@@ -0,0 +1,115 @@
+/**
+ * Histograma HDR (High Dynamic Range) de Latências em C
+ *
+ * Histograma log-linear usado pelas medições do repositório (a
+ * instrumentação de Deque_Fila_Prioritaria.c, Reprodutor_Trace.c e
+ * Benchmark.c):
+ * - Valores abaixo de 2^HDR_SUB_BITS têm balde próprio; acima disso, cada
+ *   potência de 2 é dividida em HDR_SUB_BALDES baldes, o que dá erro
+ *   relativo de ~3% cobrindo de 1 ns até o maior uint64_t com tamanho fixo
+ * - Registrar um valor é um incremento, sem alocação nem ordenação
+ * - Percentis são lidos percorrendo os baldes uma vez
+ *
+ * Uso:
+ *   struct histograma h;
+ *   zerarHistograma(&h);
+ *   registrarHistograma(&h, agoraNs() - antes);
+ *   uint64_t p99 = percentilHistograma(&h, 99.0);
+ *
+ * Todas as funções são static inline: o arquivo é incluído por cada programa.
+ */
+
+#ifndef HISTOGRAMA_HDR_H
+#define HISTOGRAMA_HDR_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define HDR_SUB_BITS 5
+#define HDR_SUB_BALDES (1 << HDR_SUB_BITS)
+#define HDR_BALDES ((64 - HDR_SUB_BITS + 1) * HDR_SUB_BALDES)
+
+// Histograma HDR log-linear
+struct histograma {
+    uint64_t contagem[HDR_BALDES];
+    uint64_t total;
+    uint64_t soma;
+    uint64_t minimo;            // UINT64_MAX enquanto vazio
+    uint64_t maximo;
+};
+
+/**
+ * Esvazia o histograma
+ * @param h Ponteiro para o histograma
+ */
+static inline void zerarHistograma(struct histograma *h) {
+    memset(h, 0, sizeof(*h));
+    h->minimo = UINT64_MAX;
+}
+
+/**
+ * Calcula o balde do histograma para um valor
+ * @param valor Valor a ser registrado
+ * @return Índice do balde
+ */
+static inline int baldeHistograma(uint64_t valor) {
+    if (valor < HDR_SUB_BALDES) {
+        return (int) valor;
+    }
+    int deslocamento = 63 - __builtin_clzll(valor) - HDR_SUB_BITS;
+    return (deslocamento + 1) * HDR_SUB_BALDES
+           + (int) (valor >> deslocamento) - HDR_SUB_BALDES;
+}
+
+/**
+ * Calcula o menor valor representado por um balde
+ * @param balde Índice do balde
+ * @return Limite inferior do balde
+ */
+static inline uint64_t valorBalde(int balde) {
+    if (balde < HDR_SUB_BALDES) {
+        return (uint64_t) balde;
+    }
+    int deslocamento = balde / HDR_SUB_BALDES - 1;
+    uint64_t mantissa = (uint64_t) (balde % HDR_SUB_BALDES + HDR_SUB_BALDES);
+    return mantissa << deslocamento;
+}
+
+/**
+ * Registra um valor no histograma
+ * @param h Ponteiro para o histograma
+ * @param valor Valor a ser registrado
+ */
+static inline void registrarHistograma(struct histograma *h, uint64_t valor) {
+    h->contagem[baldeHistograma(valor)]++;
+    h->total++;
+    h->soma += valor;
+    if (valor < h->minimo) h->minimo = valor;
+    if (valor > h->maximo) h->maximo = valor;
+}
+
+/**
+ * Calcula um percentil do histograma
+ * @param h Ponteiro para o histograma
+ * @param percentil Percentil desejado (0 a 100)
+ * @return Valor aproximado do percentil (0 se vazio)
+ */
+static inline uint64_t percentilHistograma(const struct histograma *h, double percentil) {
+    if (h->total == 0) {
+        return 0;
+    }
+    uint64_t alvo = (uint64_t) (percentil / 100.0 * (double) h->total + 0.5);
+    if (alvo == 0) alvo = 1;
+
+    uint64_t acumulado = 0;
+    for (int i = 0; i < HDR_BALDES; i++) {
+        acumulado += h->contagem[i];
+        if (acumulado >= alvo) {
+            uint64_t valor = valorBalde(i);
+            return valor > h->maximo ? h->maximo : valor;
+        }
+    }
+    return h->maximo;
+}
+
+#endif
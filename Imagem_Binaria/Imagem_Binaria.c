@@ -0,0 +1,352 @@
+/**
+ * Demonstração da Imagem Binária das Estruturas em C
+ *
+ * Compara, para a Árvore AVL, a Árvore Rubro-Negra e a Matriz Esparsa, as
+ * duas formas de ter a estrutura pronta no início de uma execução:
+ * - Reconstruir com uma inserção por elemento (o que o main de cada arquivo
+ *   faz hoje)
+ * - Abrir a imagem gravada antes: um mmap e a leitura do cabeçalho
+ *
+ * Antes de abrir, as páginas da imagem são descartadas do cache do sistema
+ * (fdatasync + posix_fadvise), então a primeira consulta mostra o custo de
+ * trazer do disco só o caminho que ela percorre. Depois mede as consultas
+ * na imagem e na estrutura de ponteiros, confere que dão o mesmo resultado
+ * e restaura a estrutura em memória a partir da imagem, conferindo que a
+ * forma restaurada é igual à original.
+ *
+ * As funções de imagem ficam em blocos #ifdef IMAGEM_BINARIA dos arquivos
+ * das estruturas; este arquivo define IMAGEM_BINARIA antes de incluí-los.
+ *
+ *   gcc -O2 -pthread Imagem_Binaria.c -o imagem_binaria
+ *   ./imagem_binaria [elementos]
+ */
+
+#define _DEFAULT_SOURCE          // madvise, posix_fadvise e fdatasync com -std=c11
+#ifndef IMAGEM_BINARIA
+#define IMAGEM_BINARIA           // Liga as funções de imagem nas estruturas incluídas
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "Imagem_Binaria.h"
+
+// Arvore_AVL.c
+#define main mainAVL
+#include "../Arvore_AVL/Arvore_AVL.c"
+#undef main
+
+// Arvore_Rubro_Negra.c
+#define main mainRN
+#include "../Arvore_Rubro_Negra/Arvore_Rubro_Negra.c"
+#undef main
+
+// Matriz_Esparsa.c
+#define main mainMatriz
+#include "../Matriz_Esparsa/Matriz_Esparsa.c"
+#undef main
+
+#define CONSULTAS_ARVORE 1000000
+#define CONSULTAS_MATRIZ 2000     // Cada consulta percorre uma lista inteira
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+/**
+ * i-ésima chave: multiplicação por um ímpar é uma bijeção em 32 bits, então
+ * as chaves são distintas e chegam fora de ordem
+ */
+static inline int chaveTeste(size_t i) {
+    return (int) (uint32_t) ((uint32_t) i * 2654435761u);
+}
+
+/**
+ * Gerador xorshift64 das consultas
+ */
+static inline uint64_t proximoAleatorio(uint64_t *estado) {
+    *estado ^= *estado << 13;
+    *estado ^= *estado >> 7;
+    *estado ^= *estado << 17;
+    return *estado;
+}
+
+/**
+ * Consultas: metade a chaves presentes, metade a chaves ausentes
+ */
+static int *gerarConsultas(size_t elementos, size_t quantidade) {
+    int *chaves = (int *) malloc(quantidade * sizeof(int));
+    if (chaves == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    uint64_t estado = 88172645463325252ull;
+    for (size_t k = 0; k < quantidade; k++) {
+        chaves[k] = chaveTeste(proximoAleatorio(&estado) % (2 * elementos));
+    }
+    return chaves;
+}
+
+/**
+ * Tira as páginas do arquivo do cache do sistema, simulando um início a frio
+ */
+static void descartarCache(const char *caminho) {
+    int fd = open(caminho, O_RDONLY);
+    if (fd >= 0) {
+        fdatasync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+}
+
+static long tamanhoArquivo(const char *caminho) {
+    struct stat info;
+    return stat(caminho, &info) == 0 ? (long) info.st_size : -1;
+}
+
+// Consultas no formato de medirConsultas
+static bool consultarAVL(const void *estrutura, int chave) {
+    return buscarAVL((struct NoAVL *) estrutura, chave) != NULL;
+}
+
+static bool consultarImagemAVL(const void *estrutura, int chave) {
+    return buscarImagemAVL((const struct ImagemAVL *) estrutura, chave) != NULL;
+}
+
+static bool consultarRN(const void *estrutura, int chave) {
+    return buscarRN((struct NoRN *) estrutura, chave) != NULL;
+}
+
+static bool consultarImagemRN(const void *estrutura, int chave) {
+    return buscarImagemRN((const struct ImagemRN *) estrutura, chave) != NULL;
+}
+
+static bool consultarMatriz(const void *estrutura, int chave) {
+    return buscar((struct diretor *) estrutura, chave) != NULL;
+}
+
+static bool consultarImagemMatriz(const void *estrutura, int chave) {
+    return buscarImagemMatriz((const struct imagemMatriz *) estrutura, chave) != NULL;
+}
+
+/**
+ * Mede o tempo médio das consultas
+ * @param achados Recebe, por consulta, se a chave foi encontrada
+ * @return Nanossegundos por consulta
+ */
+static double medirConsultas(bool (*consultar)(const void *, int), const void *estrutura, const int *chaves,
+                             size_t quantidade, bool *achados) {
+    struct timespec t0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (size_t k = 0; k < quantidade; k++) {
+        achados[k] = consultar(estrutura, chaves[k]);
+    }
+    return segundosDesde(&t0) * 1e9 / (double) quantidade;
+}
+
+// Conferência das estruturas restauradas: mesma forma, valores e alturas/cores
+static bool iguaisAVL(const struct NoAVL *a, const struct NoAVL *b) {
+    if (a == NULL || b == NULL) {
+        return a == b;
+    }
+    return a->numero == b->numero && a->altura == b->altura && iguaisAVL(a->esquerda, b->esquerda) &&
+           iguaisAVL(a->direita, b->direita);
+}
+
+static bool iguaisRN(const struct NoRN *a, const struct NoRN *b, const struct NoRN *paiB) {
+    if (a == NULL || b == NULL) {
+        return a == NULL && b == NULL;
+    }
+    return a->numero == b->numero && a->cor == b->cor && b->pai == paiB &&
+           iguaisRN(a->esquerda, b->esquerda, b) && iguaisRN(a->direita, b->direita, b);
+}
+
+static bool iguaisMatriz(const struct diretor *a, const struct diretor *b) {
+    for (; a != NULL && b != NULL; a = a->proximoDiretor, b = b->proximoDiretor) {
+        const struct no *x = a->proximoNo, *y = b->proximoNo;
+        for (; x != NULL && y != NULL; x = x->proximoNo, y = y->proximoNo) {
+            if (x->numero != y->numero) {
+                return false;
+            }
+        }
+        if (a->resto != b->resto || x != NULL || y != NULL) {
+            return false;
+        }
+    }
+    return a == NULL && b == NULL;
+}
+
+/**
+ * Imprime as medidas de uma estrutura
+ */
+static void imprimirMedidas(const char *nome, size_t elementos, double tempoInserir, double tempoGravar, long bytes,
+                            double tempoAbrir, double tempoPrimeira, double nsPonteiros, double nsImagem, bool mesmos,
+                            double tempoRestaurar, bool igual) {
+    printf("%s (%zu números)\n", nome, elementos);
+    printf("  inserções:        %10.6f s\n", tempoInserir);
+    printf("  gravar imagem:    %10.6f s (%.1f MB)\n", tempoGravar, (double) bytes / 1e6);
+    printf("  abrir imagem:     %10.6f s\n", tempoAbrir);
+    printf("  1ª consulta:      %10.6f s (páginas trazidas do disco)\n", tempoPrimeira);
+    printf("  consultas:        ponteiros %.1f ns, imagem %.1f ns (%s)\n", nsPonteiros, nsImagem,
+           mesmos ? "mesmos resultados" : "RESULTADOS DIFERENTES");
+    printf("  restaurar:        %10.6f s (%s)\n\n", tempoRestaurar,
+           igual ? "igual à original" : "DIFERENTE da original");
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000000;
+    if (n == 0 || n >= SEM_LIGACAO) {
+        fprintf(stderr, "Uso: %s [elementos] (1 a %u)\n", argv[0], SEM_LIGACAO - 1);
+        return EXIT_FAILURE;
+    }
+    const char *caminhoAVL = "exemplo_avl.img";
+    const char *caminhoRN = "exemplo_rn.img";
+    const char *caminhoMatriz = "exemplo_matriz.img";
+    int *chaves = gerarConsultas(n, CONSULTAS_ARVORE);
+    bool *achadosPonteiros = (bool *) malloc(CONSULTAS_ARVORE * sizeof(bool));
+    bool *achadosImagem = (bool *) malloc(CONSULTAS_ARVORE * sizeof(bool));
+    if (achadosPonteiros == NULL || achadosImagem == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        return EXIT_FAILURE;
+    }
+    struct timespec t0;
+    double tempoInserir, tempoGravar, tempoAbrir, tempoPrimeira, nsPonteiros, nsImagem, tempoRestaurar;
+    bool ok = true;
+
+    // Árvore AVL
+    {
+        struct NoAVL *raiz = NULL;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) {
+            raiz = inserirAVL(raiz, chaveTeste(i));
+        }
+        tempoInserir = segundosDesde(&t0);
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        ok = salvarAVL(raiz, caminhoAVL) && ok;
+        tempoGravar = segundosDesde(&t0);
+        descartarCache(caminhoAVL);
+
+        struct ImagemAVL imagem;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        if (!abrirImagemAVL(caminhoAVL, &imagem)) {
+            fprintf(stderr, "Não foi possível gravar ou abrir %s\n", caminhoAVL);
+            return EXIT_FAILURE;
+        }
+        tempoAbrir = segundosDesde(&t0);
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        achadosImagem[0] = buscarImagemAVL(&imagem, chaves[0]) != NULL;
+        tempoPrimeira = segundosDesde(&t0);
+
+        nsPonteiros = medirConsultas(consultarAVL, raiz, chaves, CONSULTAS_ARVORE, achadosPonteiros);
+        nsImagem = medirConsultas(consultarImagemAVL, &imagem, chaves, CONSULTAS_ARVORE, achadosImagem);
+        bool mesmos = memcmp(achadosPonteiros, achadosImagem, CONSULTAS_ARVORE * sizeof(bool)) == 0;
+
+        struct NoAVL *restaurada;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        bool restaurou = restaurarAVL(&imagem, &restaurada);
+        tempoRestaurar = segundosDesde(&t0);
+        bool igual = restaurou && iguaisAVL(raiz, restaurada);
+        imprimirMedidas("Árvore AVL", n, tempoInserir, tempoGravar, tamanhoArquivo(caminhoAVL), tempoAbrir,
+                        tempoPrimeira, nsPonteiros, nsImagem, mesmos, tempoRestaurar, igual);
+        ok = ok && mesmos && igual;
+        fecharImagemAVL(&imagem);
+        liberarAVL(restaurada);
+        liberarAVL(raiz);
+    }
+
+    // Árvore Rubro-Negra
+    {
+        struct NoRN *raiz = NULL;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) {
+            raiz = inserirRN(raiz, chaveTeste(i));
+        }
+        tempoInserir = segundosDesde(&t0);
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        ok = salvarRN(raiz, caminhoRN) && ok;
+        tempoGravar = segundosDesde(&t0);
+        descartarCache(caminhoRN);
+
+        struct ImagemRN imagem;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        if (!abrirImagemRN(caminhoRN, &imagem)) {
+            fprintf(stderr, "Não foi possível gravar ou abrir %s\n", caminhoRN);
+            return EXIT_FAILURE;
+        }
+        tempoAbrir = segundosDesde(&t0);
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        achadosImagem[0] = buscarImagemRN(&imagem, chaves[0]) != NULL;
+        tempoPrimeira = segundosDesde(&t0);
+
+        nsPonteiros = medirConsultas(consultarRN, raiz, chaves, CONSULTAS_ARVORE, achadosPonteiros);
+        nsImagem = medirConsultas(consultarImagemRN, &imagem, chaves, CONSULTAS_ARVORE, achadosImagem);
+        bool mesmos = memcmp(achadosPonteiros, achadosImagem, CONSULTAS_ARVORE * sizeof(bool)) == 0;
+
+        struct NoRN *restaurada;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        bool restaurou = restaurarRN(&imagem, &restaurada);
+        tempoRestaurar = segundosDesde(&t0);
+        bool igual = restaurou && restaurada->pai == NULL && iguaisRN(raiz, restaurada, NULL);
+        imprimirMedidas("Árvore Rubro-Negra", n, tempoInserir, tempoGravar, tamanhoArquivo(caminhoRN), tempoAbrir,
+                        tempoPrimeira, nsPonteiros, nsImagem, mesmos, tempoRestaurar, igual);
+        ok = ok && mesmos && igual;
+        fecharImagemRN(&imagem);
+        liberarRN(restaurada);
+        liberarRN(raiz);
+    }
+
+    // Matriz Esparsa
+    {
+        struct diretor *matriz = NULL;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) {
+            matriz = inserir(matriz, chaveTeste(i));
+        }
+        tempoInserir = segundosDesde(&t0);
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        ok = salvarMatriz(matriz, caminhoMatriz) && ok;
+        tempoGravar = segundosDesde(&t0);
+        descartarCache(caminhoMatriz);
+
+        struct imagemMatriz imagem;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        if (!abrirImagemMatriz(caminhoMatriz, &imagem)) {
+            fprintf(stderr, "Não foi possível gravar ou abrir %s\n", caminhoMatriz);
+            return EXIT_FAILURE;
+        }
+        tempoAbrir = segundosDesde(&t0);
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        achadosImagem[0] = buscarImagemMatriz(&imagem, chaves[0]) != NULL;
+        tempoPrimeira = segundosDesde(&t0);
+
+        nsPonteiros = medirConsultas(consultarMatriz, matriz, chaves, CONSULTAS_MATRIZ, achadosPonteiros);
+        nsImagem = medirConsultas(consultarImagemMatriz, &imagem, chaves, CONSULTAS_MATRIZ, achadosImagem);
+        bool mesmos = memcmp(achadosPonteiros, achadosImagem, CONSULTAS_MATRIZ * sizeof(bool)) == 0;
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        struct diretor *restaurada = restaurarMatriz(&imagem);
+        tempoRestaurar = segundosDesde(&t0);
+        bool igual = iguaisMatriz(matriz, restaurada);
+        imprimirMedidas("Matriz Esparsa", n, tempoInserir, tempoGravar, tamanhoArquivo(caminhoMatriz), tempoAbrir,
+                        tempoPrimeira, nsPonteiros, nsImagem, mesmos, tempoRestaurar, igual);
+        ok = ok && mesmos && igual;
+        fecharImagemMatriz(&imagem);
+        liberarMemoria(restaurada);
+        liberarMemoria(matriz);
+    }
+
+    remove(caminhoAVL);
+    remove(caminhoRN);
+    remove(caminhoMatriz);
+    free(chaves);
+    free(achadosPonteiros);
+    free(achadosImagem);
+    return ok ? 0 : EXIT_FAILURE;
+}
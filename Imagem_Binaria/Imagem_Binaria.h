@@ -0,0 +1,251 @@
+/**
+ * Imagem Binária Mapeável de Estruturas Encadeadas em C
+ *
+ * Formato comum das imagens gravadas por Arvore_AVL.c, Arvore_Rubro_Negra.c
+ * e Matriz_Esparsa.c, para que um programa não precise reconstruir essas
+ * estruturas inserção por inserção a cada execução:
+ * - Cabeçalho de 64 bytes (mágica, versão, tamanho dos registros e
+ *   quantidades), seguido de duas seções de registros de tamanho fixo
+ * - As ligações entre registros são índices, não ponteiros: a imagem vale em
+ *   qualquer endereço em que for mapeada
+ * - A gravação é uma única passada sequencial, com um buffer grande; o
+ *   cabeçalho é completado no fim e o arquivo, escrito com outro nome, vai
+ *   para o disco (fsync) antes de ser renomeado: nem depois de uma queda de
+ *   energia uma imagem pela metade é aberta
+ * - A abertura é um mmap somente leitura: nada é lido do disco até a
+ *   primeira consulta, e só as páginas que as consultas visitam são trazidas
+ *
+ * Todas as funções são static inline, como em Matriz_CSR.h.
+ *
+ * Só para sistemas POSIX (mmap, madvise). As estruturas incluem este
+ * cabeçalho apenas quando compiladas com -DIMAGEM_BINARIA; sem isso elas
+ * continuam sendo C padrão. madvise e MADV_* não fazem parte do POSIX
+ * estrito: o programa precisa de _DEFAULT_SOURCE definido antes do primeiro
+ * #include de sistema. Arvore_AVL.c, Arvore_Rubro_Negra.c e Matriz_Esparsa.c
+ * o definem no topo quando IMAGEM_BINARIA está definido; aqui ele só vale
+ * se este for o primeiro cabeçalho incluído. Sem ele, as dicas de madvise
+ * ficam de fora e o resto funciona igual.
+ */
+
+#ifndef IMAGEM_BINARIA_H
+#define IMAGEM_BINARIA_H
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define VERSAO_IMAGEM 1
+#define SEM_LIGACAO UINT32_MAX          // Índice de "nenhum registro"
+#define BUFFER_IMAGEM (1 << 20)         // Buffer de gravação (1 MB)
+
+// Cabeçalho da imagem binária
+struct cabecalhoImagem {
+    char magica[8];             // Identifica a estrutura ("AVLIMAGE", ...)
+    uint32_t versao;
+    uint32_t tamanhoRegistro;   // Bytes de cada registro da primeira seção
+    uint64_t registros;         // Registros da primeira seção
+    uint64_t extras;            // Registros da segunda seção (0 se não há)
+    uint32_t tamanhoExtra;      // Bytes de cada registro da segunda seção
+    uint32_t raiz;              // Registro raiz (árvores) ou SEM_LIGACAO
+    uint32_t parametro;         // Constante de que a estrutura depende (matriz: MODULO)
+    uint32_t reservado;
+    uint64_t preenchimento[2];  // Completa 64 bytes
+};
+
+// Imagem sendo gravada
+struct gravacaoImagem {
+    FILE *arquivo;
+    char *buffer;
+    const char *caminho;
+    char temporario[4096];
+    bool ok;                    // false depois do primeiro erro de escrita
+};
+
+// Imagem aberta (mapeada somente para leitura)
+struct imagemMapeada {
+    const struct cabecalhoImagem *cabecalho;
+    const char *registros;      // Primeira seção
+    const char *extras;         // Segunda seção
+    void *mapa;
+    size_t tamanho;
+};
+
+/**
+ * Começa a gravar uma imagem: abre o arquivo temporário e reserva o
+ * espaço do cabeçalho
+ * @param g Gravação a iniciar
+ * @param caminho Arquivo da imagem
+ * @return false se o arquivo temporário não pôde ser criado
+ */
+static inline bool iniciarGravacaoImagem(struct gravacaoImagem *g, const char *caminho) {
+    g->caminho = caminho;
+    g->ok = true;
+    if (snprintf(g->temporario, sizeof(g->temporario), "%s.tmp", caminho) >= (int) sizeof(g->temporario)) {
+        return false;
+    }
+    g->arquivo = fopen(g->temporario, "wb");
+    if (g->arquivo == NULL) {
+        return false;
+    }
+    g->buffer = (char *) malloc(BUFFER_IMAGEM);
+    if (g->buffer == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    setvbuf(g->arquivo, g->buffer, _IOFBF, BUFFER_IMAGEM);
+
+    struct cabecalhoImagem vazio;
+    memset(&vazio, 0, sizeof(vazio));
+    g->ok = fwrite(&vazio, sizeof(vazio), 1, g->arquivo) == 1;
+    return true;
+}
+
+/**
+ * Acrescenta um registro à imagem
+ */
+static inline void gravarRegistro(struct gravacaoImagem *g, const void *registro, size_t tamanho) {
+    g->ok = fwrite(registro, tamanho, 1, g->arquivo) == 1 && g->ok;
+}
+
+/**
+ * Completa o cabeçalho, fecha a imagem e a coloca no lugar definitivo
+ * @param g Gravação iniciada com iniciarGravacaoImagem
+ * @param c Cabeçalho (a versão é preenchida aqui)
+ * @return true se a imagem foi gravada inteira
+ */
+static inline bool concluirGravacaoImagem(struct gravacaoImagem *g, struct cabecalhoImagem *c) {
+    c->versao = VERSAO_IMAGEM;
+    bool ok = g->ok && fflush(g->arquivo) == 0 && fseek(g->arquivo, 0, SEEK_SET) == 0 &&
+              fwrite(c, sizeof(*c), 1, g->arquivo) == 1;
+    // Os dados precisam estar no disco antes do rename, senão uma queda de
+    // energia pode deixar o nome definitivo apontando para um arquivo incompleto
+    ok = ok && fflush(g->arquivo) == 0 && fsync(fileno(g->arquivo)) == 0;
+    ok = fclose(g->arquivo) == 0 && ok;
+    free(g->buffer);
+    if (!ok || rename(g->temporario, g->caminho) != 0) {
+        remove(g->temporario);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Mapeia uma imagem e confere o cabeçalho
+ * Só o cabeçalho é lido aqui; as seções são trazidas do disco por página,
+ * conforme as consultas as visitam (MADV_RANDOM evita ler adiante: uma
+ * busca em árvore visita poucas páginas espalhadas).
+ * @param caminho Arquivo da imagem
+ * @param magica Mágica esperada (8 caracteres)
+ * @param tamanhoRegistro Tamanho esperado dos registros da primeira seção
+ * @param tamanhoExtra Tamanho esperado dos registros da segunda seção
+ * @param m Recebe a imagem mapeada
+ * @return false se o arquivo não existe, é de outra estrutura ou está truncado
+ */
+static inline bool mapearImagem(const char *caminho, const char *magica, uint32_t tamanhoRegistro,
+                                uint32_t tamanhoExtra, struct imagemMapeada *m) {
+    int fd = open(caminho, O_RDONLY);
+    struct stat info;
+    if (fd < 0) {
+        return false;
+    }
+    if (fstat(fd, &info) != 0 || (size_t) info.st_size < sizeof(struct cabecalhoImagem)) {
+        close(fd);
+        return false;
+    }
+    size_t tamanho = (size_t) info.st_size;
+    char *mapa = (char *) mmap(NULL, tamanho, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapa == MAP_FAILED) {
+        return false;
+    }
+#ifdef MADV_RANDOM
+    madvise(mapa, tamanho, MADV_RANDOM);  // Só uma dica: sem _DEFAULT_SOURCE, fica de fora
+#endif
+
+    const struct cabecalhoImagem *c = (const struct cabecalhoImagem *) mapa;
+    size_t resto = tamanho - sizeof(struct cabecalhoImagem);
+    bool valida = memcmp(c->magica, magica, 8) == 0 && c->versao == VERSAO_IMAGEM &&
+                  c->tamanhoRegistro == tamanhoRegistro && c->tamanhoExtra == tamanhoExtra &&
+                  c->registros < SEM_LIGACAO && c->registros <= resto / tamanhoRegistro &&
+                  (c->raiz == SEM_LIGACAO || c->raiz < c->registros);
+    if (valida) {
+        resto -= (size_t) c->registros * tamanhoRegistro;
+        valida = tamanhoExtra == 0 ? c->extras == 0 && resto == 0
+                                   : c->extras <= resto / tamanhoExtra && resto == (size_t) c->extras * tamanhoExtra;
+    }
+    if (!valida) {
+        munmap(mapa, tamanho);
+        return false;
+    }
+    m->cabecalho = c;
+    m->registros = mapa + sizeof(struct cabecalhoImagem);
+    m->extras = m->registros + (size_t) c->registros * tamanhoRegistro;
+    m->mapa = mapa;
+    m->tamanho = tamanho;
+    return true;
+}
+
+/**
+ * Confere que as ligações de uma imagem de árvore formam uma árvore
+ * Os registros estão em pós-ordem: cada filho vem antes do pai, nenhum nó
+ * tem dois pais e a raiz é o último registro. Lê a seção inteira; as buscas
+ * não precisam disso, só quem vai reconstruir ponteiros a partir da imagem.
+ * @param ligacoes Filho esquerdo do registro 0 (o direito vem logo depois)
+ * @param passo Distância entre registros, em uint32_t
+ * @param quantidade Número de registros
+ * @param raiz Registro raiz
+ * @return true se as ligações formam uma árvore
+ */
+static inline bool conferirArvoreImagem(const uint32_t *ligacoes, size_t passo, uint32_t quantidade, uint32_t raiz) {
+    if (quantidade == 0) {
+        return raiz == SEM_LIGACAO;
+    }
+    if (raiz != quantidade - 1) {
+        return false;
+    }
+    bool *temPai = (bool *) calloc(quantidade, sizeof(bool));
+    if (temPai == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    uint32_t filhos = 0;
+    bool valida = true;
+    for (uint32_t i = 0; i < quantidade && valida; i++) {
+        for (int lado = 0; lado < 2; lado++) {
+            uint32_t filho = ligacoes[i * passo + lado];
+            if (filho == SEM_LIGACAO) {
+                continue;
+            }
+            if (filho >= i || temPai[filho]) {
+                valida = false;
+                break;
+            }
+            temPai[filho] = true;
+            filhos++;
+        }
+    }
+    free(temPai);
+    return valida && filhos == quantidade - 1;
+}
+
+/**
+ * Desfaz o mapeamento de uma imagem
+ */
+static inline void desmapearImagem(struct imagemMapeada *m) {
+    if (m->mapa != NULL) {
+        munmap(m->mapa, m->tamanho);
+        m->mapa = NULL;
+    }
+}
+
+#endif
@@ -7,111 +7,145 @@
  * - Não há nó anterior (encadeamento simples)
  * 
  * Características principais:
- * - Inserção sempre no final da lista
+ * - A lista é representada pelo seu último nó: o primeiro é ultimo->proximo,
+ *   então inserir no final e remover do início são O(1), sem percorrer o anel
+ * - Rotacionar (o primeiro passa a ser o último) também é O(1), o que faz da
+ *   lista um rodízio: remover do início e reinserir no final
  * - Remoção de qualquer elemento
  * - Mantém circularidade da lista
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include "../Alocador_Nos/Alocador_Nos.h"
 
 struct no {
     int numero;
     struct no *proximo;
 };
 
+// Alocador dos nós (caches por thread, ver Alocador_Nos.h)
+static struct alocadorNos alocadorListaCircular = ALOCADOR_NOS_INICIALIZADOR(struct no);
+
 /**
- * Insere um novo número no final da lista
- * @param cabeca Ponteiro para o início da lista
+ * Insere um novo número no final da lista em O(1)
+ * @param ultimo Ponteiro para o último nó da lista
  * @param numero Valor a ser inserido
- * @return Ponteiro para o início da lista
+ * @return Ponteiro para o novo último nó
  */
-struct no *inserir(struct no *cabeca, int numero) {
-    struct no *novoNo = (struct no *) malloc(sizeof(struct no));
+struct no *inserir(struct no *ultimo, int numero) {
+    struct no *novoNo = (struct no *) alocarNo(&alocadorListaCircular);
     novoNo->numero = numero;
-    novoNo->proximo = NULL;
 
     // Lista vazia: novo nó aponta para si mesmo
-    if (cabeca == NULL) {
+    if (ultimo == NULL) {
         novoNo->proximo = novoNo;
         return novoNo;
     }
 
-    // Inserção no final: percorre até o último nó
-    struct no *ultimo = cabeca;
-    while (ultimo->proximo != cabeca) {
+    // Entra entre o último e o primeiro e passa a ser o último
+    novoNo->proximo = ultimo->proximo;
+    ultimo->proximo = novoNo;
+    return novoNo;
+}
+
+/**
+ * Remove o primeiro elemento da lista em O(1)
+ * @param ultimo Ponteiro para o último nó da lista
+ * @param numero Recebe o valor removido (pode ser NULL)
+ * @return Ponteiro para o último nó da lista
+ */
+struct no *removerInicio(struct no *ultimo, int *numero) {
+    if (ultimo == NULL) {
+        return NULL;
+    }
+
+    struct no *primeiro = ultimo->proximo;
+    if (numero != NULL) {
+        *numero = primeiro->numero;
+    }
+
+    // Caso especial: lista com um único elemento
+    if (primeiro == ultimo) {
+        liberarNo(&alocadorListaCircular, primeiro);
+        return NULL;
+    }
+
+    ultimo->proximo = primeiro->proximo;
+    liberarNo(&alocadorListaCircular, primeiro);
+    return ultimo;
+}
+
+/**
+ * Rotaciona a lista: o primeiro elemento passa a ser o último, em O(1)
+ * @param ultimo Ponteiro para o último nó da lista
+ * @param passos Quantidade de rotações
+ * @return Ponteiro para o novo último nó
+ */
+struct no *rotacionar(struct no *ultimo, int passos) {
+    if (ultimo == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < passos; i++) {
         ultimo = ultimo->proximo;
     }
-    
-    ultimo->proximo = novoNo;
-    novoNo->proximo = cabeca;
-    return cabeca;
+    return ultimo;
 }
 
 /**
  * Remove um número específico da lista
- * @param cabeca Ponteiro para o início da lista
+ * @param ultimo Ponteiro para o último nó da lista
  * @param numero Valor a ser removido
- * @return Ponteiro para o início da lista
+ * @return Ponteiro para o último nó da lista
  */
-struct no *remover(struct no *cabeca, int numero) {
-    if (cabeca == NULL) {
+struct no *remover(struct no *ultimo, int numero) {
+    if (ultimo == NULL) {
         return NULL;
     }
 
-    // Remoção do primeiro elemento
-    if (cabeca->numero == numero) {
-        // Caso especial: lista com um único elemento
-        if (cabeca == cabeca->proximo) {
-            free(cabeca);
-            return NULL;
-        }
-        
-        // Lista com mais elementos
-        struct no *ultimo = cabeca;
-        while (ultimo->proximo != cabeca) {
-            ultimo = ultimo->proximo;
+    // Busca o elemento anterior ao que será removido, a partir do último
+    struct no *anterior = ultimo;
+    do {
+        if (anterior->proximo->numero == numero) {
+            break;
         }
-        
-        struct no *novoInicio = cabeca->proximo;
-        ultimo->proximo = novoInicio;
-        free(cabeca);
-        return novoInicio;
-    }
-
-    // Busca o elemento anterior ao que será removido
-    struct no *anterior = cabeca;
-    while (anterior->proximo != cabeca && 
-           anterior->proximo->numero != numero) {
         anterior = anterior->proximo;
-    }
+    } while (anterior != ultimo);
 
     // Elemento não encontrado
-    if (anterior->proximo == cabeca) {
-        return cabeca;
+    if (anterior->proximo->numero != numero) {
+        return ultimo;
+    }
+
+    // Remoção do primeiro elemento
+    if (anterior == ultimo) {
+        return removerInicio(ultimo, NULL);
     }
 
-    // Remove o nó encontrado
+    // Remove o nó encontrado; se era o último, o anterior assume o posto
     struct no *remover = anterior->proximo;
     anterior->proximo = remover->proximo;
-    free(remover);
-    return cabeca;
+    if (remover == ultimo) {
+        ultimo = anterior;
+    }
+    liberarNo(&alocadorListaCircular, remover);
+    return ultimo;
 }
 
 /**
- * Imprime todos os elementos da lista
- * @param cabeca Ponteiro para o início da lista
+ * Imprime todos os elementos da lista, do primeiro ao último
+ * @param ultimo Ponteiro para o último nó da lista
  */
-void imprimir(struct no *cabeca) {
-    if (cabeca == NULL) {
+void imprimir(struct no *ultimo) {
+    if (ultimo == NULL) {
         return;
     }
 
-    struct no *atual = cabeca;
+    struct no *atual = ultimo->proximo;
     do {
         printf("%d\n", atual->numero);
         atual = atual->proximo;
-    } while (atual != cabeca);
+    } while (atual != ultimo->proximo);
 }
 
 /**
@@ -127,6 +161,7 @@ int menu() {
     printf("| 2 - Remover     |\n");
     printf("| 3 - Imprimir    |\n");
     printf("| 4 - Sair        |\n");
+    printf("| 5 - Rotacionar  |\n");
     printf("--------------------\n");
     printf("Digite sua opcao: ");
     scanf("%d", &opcao);
@@ -134,7 +169,7 @@ int menu() {
 }
 
 int main() {
-    struct no *cabeca = NULL;
+    struct no *ultimo = NULL;
     int opcao = 0;
     int numero;
 
@@ -144,15 +179,20 @@ int main() {
             case 1:
                 printf("Digite o numero a inserir: ");
                 scanf("%d", &numero);
-                cabeca = inserir(cabeca, numero);
+                ultimo = inserir(ultimo, numero);
                 break;
             case 2:
                 printf("Digite o numero a remover: ");
                 scanf("%d", &numero);
-                cabeca = remover(cabeca, numero);
+                ultimo = remover(ultimo, numero);
                 break;
             case 3:
-                imprimir(cabeca);
+                imprimir(ultimo);
+                break;
+            case 5:
+                printf("Digite quantas posicoes rotacionar: ");
+                scanf("%d", &numero);
+                ultimo = rotacionar(ultimo, numero);
                 break;
         }
     }
@@ -0,0 +1,478 @@
+/**
+ * Implementação de Roda de Temporizadores Hierárquica com Listas Circulares em C
+ *
+ * Este código implementa uma fila de temporizadores (timeouts), onde:
+ * - O tempo é contado em ticks; a roda tem NIVEIS níveis de 256 posições, e
+ *   cada posição do nível i cobre 256^i ticks (o nível 0 cobre um tick)
+ * - Cada posição é uma lista circular duplamente encadeada com nó sentinela,
+ *   então inserir e cancelar um temporizador são O(1): não há busca nem
+ *   ordenação, só ligar/desligar o nó
+ * - Um temporizador entra no nível mais baixo cujo alcance cobre o seu
+ *   prazo. Quando o nível 0 dá a volta, a posição correspondente do nível 1
+ *   é redistribuída para baixo (cascata), e assim por diante; cada
+ *   temporizador desce no máximo NIVEIS - 1 vezes, o que dá custo amortizado
+ *   O(1) por tick e por temporizador
+ * - Os temporizadores vencidos em um tick são entregues em lotes a uma
+ *   função de expiração, e não um por chamada
+ *
+ * O main compara com uma fila de prioridade em heap binário (inserção e
+ * cancelamento O(log n)) com 10^6 temporizadores pendentes, ou a quantidade
+ * passada na linha de comando (ex.: 10000000).
+ *
+ *   gcc -O2 -pthread Roda_Temporizadores.c -o roda_temporizadores
+ *   ./roda_temporizadores [temporizadores]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "../Alocador_Nos/Alocador_Nos.h"
+
+#define BITS_NIVEL 8
+#define POSICOES (1 << BITS_NIVEL)
+#define NIVEIS 4                  // Alcance de 256^4 = 2^32 ticks
+#define TAMANHO_LOTE 64
+
+// Temporizador: nó das listas circulares da roda
+struct temporizador {
+    uint64_t expira;              // Tick em que vence
+    int id;
+    struct temporizador *anterior;
+    struct temporizador *proximo;
+};
+
+// Função de expiração: recebe um lote de temporizadores vencidos
+typedef void (*expiracao)(struct temporizador **lote, size_t quantidade, void *contexto);
+
+// Estrutura da roda
+struct rodaTemporizadores {
+    uint64_t agora;                                  // Último tick processado
+    size_t pendentes;
+    struct temporizador posicoes[NIVEIS][POSICOES];  // Sentinelas das listas circulares
+    expiracao funcao;
+    void *contexto;
+};
+
+static struct alocadorNos alocadorTemporizadores = ALOCADOR_NOS_INICIALIZADOR(struct temporizador);
+
+/**
+ * Liga um temporizador no fim da lista circular de uma sentinela
+ */
+static inline void ligar(struct temporizador *sentinela, struct temporizador *t) {
+    t->proximo = sentinela;
+    t->anterior = sentinela->anterior;
+    sentinela->anterior->proximo = t;
+    sentinela->anterior = t;
+}
+
+/**
+ * Desliga um temporizador da lista circular em que está
+ */
+static inline void desligar(struct temporizador *t) {
+    t->anterior->proximo = t->proximo;
+    t->proximo->anterior = t->anterior;
+    t->anterior = NULL;
+    t->proximo = NULL;
+}
+
+/**
+ * Escolhe a posição da roda para um temporizador conforme seu prazo
+ * @param roda Ponteiro para a roda
+ * @param t Temporizador (expira >= roda->agora)
+ */
+static void posicionar(struct rodaTemporizadores *roda, struct temporizador *t) {
+    uint64_t prazo = t->expira - roda->agora;
+
+    for (int nivel = 0; nivel < NIVEIS; nivel++) {
+        if (prazo < ((uint64_t) 1 << (BITS_NIVEL * (nivel + 1)))) {
+            size_t posicao = (size_t) (t->expira >> (BITS_NIVEL * nivel)) & (POSICOES - 1);
+            ligar(&roda->posicoes[nivel][posicao], t);
+            return;
+        }
+    }
+
+    // Além do alcance: fica na última posição do nível mais alto e volta a
+    // ser posicionado a cada cascata até entrar no alcance
+    size_t posicao = (size_t) ((roda->agora >> (BITS_NIVEL * (NIVEIS - 1))) - 1) & (POSICOES - 1);
+    ligar(&roda->posicoes[NIVEIS - 1][posicao], t);
+}
+
+/**
+ * Cria uma roda vazia
+ * @param funcao Função chamada com os lotes de temporizadores vencidos
+ * @param contexto Repassado para a função
+ * @return Ponteiro para a nova roda
+ */
+struct rodaTemporizadores *criarRoda(expiracao funcao, void *contexto) {
+    struct rodaTemporizadores *roda = (struct rodaTemporizadores *) malloc(sizeof(struct rodaTemporizadores));
+    if (roda == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    roda->agora = 0;
+    roda->pendentes = 0;
+    roda->funcao = funcao;
+    roda->contexto = contexto;
+    for (int nivel = 0; nivel < NIVEIS; nivel++) {
+        for (int i = 0; i < POSICOES; i++) {
+            roda->posicoes[nivel][i].anterior = &roda->posicoes[nivel][i];
+            roda->posicoes[nivel][i].proximo = &roda->posicoes[nivel][i];
+        }
+    }
+    return roda;
+}
+
+/**
+ * Agenda um temporizador em O(1)
+ * @param roda Ponteiro para a roda
+ * @param ticks Ticks a partir de agora (0 vence no próximo tick)
+ * @param id Identificador entregue na expiração
+ * @return Temporizador, usado para cancelar
+ */
+struct temporizador *agendar(struct rodaTemporizadores *roda, uint64_t ticks, int id) {
+    struct temporizador *t = (struct temporizador *) alocarNo(&alocadorTemporizadores);
+    t->expira = roda->agora + (ticks == 0 ? 1 : ticks);
+    t->id = id;
+    posicionar(roda, t);
+    roda->pendentes++;
+    return t;
+}
+
+/**
+ * Cancela um temporizador pendente em O(1)
+ * @param roda Ponteiro para a roda
+ * @param t Temporizador devolvido por agendar (ainda não vencido)
+ */
+void cancelar(struct rodaTemporizadores *roda, struct temporizador *t) {
+    desligar(t);
+    liberarNo(&alocadorTemporizadores, t);
+    roda->pendentes--;
+}
+
+/**
+ * Redistribui uma posição de um nível alto para os níveis de baixo
+ */
+static void cascata(struct rodaTemporizadores *roda, int nivel, size_t posicao) {
+    struct temporizador *sentinela = &roda->posicoes[nivel][posicao];
+    struct temporizador *atual = sentinela->proximo;
+
+    sentinela->anterior = sentinela;
+    sentinela->proximo = sentinela;
+    while (atual != sentinela) {
+        struct temporizador *seguinte = atual->proximo;
+        posicionar(roda, atual);
+        atual = seguinte;
+    }
+}
+
+/**
+ * Processa um tick: cascatas necessárias e expiração da posição atual
+ * @param roda Ponteiro para a roda
+ * @return Quantidade de temporizadores vencidos
+ */
+size_t tick(struct rodaTemporizadores *roda) {
+    roda->agora++;
+
+    // Níveis de cima primeiro, para o que descer já cair na posição certa
+    for (int nivel = NIVEIS - 1; nivel >= 1; nivel--) {
+        uint64_t mascara = ((uint64_t) 1 << (BITS_NIVEL * nivel)) - 1;
+        if ((roda->agora & mascara) == 0) {
+            cascata(roda, nivel, (size_t) (roda->agora >> (BITS_NIVEL * nivel)) & (POSICOES - 1));
+        }
+    }
+
+    // Retira a lista inteira da posição e a entrega em lotes
+    struct temporizador *sentinela = &roda->posicoes[0][roda->agora & (POSICOES - 1)];
+    struct temporizador *atual = sentinela->proximo;
+    sentinela->anterior = sentinela;
+    sentinela->proximo = sentinela;
+
+    struct temporizador *lote[TAMANHO_LOTE];
+    size_t quantidade = 0, vencidos = 0;
+    while (atual != sentinela) {
+        struct temporizador *seguinte = atual->proximo;
+        atual->anterior = NULL;
+        atual->proximo = NULL;
+        lote[quantidade++] = atual;
+        if (quantidade == TAMANHO_LOTE || seguinte == sentinela) {
+            roda->funcao(lote, quantidade, roda->contexto);
+            for (size_t i = 0; i < quantidade; i++) {
+                liberarNo(&alocadorTemporizadores, lote[i]);
+            }
+            vencidos += quantidade;
+            quantidade = 0;
+        }
+        atual = seguinte;
+    }
+    roda->pendentes -= vencidos;
+    return vencidos;
+}
+
+/**
+ * Libera a roda e os temporizadores pendentes
+ * @param roda Ponteiro para a roda
+ */
+void liberarRoda(struct rodaTemporizadores *roda) {
+    for (int nivel = 0; nivel < NIVEIS; nivel++) {
+        for (int i = 0; i < POSICOES; i++) {
+            struct temporizador *sentinela = &roda->posicoes[nivel][i];
+            while (sentinela->proximo != sentinela) {
+                struct temporizador *t = sentinela->proximo;
+                desligar(t);
+                liberarNo(&alocadorTemporizadores, t);
+            }
+        }
+    }
+    free(roda);
+}
+
+// Temporizador da fila em heap, usada como referência na comparação
+struct temporizadorHeap {
+    uint64_t expira;
+    int id;
+    size_t posicao;               // Índice no heap, para cancelar
+};
+
+// Fila de prioridade em heap binário de mínimo
+struct heapTemporizadores {
+    struct temporizadorHeap **itens;
+    size_t tamanho;
+    size_t capacidade;
+    uint64_t agora;
+};
+
+/**
+ * Troca dois itens do heap atualizando suas posições
+ */
+static inline void trocarHeap(struct heapTemporizadores *h, size_t a, size_t b) {
+    struct temporizadorHeap *t = h->itens[a];
+    h->itens[a] = h->itens[b];
+    h->itens[b] = t;
+    h->itens[a]->posicao = a;
+    h->itens[b]->posicao = b;
+}
+
+/**
+ * Sobe um item até a posição correta
+ */
+static void subirHeap(struct heapTemporizadores *h, size_t i) {
+    while (i > 0 && h->itens[(i - 1) / 2]->expira > h->itens[i]->expira) {
+        trocarHeap(h, i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+/**
+ * Desce um item até a posição correta
+ */
+static void descerHeap(struct heapTemporizadores *h, size_t i) {
+    for (;;) {
+        size_t menor = i, esquerda = 2 * i + 1, direita = 2 * i + 2;
+        if (esquerda < h->tamanho && h->itens[esquerda]->expira < h->itens[menor]->expira) {
+            menor = esquerda;
+        }
+        if (direita < h->tamanho && h->itens[direita]->expira < h->itens[menor]->expira) {
+            menor = direita;
+        }
+        if (menor == i) {
+            return;
+        }
+        trocarHeap(h, i, menor);
+        i = menor;
+    }
+}
+
+/**
+ * Agenda um temporizador no heap em O(log n)
+ */
+struct temporizadorHeap *agendarHeap(struct heapTemporizadores *h, uint64_t ticks, int id) {
+    if (h->tamanho == h->capacidade) {
+        h->capacidade = h->capacidade ? 2 * h->capacidade : 1024;
+        h->itens = (struct temporizadorHeap **) realloc(h->itens, h->capacidade * sizeof(struct temporizadorHeap *));
+        if (h->itens == NULL) {
+            fprintf(stderr, "Erro na alocação de memória.\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    struct temporizadorHeap *t = (struct temporizadorHeap *) malloc(sizeof(struct temporizadorHeap));
+    if (t == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    t->expira = h->agora + (ticks == 0 ? 1 : ticks);
+    t->id = id;
+    t->posicao = h->tamanho;
+    h->itens[h->tamanho++] = t;
+    subirHeap(h, t->posicao);
+    return t;
+}
+
+/**
+ * Remove o item de uma posição do heap em O(log n)
+ */
+static void removerPosicaoHeap(struct heapTemporizadores *h, size_t i) {
+    h->tamanho--;
+    if (i != h->tamanho) {
+        h->itens[i] = h->itens[h->tamanho];
+        h->itens[i]->posicao = i;
+        subirHeap(h, i);
+        descerHeap(h, h->itens[i]->posicao);
+    }
+}
+
+/**
+ * Cancela um temporizador do heap em O(log n)
+ */
+void cancelarHeap(struct heapTemporizadores *h, struct temporizadorHeap *t) {
+    removerPosicaoHeap(h, t->posicao);
+    free(t);
+}
+
+/**
+ * Processa um tick do heap, retirando os vencidos pelo topo
+ */
+size_t tickHeap(struct heapTemporizadores *h, unsigned long *soma) {
+    size_t vencidos = 0;
+    h->agora++;
+    while (h->tamanho > 0 && h->itens[0]->expira <= h->agora) {
+        struct temporizadorHeap *t = h->itens[0];
+        *soma += (unsigned long) t->id;
+        removerPosicaoHeap(h, 0);
+        free(t);
+        vencidos++;
+    }
+    return vencidos;
+}
+
+/**
+ * Função de expiração de exemplo: imprime o lote
+ */
+static void imprimirLote(struct temporizador **lote, size_t quantidade, void *contexto) {
+    const struct rodaTemporizadores *const *roda = (const struct rodaTemporizadores *const *) contexto;
+    printf("Tick %llu:", (unsigned long long) (*roda)->agora);
+    for (size_t i = 0; i < quantidade; i++) {
+        printf(" %d", lote[i]->id);
+    }
+    printf("\n");
+}
+
+/**
+ * Função de expiração do teste: soma os ids e confere o tick de vencimento
+ */
+struct contagem {
+    unsigned long soma;
+    unsigned long atrasados;
+    const struct rodaTemporizadores *roda;
+};
+
+static void somarLote(struct temporizador **lote, size_t quantidade, void *contexto) {
+    struct contagem *c = (struct contagem *) contexto;
+    for (size_t i = 0; i < quantidade; i++) {
+        c->soma += (unsigned long) lote[i]->id;
+        c->atrasados += lote[i]->expira != c->roda->agora;
+    }
+}
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+int main(int argc, char *argv[]) {
+    int total = argc > 1 ? atoi(argv[1]) : 1000000;
+    const uint64_t horizonte = 1 << 20;   // Prazos sorteados em [1, horizonte]
+    struct timespec t0;
+
+    // Exemplo de uso
+    struct rodaTemporizadores *exemplo = NULL;
+    struct rodaTemporizadores *roda = criarRoda(imprimirLote, &exemplo);
+    exemplo = roda;
+    agendar(roda, 3, 1);
+    struct temporizador *cancelado = agendar(roda, 3, 2);
+    agendar(roda, 3, 3);
+    agendar(roda, 300, 4);
+    agendar(roda, 70000, 5);
+    cancelar(roda, cancelado);
+    while (roda->pendentes > 0) {
+        tick(roda);
+    }
+    liberarRoda(roda);
+
+    // Prazos e cancelamentos sorteados, iguais para as duas estruturas
+    uint64_t *prazos = (uint64_t *) malloc((size_t) total * sizeof(uint64_t));
+    struct temporizador **handles = (struct temporizador **) malloc((size_t) total * sizeof(struct temporizador *));
+    struct temporizadorHeap **handlesHeap = (struct temporizadorHeap **) malloc((size_t) total * sizeof(struct temporizadorHeap *));
+    if (prazos == NULL || handles == NULL || handlesHeap == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        return EXIT_FAILURE;
+    }
+    uint64_t x = 0x9E3779B97F4A7C15ull;
+    for (int i = 0; i < total; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        prazos[i] = 1 + x % horizonte;
+    }
+
+    printf("\n%d temporizadores, prazos em [1, %llu] ticks, 1 em 10 cancelados\n",
+           total, (unsigned long long) horizonte);
+    printf("%-18s %12s %12s %14s %12s\n", "Estrutura", "Agendar", "Cancelar", "Expirar tudo", "Soma ids");
+
+    // Roda de temporizadores
+    struct contagem contagem = {0, 0, NULL};
+    roda = criarRoda(somarLote, &contagem);
+    contagem.roda = roda;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < total; i++) {
+        handles[i] = agendar(roda, prazos[i], i);
+    }
+    double tempoAgendar = segundosDesde(&t0);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < total; i += 10) {
+        cancelar(roda, handles[i]);
+    }
+    double tempoCancelar = segundosDesde(&t0);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    while (roda->pendentes > 0) {
+        tick(roda);
+    }
+    double tempoExpirar = segundosDesde(&t0);
+    printf("%-18s %9.1f ns %9.1f ns %12.3f s %12lu%s\n", "Roda hierarquica",
+           tempoAgendar * 1e9 / total, tempoCancelar * 1e9 / ((total + 9) / 10), tempoExpirar,
+           contagem.soma, contagem.atrasados ? " (VENCIMENTO ERRADO)" : "");
+    liberarRoda(roda);
+
+    // Heap binário
+    struct heapTemporizadores heap = {NULL, 0, 0, 0};
+    unsigned long somaHeap = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < total; i++) {
+        handlesHeap[i] = agendarHeap(&heap, prazos[i], i);
+    }
+    tempoAgendar = segundosDesde(&t0);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < total; i += 10) {
+        cancelarHeap(&heap, handlesHeap[i]);
+    }
+    tempoCancelar = segundosDesde(&t0);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    while (heap.tamanho > 0) {
+        tickHeap(&heap, &somaHeap);
+    }
+    tempoExpirar = segundosDesde(&t0);
+    printf("%-18s %9.1f ns %9.1f ns %12.3f s %12lu\n", "Heap binario",
+           tempoAgendar * 1e9 / total, tempoCancelar * 1e9 / ((total + 9) / 10), tempoExpirar, somaHeap);
+    free(heap.itens);
+
+    free(prazos);
+    free(handles);
+    free(handlesHeap);
+    destruirAlocador(&alocadorTemporizadores);
+    return 0;
+}
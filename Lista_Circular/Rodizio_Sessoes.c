@@ -0,0 +1,376 @@
+/**
+ * Implementação de Rodízio de Sessões com Lista Circular Duplamente Encadeada em C
+ *
+ * Este código implementa o rodízio (round-robin) de sessões ativas, onde:
+ * - As sessões formam um anel duplamente encadeado e um cursor aponta para
+ *   a próxima a ser atendida; o nó que está logo antes do cursor é o fim do
+ *   rodízio
+ * - Adicionar uma sessão (no fim do rodízio), avançar o cursor e remover uma
+ *   sessão pelo seu nó (handle) são O(1), sem percorrer o anel
+ * - Uma tabela hash de endereçamento aberto leva do id da sessão ao nó, para
+ *   remover ou consultar pelo id em O(1)
+ * - A cada tick, visitarLote avança k posições chamando uma função para cada
+ *   sessão visitada, que pode pedir a remoção da sessão. O custo do tick
+ *   depende só de k, e não da quantidade de sessões no anel
+ *
+ * O main mede o custo por tick com 10^3 a 10^6 sessões. O número de passos
+ * por tick é o mesmo em todos os tamanhos; a diferença que sobra vem das
+ * faltas de cache de um anel que não cabe mais na cache.
+ *
+ *   gcc -O2 -pthread Rodizio_Sessoes.c -o rodizio_sessoes
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "../Alocador_Nos/Alocador_Nos.h"
+
+// Sessão no anel
+struct sessao {
+    int id;
+    unsigned long visitas;
+    struct sessao *anterior;
+    struct sessao *proximo;
+};
+
+// Estrutura do rodízio
+struct rodizio {
+    struct sessao *cursor;           // Próxima sessão a ser visitada
+    size_t tamanho;
+    struct sessao **tabela;          // Índice hash: id -> sessão (NULL = vazio)
+    size_t capacidadeTabela;         // Potência de 2
+};
+
+// Função chamada para cada sessão visitada; retorna false para remover a sessão
+typedef bool (*visitante)(struct sessao *sessao, void *contexto);
+
+static struct alocadorNos alocadorSessoes = ALOCADOR_NOS_INICIALIZADOR(struct sessao);
+
+/**
+ * Espalha os bits do id (finalizador do MurmurHash3)
+ * @param id Id da sessão
+ * @return Hash do id
+ */
+static inline uint32_t hashId(int id) {
+    uint32_t h = (uint32_t) id;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/**
+ * Procura a posição de um id na tabela
+ * @param r Ponteiro para o rodízio
+ * @param id Id procurado
+ * @return Posição do id ou da primeira posição vazia da sondagem
+ */
+static inline size_t posicaoTabela(const struct rodizio *r, int id) {
+    size_t mascara = r->capacidadeTabela - 1;
+    size_t i = hashId(id) & mascara;
+    while (r->tabela[i] != NULL && r->tabela[i]->id != id) {
+        i = (i + 1) & mascara;
+    }
+    return i;
+}
+
+/**
+ * Remove o id da posição i, deslocando para trás os ids seguintes
+ * para que nenhuma sondagem seja interrompida (sem marcas de remoção)
+ * @param r Ponteiro para o rodízio
+ * @param i Posição ocupada a esvaziar
+ */
+static void esvaziarPosicao(struct rodizio *r, size_t i) {
+    size_t mascara = r->capacidadeTabela - 1;
+    size_t j = i;
+    for (;;) {
+        r->tabela[i] = NULL;
+        for (;;) {
+            j = (j + 1) & mascara;
+            if (r->tabela[j] == NULL) {
+                return;
+            }
+            size_t ideal = hashId(r->tabela[j]->id) & mascara;
+            // O id em j pode ocupar i se i estiver entre sua posição ideal e j
+            if (((j - ideal) & mascara) >= ((j - i) & mascara)) {
+                break;
+            }
+        }
+        r->tabela[i] = r->tabela[j];
+        i = j;
+    }
+}
+
+/**
+ * Dobra a tabela hash e reinsere as sessões
+ * @param r Ponteiro para o rodízio
+ */
+static void crescerTabela(struct rodizio *r) {
+    struct sessao **antiga = r->tabela;
+    size_t capacidadeAntiga = r->capacidadeTabela;
+
+    r->capacidadeTabela *= 2;
+    r->tabela = (struct sessao **) calloc(r->capacidadeTabela, sizeof(struct sessao *));
+    if (r->tabela == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < capacidadeAntiga; i++) {
+        if (antiga[i] != NULL) {
+            r->tabela[posicaoTabela(r, antiga[i]->id)] = antiga[i];
+        }
+    }
+    free(antiga);
+}
+
+/**
+ * Cria um rodízio vazio
+ * @param capacidadeInicial Quantidade de sessões esperada (a tabela cresce se preciso)
+ * @return Ponteiro para o novo rodízio
+ */
+struct rodizio *criarRodizio(size_t capacidadeInicial) {
+    struct rodizio *r = (struct rodizio *) malloc(sizeof(struct rodizio));
+    if (r == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    r->cursor = NULL;
+    r->tamanho = 0;
+    r->capacidadeTabela = 16;
+    while (r->capacidadeTabela < 2 * capacidadeInicial) {
+        r->capacidadeTabela *= 2;
+    }
+    r->tabela = (struct sessao **) calloc(r->capacidadeTabela, sizeof(struct sessao *));
+    if (r->tabela == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    return r;
+}
+
+/**
+ * Busca uma sessão pelo id
+ * @param r Ponteiro para o rodízio
+ * @param id Id da sessão
+ * @return Nó da sessão ou NULL
+ */
+struct sessao *buscarSessao(const struct rodizio *r, int id) {
+    return r->tabela[posicaoTabela(r, id)];
+}
+
+/**
+ * Adiciona uma sessão no fim do rodízio (logo antes do cursor)
+ * @param r Ponteiro para o rodízio
+ * @param id Id da sessão
+ * @return Nó da sessão, usado como handle; NULL se o id já existe
+ */
+struct sessao *adicionarSessao(struct rodizio *r, int id) {
+    size_t posicao = posicaoTabela(r, id);
+    if (r->tabela[posicao] != NULL) {
+        return NULL;
+    }
+
+    struct sessao *nova = (struct sessao *) alocarNo(&alocadorSessoes);
+    nova->id = id;
+    nova->visitas = 0;
+
+    if (r->cursor == NULL) {
+        nova->anterior = nova;
+        nova->proximo = nova;
+        r->cursor = nova;
+    } else {
+        nova->proximo = r->cursor;
+        nova->anterior = r->cursor->anterior;
+        r->cursor->anterior->proximo = nova;
+        r->cursor->anterior = nova;
+    }
+
+    r->tabela[posicao] = nova;
+    r->tamanho++;
+    if (2 * r->tamanho > r->capacidadeTabela) {
+        crescerTabela(r);
+    }
+    return nova;
+}
+
+/**
+ * Remove uma sessão pelo seu nó em O(1)
+ * @param r Ponteiro para o rodízio
+ * @param sessao Nó da sessão (handle devolvido por adicionarSessao)
+ */
+void removerSessao(struct rodizio *r, struct sessao *sessao) {
+    esvaziarPosicao(r, posicaoTabela(r, sessao->id));
+
+    if (sessao->proximo == sessao) {
+        r->cursor = NULL;
+    } else {
+        sessao->anterior->proximo = sessao->proximo;
+        sessao->proximo->anterior = sessao->anterior;
+        if (r->cursor == sessao) {
+            r->cursor = sessao->proximo;
+        }
+    }
+
+    liberarNo(&alocadorSessoes, sessao);
+    r->tamanho--;
+}
+
+/**
+ * Remove uma sessão pelo id em O(1)
+ * @param r Ponteiro para o rodízio
+ * @param id Id da sessão
+ * @return true se a sessão existia
+ */
+bool removerSessaoPorId(struct rodizio *r, int id) {
+    struct sessao *sessao = buscarSessao(r, id);
+    if (sessao == NULL) {
+        return false;
+    }
+    removerSessao(r, sessao);
+    return true;
+}
+
+/**
+ * Avança o cursor uma posição e devolve a sessão que estava nele
+ * @param r Ponteiro para o rodízio
+ * @return Sessão atendida ou NULL se o rodízio estiver vazio
+ */
+struct sessao *avancar(struct rodizio *r) {
+    struct sessao *atual = r->cursor;
+    if (atual != NULL) {
+        r->cursor = atual->proximo;
+        atual->visitas++;
+    }
+    return atual;
+}
+
+/**
+ * Visita as próximas k sessões do rodízio, avançando o cursor
+ * A função pode devolver false para remover a sessão visitada; nesse caso
+ * o cursor segue para a sessão seguinte normalmente.
+ * @param r Ponteiro para o rodízio
+ * @param k Quantidade de sessões a visitar (limitada ao tamanho do anel)
+ * @param funcao Função chamada para cada sessão
+ * @param contexto Repassado para a função
+ * @return Quantidade de sessões visitadas
+ */
+size_t visitarLote(struct rodizio *r, size_t k, visitante funcao, void *contexto) {
+    if (k > r->tamanho) {
+        k = r->tamanho;
+    }
+    for (size_t i = 0; i < k; i++) {
+        struct sessao *atual = avancar(r);
+        if (!funcao(atual, contexto)) {
+            removerSessao(r, atual);
+        }
+    }
+    return k;
+}
+
+/**
+ * Imprime as sessões na ordem em que serão atendidas
+ * @param r Ponteiro para o rodízio
+ */
+void imprimir(const struct rodizio *r) {
+    if (r->cursor == NULL) {
+        printf("(vazio)\n");
+        return;
+    }
+    struct sessao *atual = r->cursor;
+    do {
+        printf("%d(%lu) ", atual->id, atual->visitas);
+        atual = atual->proximo;
+    } while (atual != r->cursor);
+    printf("\n");
+}
+
+/**
+ * Libera toda a memória do rodízio
+ * @param r Ponteiro para o rodízio
+ */
+void liberarRodizio(struct rodizio *r) {
+    while (r->cursor != NULL) {
+        removerSessao(r, r->cursor);
+    }
+    free(r->tabela);
+    free(r);
+}
+
+/**
+ * Visitante de exemplo: encerra a sessão após três visitas
+ */
+static bool encerrarAposTres(struct sessao *sessao, void *contexto) {
+    (void) contexto;
+    return sessao->visitas < 3;
+}
+
+/**
+ * Visitante do teste: acumula os ids e encerra ~1 a cada 1024 visitas
+ */
+static bool atenderSessao(struct sessao *sessao, void *contexto) {
+    unsigned long *soma = (unsigned long *) contexto;
+    *soma += (unsigned long) sessao->id;
+    return ((unsigned) sessao->id * 2654435761u + sessao->visitas) % 1024 != 0;
+}
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+int main() {
+    // Exemplo de uso
+    struct rodizio *r = criarRodizio(8);
+    for (int id = 1; id <= 5; id++) {
+        adicionarSessao(r, id * 100);
+    }
+    visitarLote(r, 2, encerrarAposTres, NULL);
+    removerSessaoPorId(r, 300);
+    imprimir(r);
+    visitarLote(r, 10, encerrarAposTres, NULL);
+    imprimir(r);
+    visitarLote(r, 10, encerrarAposTres, NULL);
+    imprimir(r);
+    liberarRodizio(r);
+
+    // Custo por tick com anéis de tamanhos diferentes
+    const size_t porTick = 64;
+    const int ticks = 200000;
+    printf("\n%d ticks de %zu visitas, com entradas e saidas de sessoes\n", ticks, porTick);
+    for (int tamanho = 1000; tamanho <= 1000000; tamanho *= 10) {
+        r = criarRodizio((size_t) tamanho);
+        for (int id = 0; id < tamanho; id++) {
+            adicionarSessao(r, id);
+        }
+
+        unsigned long soma = 0;
+        int proximoId = tamanho;
+        struct timespec t0;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int t = 0; t < ticks; t++) {
+            size_t antes = r->tamanho;
+            visitarLote(r, porTick, atenderSessao, &soma);
+            // Repõe as sessões encerradas com ids novos
+            for (size_t i = r->tamanho; i < antes; i++) {
+                adicionarSessao(r, proximoId++);
+            }
+        }
+        double segundos = segundosDesde(&t0);
+
+        printf("%8d sessoes: %6.0f ns/tick (%5.1f ns/visita), %d sessoes trocadas\n",
+               tamanho, segundos * 1e9 / ticks, segundos * 1e9 / ticks / (double) porTick,
+               proximoId - tamanho);
+        liberarRodizio(r);
+    }
+
+    destruirAlocador(&alocadorSessoes);
+    return 0;
+}
@@ -0,0 +1,558 @@
+/**
+ * Implementação de Cache LRU/LFU com Lista Duplamente Encadeada em C
+ *
+ * Este código implementa um cache de capacidade limitada, onde:
+ * - As entradas são nós de uma lista duplamente encadeada (anterior/proximo)
+ * - Uma tabela hash de endereçamento aberto (sondagem linear) leva da chave
+ *   ao nó em O(1), eliminando a busca linear de Lista_Duplamente_Encadeada.c
+ * - LRU: cada acesso move o nó para o início; o fim da lista é o menos
+ *   recentemente usado e é o primeiro a ser descartado
+ * - LFU: os nós ficam em grupos por frequência de acesso (lista de grupos em
+ *   ordem crescente); um acesso move o nó para o grupo seguinte e o descarte
+ *   sai do fim do grupo de menor frequência. Todas as operações são O(1)
+ * - O limite pode ser em número de entradas, em bytes, ou ambos
+ * - Contadores de acertos, faltas e descartes
+ *
+ *   gcc -O2 Cache_LRU.c -o cache_lru
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "../Alocador_Nos/Alocador_Nos.h"
+
+enum politicaCache {
+    POLITICA_LRU,
+    POLITICA_LFU
+};
+
+struct grupoFrequencia;
+
+// Entrada do cache
+struct no {
+    int chave;
+    int valor;
+    size_t bytes;                    // Tamanho contabilizado no limite em bytes
+    struct grupoFrequencia *grupo;   // Grupo de frequência (somente LFU)
+    struct no *anterior;
+    struct no *proximo;
+};
+
+// Grupo de entradas com a mesma frequência de acesso (somente LFU)
+struct grupoFrequencia {
+    unsigned long frequencia;
+    struct no *primeiro;             // Mais recente do grupo
+    struct no *ultimo;               // Menos recente do grupo
+    struct grupoFrequencia *anterior;
+    struct grupoFrequencia *proximo;
+};
+
+// Estrutura do cache
+struct cache {
+    enum politicaCache politica;
+    size_t limiteEntradas;           // 0 = sem limite
+    size_t limiteBytes;              // 0 = sem limite
+    size_t entradas;
+    size_t bytes;
+
+    struct no *primeiro;             // LRU: mais recente
+    struct no *ultimo;               // LRU: menos recente
+    struct grupoFrequencia *menorFrequencia;  // LFU: primeiro grupo
+
+    struct no **tabela;              // Índice hash: chave -> nó (NULL = vazio)
+    size_t capacidadeTabela;         // Potência de 2
+
+    unsigned long acertos;
+    unsigned long faltas;
+    unsigned long descartes;
+};
+
+static struct alocadorNos alocadorEntradas = ALOCADOR_NOS_INICIALIZADOR(struct no);
+static struct alocadorNos alocadorGrupos = ALOCADOR_NOS_INICIALIZADOR(struct grupoFrequencia);
+
+/**
+ * Espalha os bits da chave (finalizador do MurmurHash3)
+ * @param chave Chave
+ * @return Hash da chave
+ */
+static inline uint32_t hashChave(int chave) {
+    uint32_t h = (uint32_t) chave;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/**
+ * Procura a posição de uma chave na tabela
+ * @param c Ponteiro para o cache
+ * @param chave Chave procurada
+ * @return Posição da chave ou da primeira posição vazia da sondagem
+ */
+static inline size_t posicaoTabela(const struct cache *c, int chave) {
+    size_t mascara = c->capacidadeTabela - 1;
+    size_t i = hashChave(chave) & mascara;
+    while (c->tabela[i] != NULL && c->tabela[i]->chave != chave) {
+        i = (i + 1) & mascara;
+    }
+    return i;
+}
+
+/**
+ * Remove a chave da posição i, deslocando para trás as chaves seguintes
+ * para que nenhuma sondagem seja interrompida (sem marcas de remoção)
+ * @param c Ponteiro para o cache
+ * @param i Posição ocupada a esvaziar
+ */
+static void esvaziarPosicao(struct cache *c, size_t i) {
+    size_t mascara = c->capacidadeTabela - 1;
+    size_t j = i;
+    for (;;) {
+        c->tabela[i] = NULL;
+        for (;;) {
+            j = (j + 1) & mascara;
+            if (c->tabela[j] == NULL) {
+                return;
+            }
+            size_t ideal = hashChave(c->tabela[j]->chave) & mascara;
+            // A chave em j pode ocupar i se i estiver entre sua posição ideal e j
+            if (((j - ideal) & mascara) >= ((j - i) & mascara)) {
+                break;
+            }
+        }
+        c->tabela[i] = c->tabela[j];
+        i = j;
+    }
+}
+
+/**
+ * Dobra a tabela hash e reinsere as entradas
+ * @param c Ponteiro para o cache
+ */
+static void crescerTabela(struct cache *c) {
+    struct no **antiga = c->tabela;
+    size_t capacidadeAntiga = c->capacidadeTabela;
+
+    c->capacidadeTabela *= 2;
+    c->tabela = (struct no **) calloc(c->capacidadeTabela, sizeof(struct no *));
+    if (c->tabela == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < capacidadeAntiga; i++) {
+        if (antiga[i] != NULL) {
+            c->tabela[posicaoTabela(c, antiga[i]->chave)] = antiga[i];
+        }
+    }
+    free(antiga);
+}
+
+/**
+ * Desliga um nó de uma lista duplamente encadeada
+ * @param primeiro Início da lista
+ * @param ultimo Fim da lista
+ * @param no Nó a desligar
+ */
+static inline void desligar(struct no **primeiro, struct no **ultimo, struct no *no) {
+    if (no->anterior != NULL) {
+        no->anterior->proximo = no->proximo;
+    } else {
+        *primeiro = no->proximo;
+    }
+    if (no->proximo != NULL) {
+        no->proximo->anterior = no->anterior;
+    } else {
+        *ultimo = no->anterior;
+    }
+}
+
+/**
+ * Liga um nó no início de uma lista duplamente encadeada
+ * @param primeiro Início da lista
+ * @param ultimo Fim da lista
+ * @param no Nó a ligar
+ */
+static inline void ligarInicio(struct no **primeiro, struct no **ultimo, struct no *no) {
+    no->anterior = NULL;
+    no->proximo = *primeiro;
+    if (*primeiro != NULL) {
+        (*primeiro)->anterior = no;
+    } else {
+        *ultimo = no;
+    }
+    *primeiro = no;
+}
+
+/**
+ * Cria um grupo de frequência logo após outro (ou no início se NULL)
+ * @param c Ponteiro para o cache
+ * @param antes Grupo anterior ou NULL
+ * @param frequencia Frequência do novo grupo
+ * @return Ponteiro para o novo grupo
+ */
+static struct grupoFrequencia *criarGrupo(struct cache *c, struct grupoFrequencia *antes, unsigned long frequencia) {
+    struct grupoFrequencia *g = (struct grupoFrequencia *) alocarNo(&alocadorGrupos);
+    if (g == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    g->frequencia = frequencia;
+    g->primeiro = g->ultimo = NULL;
+    g->anterior = antes;
+    g->proximo = antes ? antes->proximo : c->menorFrequencia;
+    if (g->proximo != NULL) {
+        g->proximo->anterior = g;
+    }
+    if (antes != NULL) {
+        antes->proximo = g;
+    } else {
+        c->menorFrequencia = g;
+    }
+    return g;
+}
+
+/**
+ * Remove um grupo de frequência vazio
+ * @param c Ponteiro para o cache
+ * @param g Grupo a remover
+ */
+static void removerGrupo(struct cache *c, struct grupoFrequencia *g) {
+    if (g->anterior != NULL) {
+        g->anterior->proximo = g->proximo;
+    } else {
+        c->menorFrequencia = g->proximo;
+    }
+    if (g->proximo != NULL) {
+        g->proximo->anterior = g->anterior;
+    }
+    liberarNo(&alocadorGrupos, g);
+}
+
+/**
+ * Liga uma entrada nova na estrutura da política
+ * @param c Ponteiro para o cache
+ * @param no Entrada nova
+ */
+static void ligarEntrada(struct cache *c, struct no *no) {
+    if (c->politica == POLITICA_LRU) {
+        ligarInicio(&c->primeiro, &c->ultimo, no);
+        return;
+    }
+    struct grupoFrequencia *g = c->menorFrequencia;
+    if (g == NULL || g->frequencia != 1) {
+        g = criarGrupo(c, NULL, 1);
+    }
+    no->grupo = g;
+    ligarInicio(&g->primeiro, &g->ultimo, no);
+}
+
+/**
+ * Desliga uma entrada da estrutura da política
+ * @param c Ponteiro para o cache
+ * @param no Entrada a desligar
+ */
+static void desligarEntrada(struct cache *c, struct no *no) {
+    if (c->politica == POLITICA_LRU) {
+        desligar(&c->primeiro, &c->ultimo, no);
+        return;
+    }
+    struct grupoFrequencia *g = no->grupo;
+    desligar(&g->primeiro, &g->ultimo, no);
+    if (g->primeiro == NULL) {
+        removerGrupo(c, g);
+    }
+}
+
+/**
+ * Registra um acesso a uma entrada (mover para a frente / subir de frequência)
+ * @param c Ponteiro para o cache
+ * @param no Entrada acessada
+ */
+static void tocar(struct cache *c, struct no *no) {
+    if (c->politica == POLITICA_LRU) {
+        if (c->primeiro != no) {
+            desligar(&c->primeiro, &c->ultimo, no);
+            ligarInicio(&c->primeiro, &c->ultimo, no);
+        }
+        return;
+    }
+
+    struct grupoFrequencia *atual = no->grupo;
+    struct grupoFrequencia *destino = atual->proximo;
+    if (destino == NULL || destino->frequencia != atual->frequencia + 1) {
+        destino = criarGrupo(c, atual, atual->frequencia + 1);
+    }
+    desligar(&atual->primeiro, &atual->ultimo, no);
+    if (atual->primeiro == NULL) {
+        removerGrupo(c, atual);
+    }
+    no->grupo = destino;
+    ligarInicio(&destino->primeiro, &destino->ultimo, no);
+}
+
+/**
+ * Retira uma entrada do cache e libera o nó
+ * @param c Ponteiro para o cache
+ * @param no Entrada a retirar
+ */
+static void retirarEntrada(struct cache *c, struct no *no) {
+    esvaziarPosicao(c, posicaoTabela(c, no->chave));
+    desligarEntrada(c, no);
+    c->entradas--;
+    c->bytes -= no->bytes;
+    liberarNo(&alocadorEntradas, no);
+}
+
+/**
+ * Descarta entradas até respeitar os limites, preservando a entrada indicada
+ * @param c Ponteiro para o cache
+ * @param preservar Entrada que não deve ser descartada
+ */
+static void aplicarLimites(struct cache *c, const struct no *preservar) {
+    while ((c->limiteEntradas && c->entradas > c->limiteEntradas) ||
+           (c->limiteBytes && c->bytes > c->limiteBytes)) {
+        struct no *vitima = c->politica == POLITICA_LRU ? c->ultimo : c->menorFrequencia->ultimo;
+        if (vitima == preservar) {
+            vitima = vitima->anterior;
+            if (vitima == NULL && c->politica == POLITICA_LFU && c->menorFrequencia->proximo) {
+                vitima = c->menorFrequencia->proximo->ultimo;
+            }
+            if (vitima == NULL) {
+                return;
+            }
+        }
+        retirarEntrada(c, vitima);
+        c->descartes++;
+    }
+}
+
+/**
+ * Cria um cache vazio
+ * @param politica POLITICA_LRU ou POLITICA_LFU
+ * @param limiteEntradas Máximo de entradas (0 = sem limite)
+ * @param limiteBytes Máximo de bytes somados (0 = sem limite)
+ * @return Ponteiro para o cache
+ */
+struct cache *criarCache(enum politicaCache politica, size_t limiteEntradas, size_t limiteBytes) {
+    struct cache *c = (struct cache *) calloc(1, sizeof(struct cache));
+    if (c == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    c->politica = politica;
+    c->limiteEntradas = limiteEntradas;
+    c->limiteBytes = limiteBytes;
+
+    // Fator de carga máximo de 1/2 para o limite de entradas
+    c->capacidadeTabela = 16;
+    while (limiteEntradas && c->capacidadeTabela < 2 * limiteEntradas) {
+        c->capacidadeTabela *= 2;
+    }
+    c->tabela = (struct no **) calloc(c->capacidadeTabela, sizeof(struct no *));
+    if (c->tabela == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    return c;
+}
+
+/**
+ * Busca uma chave no cache
+ * @param c Ponteiro para o cache
+ * @param chave Chave procurada
+ * @param valor Recebe o valor se encontrado
+ * @return true em caso de acerto
+ */
+bool buscarCache(struct cache *c, int chave, int *valor) {
+    struct no *no = c->tabela[posicaoTabela(c, chave)];
+    if (no == NULL) {
+        c->faltas++;
+        return false;
+    }
+    c->acertos++;
+    tocar(c, no);
+    *valor = no->valor;
+    return true;
+}
+
+/**
+ * Insere ou atualiza uma entrada, descartando outras se necessário
+ * @param c Ponteiro para o cache
+ * @param chave Chave
+ * @param valor Valor associado
+ * @param bytes Tamanho da entrada para o limite em bytes
+ */
+void inserirCache(struct cache *c, int chave, int valor, size_t bytes) {
+    size_t i = posicaoTabela(c, chave);
+    struct no *no = c->tabela[i];
+
+    if (no != NULL) {
+        c->bytes = c->bytes - no->bytes + bytes;
+        no->valor = valor;
+        no->bytes = bytes;
+        tocar(c, no);
+    } else {
+        no = (struct no *) alocarNo(&alocadorEntradas);
+        if (no == NULL) {
+            fprintf(stderr, "Erro na alocação de memória.\n");
+            exit(EXIT_FAILURE);
+        }
+        no->chave = chave;
+        no->valor = valor;
+        no->bytes = bytes;
+        no->grupo = NULL;
+        c->tabela[i] = no;
+        c->entradas++;
+        c->bytes += bytes;
+        ligarEntrada(c, no);
+
+        if (2 * c->entradas > c->capacidadeTabela) {
+            crescerTabela(c);
+        }
+    }
+    aplicarLimites(c, no);
+}
+
+/**
+ * Remove uma chave do cache
+ * @param c Ponteiro para o cache
+ * @param chave Chave a remover
+ * @return true se a chave existia
+ */
+bool removerCache(struct cache *c, int chave) {
+    struct no *no = c->tabela[posicaoTabela(c, chave)];
+    if (no == NULL) {
+        return false;
+    }
+    retirarEntrada(c, no);
+    return true;
+}
+
+/**
+ * Imprime as entradas na ordem de descarte inversa (a primeira é a mais protegida)
+ * @param c Ponteiro para o cache
+ */
+void imprimirCache(const struct cache *c) {
+    printf("Cache %s (%zu entradas, %zu bytes): ", c->politica == POLITICA_LRU ? "LRU" : "LFU",
+           c->entradas, c->bytes);
+    if (c->politica == POLITICA_LRU) {
+        for (struct no *no = c->primeiro; no != NULL; no = no->proximo) {
+            printf("%d=%d ", no->chave, no->valor);
+        }
+    } else {
+        struct grupoFrequencia *g = c->menorFrequencia;
+        while (g != NULL && g->proximo != NULL) {
+            g = g->proximo;
+        }
+        for (; g != NULL; g = g->anterior) {
+            for (struct no *no = g->primeiro; no != NULL; no = no->proximo) {
+                printf("%d=%d(f%lu) ", no->chave, no->valor, g->frequencia);
+            }
+        }
+    }
+    printf("\nAcertos: %lu, Faltas: %lu, Descartes: %lu\n", c->acertos, c->faltas, c->descartes);
+}
+
+/**
+ * Libera toda a memória do cache
+ * @param c Ponteiro para o cache
+ */
+void liberarCache(struct cache *c) {
+    for (size_t i = 0; i < c->capacidadeTabela; i++) {
+        if (c->tabela[i] != NULL) {
+            liberarNo(&alocadorEntradas, c->tabela[i]);
+        }
+    }
+    while (c->menorFrequencia != NULL) {
+        struct grupoFrequencia *g = c->menorFrequencia;
+        c->menorFrequencia = g->proximo;
+        liberarNo(&alocadorGrupos, g);
+    }
+    free(c->tabela);
+    free(c);
+}
+
+/**
+ * Simula o armazenamento lento que o cache protege
+ * @param chave Chave lida
+ * @return Valor armazenado
+ */
+static int lerArmazenamento(int chave) {
+    volatile unsigned valor = (unsigned) chave;
+    for (int i = 0; i < 200; i++) {
+        valor = valor * 31u + 7u;
+    }
+    return chave * 10;
+}
+
+int main() {
+    int valor;
+
+    // LRU com 3 entradas
+    struct cache *lru = criarCache(POLITICA_LRU, 3, 0);
+    inserirCache(lru, 1, 10, 1);
+    inserirCache(lru, 2, 20, 1);
+    inserirCache(lru, 3, 30, 1);
+    buscarCache(lru, 1, &valor);      // 1 passa a ser o mais recente
+    inserirCache(lru, 4, 40, 1);      // descarta 2
+    buscarCache(lru, 2, &valor);      // falta
+    imprimirCache(lru);
+    liberarCache(lru);
+
+    // LFU com 3 entradas
+    struct cache *lfu = criarCache(POLITICA_LFU, 3, 0);
+    inserirCache(lfu, 1, 10, 1);
+    inserirCache(lfu, 2, 20, 1);
+    inserirCache(lfu, 3, 30, 1);
+    buscarCache(lfu, 1, &valor);
+    buscarCache(lfu, 1, &valor);
+    buscarCache(lfu, 3, &valor);
+    inserirCache(lfu, 4, 40, 1);      // descarta 2 (menor frequência)
+    imprimirCache(lfu);
+    liberarCache(lfu);
+
+    // Limite em bytes
+    struct cache *porBytes = criarCache(POLITICA_LRU, 0, 100);
+    inserirCache(porBytes, 1, 10, 60);
+    inserirCache(porBytes, 2, 20, 30);
+    inserirCache(porBytes, 3, 30, 30);  // 120 bytes: descarta 1
+    imprimirCache(porBytes);
+    liberarCache(porBytes);
+
+    // Cache na frente de um armazenamento lento, com acessos concentrados
+    const int acessos = 5000000;
+    const int universo = 1000000;
+    struct cache *quente = criarCache(POLITICA_LRU, 50000, 0);
+    uint64_t x = 88172645463325252ull;
+    struct timespec t0, t1;
+    long long soma = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < acessos; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        // Distribuição enviesada: o cubo concentra os sorteios em chaves baixas
+        double u = (double) (x >> 11) / 9007199254740992.0;
+        int chave = (int) (u * u * u * universo);
+        if (!buscarCache(quente, chave, &valor)) {
+            valor = lerArmazenamento(chave);
+            inserirCache(quente, chave, valor, sizeof(int));
+        }
+        soma += valor;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    double segundos = (double) (t1.tv_sec - t0.tv_sec) + (double) (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    printf("\n%d acessos em %.3f s (%.1f ns/acesso, conferencia %lld)\n",
+           acessos, segundos, segundos * 1e9 / acessos, soma);
+    printf("Taxa de acerto: %.2f%% (%lu descartes)\n",
+           100.0 * (double) quente->acertos / (double) (quente->acertos + quente->faltas), quente->descartes);
+    liberarCache(quente);
+
+    return 0;
+}
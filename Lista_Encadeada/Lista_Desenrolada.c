@@ -0,0 +1,425 @@
+/**
+ * Implementação de Lista Duplamente Encadeada Desenrolada em C
+ *
+ * Este código implementa uma lista duplamente encadeada de blocos, onde:
+ * - Cada bloco guarda um vetor de até CAPACIDADE_BLOCO números, além dos
+ *   ponteiros anterior/proximo, em vez de um único número por nó
+ * - Um bloco cheio se divide ao meio na inserção; um bloco abaixo da metade
+ *   pega números do vizinho ou se funde a ele na remoção, de modo que todo
+ *   bloco (exceto o último) fica entre meio cheio e cheio
+ * - A busca dentro de um bloco compara grupos de 16 números sem desvios,
+ *   laço que o compilador vetoriza; percorrer a lista custa uma falta de
+ *   cache por bloco, e não uma por número
+ * - Concatenar duas listas é O(1), pois religa apenas os blocos das pontas
+ *
+ *   gcc -O3 -march=native Lista_Desenrolada.c -o lista_desenrolada
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include "../Alocador_Nos/Alocador_Nos.h"
+
+#define CAPACIDADE_BLOCO 64   // Múltiplo de GRUPO_BUSCA
+#define GRUPO_BUSCA 16        // Números comparados por iteração vetorizada
+
+// Estrutura de um bloco da lista
+struct bloco {
+    struct bloco *anterior;
+    struct bloco *proximo;
+    int quantidade;
+    int numeros[CAPACIDADE_BLOCO];
+};
+
+// Estrutura da lista desenrolada
+struct listaDesenrolada {
+    struct bloco *primeiro;
+    struct bloco *ultimo;
+    size_t tamanho;
+};
+
+static struct alocadorNos alocadorBlocos = ALOCADOR_NOS_INICIALIZADOR(struct bloco);
+
+/**
+ * Cria um bloco vazio e o liga após outro (ou no início se NULL)
+ * @param lista Ponteiro para a lista
+ * @param antes Bloco anterior ou NULL
+ * @return Ponteiro para o novo bloco
+ */
+static struct bloco *criarBloco(struct listaDesenrolada *lista, struct bloco *antes) {
+    struct bloco *novo = (struct bloco *) alocarNo(&alocadorBlocos);
+    if (novo == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    novo->quantidade = 0;
+    novo->anterior = antes;
+    novo->proximo = antes ? antes->proximo : lista->primeiro;
+    if (novo->proximo != NULL) {
+        novo->proximo->anterior = novo;
+    } else {
+        lista->ultimo = novo;
+    }
+    if (antes != NULL) {
+        antes->proximo = novo;
+    } else {
+        lista->primeiro = novo;
+    }
+    return novo;
+}
+
+/**
+ * Desliga e libera um bloco
+ * @param lista Ponteiro para a lista
+ * @param bloco Bloco a remover
+ */
+static void removerBloco(struct listaDesenrolada *lista, struct bloco *bloco) {
+    if (bloco->anterior != NULL) {
+        bloco->anterior->proximo = bloco->proximo;
+    } else {
+        lista->primeiro = bloco->proximo;
+    }
+    if (bloco->proximo != NULL) {
+        bloco->proximo->anterior = bloco->anterior;
+    } else {
+        lista->ultimo = bloco->anterior;
+    }
+    liberarNo(&alocadorBlocos, bloco);
+}
+
+/**
+ * Inicializa uma lista vazia
+ * @param lista Ponteiro para a lista
+ */
+void iniciarLista(struct listaDesenrolada *lista) {
+    lista->primeiro = NULL;
+    lista->ultimo = NULL;
+    lista->tamanho = 0;
+}
+
+/**
+ * Insere um novo número no final da lista
+ * @param lista Ponteiro para a lista
+ * @param numero Valor a ser inserido
+ */
+void inserir(struct listaDesenrolada *lista, int numero) {
+    struct bloco *ultimo = lista->ultimo;
+    if (ultimo == NULL || ultimo->quantidade == CAPACIDADE_BLOCO) {
+        ultimo = criarBloco(lista, lista->ultimo);
+    }
+    ultimo->numeros[ultimo->quantidade++] = numero;
+    lista->tamanho++;
+}
+
+/**
+ * Insere um número em uma posição (0 = início; >= tamanho = final)
+ * @param lista Ponteiro para a lista
+ * @param posicao Índice que o número passará a ocupar
+ * @param numero Valor a ser inserido
+ */
+void inserirPosicao(struct listaDesenrolada *lista, size_t posicao, int numero) {
+    if (posicao >= lista->tamanho) {
+        inserir(lista, numero);
+        return;
+    }
+
+    // Localiza o bloco pulando blocos inteiros
+    struct bloco *bloco = lista->primeiro;
+    while (posicao >= (size_t) bloco->quantidade) {
+        posicao -= (size_t) bloco->quantidade;
+        bloco = bloco->proximo;
+    }
+
+    // Bloco cheio: divide ao meio antes de inserir
+    if (bloco->quantidade == CAPACIDADE_BLOCO) {
+        struct bloco *novo = criarBloco(lista, bloco);
+        int metade = CAPACIDADE_BLOCO / 2;
+        memcpy(novo->numeros, bloco->numeros + metade, (size_t) (CAPACIDADE_BLOCO - metade) * sizeof(int));
+        novo->quantidade = CAPACIDADE_BLOCO - metade;
+        bloco->quantidade = metade;
+        if (posicao >= (size_t) metade) {
+            posicao -= (size_t) metade;
+            bloco = novo;
+        }
+    }
+
+    memmove(bloco->numeros + posicao + 1, bloco->numeros + posicao,
+            ((size_t) bloco->quantidade - posicao) * sizeof(int));
+    bloco->numeros[posicao] = numero;
+    bloco->quantidade++;
+    lista->tamanho++;
+}
+
+/**
+ * Procura um número dentro de um bloco
+ * O laço interno não tem saída antecipada, o que permite a vetorização;
+ * posições além da quantidade são lidas, mas descartadas pela máscara.
+ * @param bloco Bloco a examinar
+ * @param numero Valor procurado
+ * @return Índice do número no bloco ou -1
+ */
+static inline int buscarNoBloco(const struct bloco *bloco, int numero) {
+    for (int base = 0; base < bloco->quantidade; base += GRUPO_BUSCA) {
+        int encontrou = 0;
+        for (int i = base; i < base + GRUPO_BUSCA; i++) {
+            encontrou |= (bloco->numeros[i] == numero) & (i < bloco->quantidade);
+        }
+        if (encontrou) {
+            for (int i = base; ; i++) {
+                if (bloco->numeros[i] == numero) {
+                    return i;
+                }
+            }
+        }
+    }
+    return -1;
+}
+
+/**
+ * Verifica se um número está na lista
+ * @param lista Ponteiro para a lista
+ * @param numero Valor procurado
+ * @return true se encontrado
+ */
+bool buscar(const struct listaDesenrolada *lista, int numero) {
+    for (const struct bloco *b = lista->primeiro; b != NULL; b = b->proximo) {
+        if (buscarNoBloco(b, numero) >= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Reequilibra um bloco que ficou abaixo da metade
+ * @param lista Ponteiro para a lista
+ * @param bloco Bloco a reequilibrar
+ */
+static void reequilibrar(struct listaDesenrolada *lista, struct bloco *bloco) {
+    if (bloco->quantidade >= CAPACIDADE_BLOCO / 2) {
+        return;
+    }
+
+    struct bloco *vizinho = bloco->proximo;
+    if (vizinho != NULL) {
+        if (bloco->quantidade + vizinho->quantidade <= CAPACIDADE_BLOCO) {
+            // Funde o vizinho neste bloco
+            memcpy(bloco->numeros + bloco->quantidade, vizinho->numeros, (size_t) vizinho->quantidade * sizeof(int));
+            bloco->quantidade += vizinho->quantidade;
+            removerBloco(lista, vizinho);
+        } else {
+            // Pega números do vizinho até ficarem equilibrados
+            int mover = (vizinho->quantidade - bloco->quantidade) / 2;
+            memcpy(bloco->numeros + bloco->quantidade, vizinho->numeros, (size_t) mover * sizeof(int));
+            memmove(vizinho->numeros, vizinho->numeros + mover, (size_t) (vizinho->quantidade - mover) * sizeof(int));
+            bloco->quantidade += mover;
+            vizinho->quantidade -= mover;
+        }
+        return;
+    }
+
+    // Último bloco: pode ficar abaixo da metade, mas não vazio
+    struct bloco *antes = bloco->anterior;
+    if (antes != NULL && antes->quantidade + bloco->quantidade <= CAPACIDADE_BLOCO) {
+        memcpy(antes->numeros + antes->quantidade, bloco->numeros, (size_t) bloco->quantidade * sizeof(int));
+        antes->quantidade += bloco->quantidade;
+        removerBloco(lista, bloco);
+    } else if (bloco->quantidade == 0) {
+        removerBloco(lista, bloco);
+    }
+}
+
+/**
+ * Remove a primeira ocorrência de um número da lista
+ * @param lista Ponteiro para a lista
+ * @param numero Valor a ser removido
+ * @return true se o número foi encontrado e removido
+ */
+bool remover(struct listaDesenrolada *lista, int numero) {
+    for (struct bloco *b = lista->primeiro; b != NULL; b = b->proximo) {
+        int i = buscarNoBloco(b, numero);
+        if (i >= 0) {
+            memmove(b->numeros + i, b->numeros + i + 1, (size_t) (b->quantidade - i - 1) * sizeof(int));
+            b->quantidade--;
+            lista->tamanho--;
+            reequilibrar(lista, b);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Soma todos os números (percurso sequencial, vetorizável por bloco)
+ * @param lista Ponteiro para a lista
+ * @return Soma dos elementos
+ */
+long long somar(const struct listaDesenrolada *lista) {
+    long long soma = 0;
+    for (const struct bloco *b = lista->primeiro; b != NULL; b = b->proximo) {
+        for (int i = 0; i < b->quantidade; i++) {
+            soma += b->numeros[i];
+        }
+    }
+    return soma;
+}
+
+/**
+ * Move todos os blocos de outra lista para o final desta em O(1)
+ * @param lista Lista de destino
+ * @param outra Lista de origem (fica vazia)
+ */
+void concatenar(struct listaDesenrolada *lista, struct listaDesenrolada *outra) {
+    if (outra->primeiro == NULL) {
+        return;
+    }
+    if (lista->ultimo == NULL) {
+        *lista = *outra;
+    } else {
+        lista->ultimo->proximo = outra->primeiro;
+        outra->primeiro->anterior = lista->ultimo;
+        lista->ultimo = outra->ultimo;
+        lista->tamanho += outra->tamanho;
+    }
+    iniciarLista(outra);
+}
+
+/**
+ * Imprime todos os elementos da lista
+ * @param lista Ponteiro para a lista
+ */
+void imprimir(const struct listaDesenrolada *lista) {
+    for (const struct bloco *b = lista->primeiro; b != NULL; b = b->proximo) {
+        for (int i = 0; i < b->quantidade; i++) {
+            printf("%d, ", b->numeros[i]);
+        }
+    }
+    printf("\n");
+}
+
+/**
+ * Libera todos os blocos da lista
+ * @param lista Ponteiro para a lista
+ */
+void liberarLista(struct listaDesenrolada *lista) {
+    while (lista->primeiro != NULL) {
+        removerBloco(lista, lista->primeiro);
+    }
+    iniciarLista(lista);
+}
+
+// Nó de Lista_Duplamente_Encadeada.c, usado apenas na comparação
+struct no {
+    int numero;
+    struct no *anterior;
+    struct no *proximo;
+};
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+int main() {
+    struct listaDesenrolada lista, outra;
+    iniciarLista(&lista);
+    iniciarLista(&outra);
+
+    // Exemplo de uso
+    for (int i = 1; i <= 10; i++) {
+        inserir(&lista, i * 10);
+    }
+    inserirPosicao(&lista, 0, 5);
+    inserirPosicao(&lista, 5, 45);
+    remover(&lista, 100);
+    remover(&lista, 5);
+    for (int i = 1; i <= 3; i++) {
+        inserir(&outra, -i);
+    }
+    concatenar(&lista, &outra);
+    imprimir(&lista);
+    liberarLista(&lista);
+
+    // Comparação com a lista de um número por nó
+    const int total = 1000000;
+    const int buscas = 100;
+    struct timespec t0;
+    struct no *cabeca = NULL, *ultimo = NULL;
+
+    // Os nós da lista encadeada ficam espalhados pela memória em ordem
+    // aleatória, como acontece após muitas inserções e remoções intercaladas
+    int *nosEmbaralhados = (int *) malloc((size_t) total * sizeof(int));
+    struct no *nos = (struct no *) malloc((size_t) total * sizeof(struct no));
+    if (nosEmbaralhados == NULL || nos == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        return EXIT_FAILURE;
+    }
+    unsigned x = 12345;
+    for (int i = 0; i < total; i++) {
+        nosEmbaralhados[i] = i;
+    }
+    for (int i = total - 1; i > 0; i--) {
+        x = x * 1103515245u + 12345u;
+        int j = (int) ((x >> 8) % (unsigned) (i + 1));
+        int t = nosEmbaralhados[i];
+        nosEmbaralhados[i] = nosEmbaralhados[j];
+        nosEmbaralhados[j] = t;
+    }
+    for (int i = 0; i < total; i++) {
+        struct no *novoNo = &nos[nosEmbaralhados[i]];
+        novoNo->numero = i;
+        novoNo->anterior = ultimo;
+        novoNo->proximo = NULL;
+        if (ultimo != NULL) {
+            ultimo->proximo = novoNo;
+        } else {
+            cabeca = novoNo;
+        }
+        ultimo = novoNo;
+        inserir(&lista, i);
+    }
+
+    long long encontradosNos = 0, encontradosBlocos = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int k = 0; k < buscas; k++) {
+        int alvo = (int) ((unsigned) k * 2654435761u % (unsigned) total);
+        for (struct no *atual = cabeca; atual != NULL; atual = atual->proximo) {
+            if (atual->numero == alvo) {
+                encontradosNos++;
+                break;
+            }
+        }
+    }
+    double tempoNos = segundosDesde(&t0);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int k = 0; k < buscas; k++) {
+        int alvo = (int) ((unsigned) k * 2654435761u % (unsigned) total);
+        encontradosBlocos += buscar(&lista, alvo);
+    }
+    double tempoBlocos = segundosDesde(&t0);
+
+    printf("\n%d buscas em %d elementos (encontrados: %lld / %lld)\n",
+           buscas, total, encontradosNos, encontradosBlocos);
+    printf("Lista de nos:        %.3f s\n", tempoNos);
+    printf("Lista desenrolada:   %.3f s (%.1fx)\n", tempoBlocos, tempoNos / tempoBlocos);
+
+    // Remoções por valor espalhadas pela lista
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int k = 0; k < buscas; k++) {
+        remover(&lista, (int) ((unsigned) k * 2654435761u % (unsigned) total));
+    }
+    printf("%d remocoes por valor: %.3f s (restam %zu, soma %lld)\n",
+           buscas, segundosDesde(&t0), lista.tamanho, somar(&lista));
+
+    free(nos);
+    free(nosEmbaralhados);
+    liberarLista(&lista);
+    return 0;
+}
@@ -10,10 +10,18 @@
  * - Permite inserção no final da lista
  * - Permite remoção de qualquer elemento
  * - Mantém referências bidirecionais entre os nós
+ * - Ordenação por merge sort estável, sem alocar memória, com as
+ *   intercalações de nível mais alto executadas em paralelo
+ * - Modo ordenado: após ordenar, as inserções mantêm a ordem e as
+ *   remoções param assim que passam do valor procurado
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "../Alocador_Nos/Alocador_Nos.h"
 
 // Estrutura do nó da lista
 struct no {
@@ -22,6 +30,12 @@ struct no {
     struct no *proximo;
 };
 
+// Alocador dos nós (caches por thread, ver Alocador_Nos.h)
+static struct alocadorNos alocadorLista = ALOCADOR_NOS_INICIALIZADOR(struct no);
+
+#define MAX_THREADS_ORDENACAO 16
+#define MINIMO_POR_THREAD 65536  // Abaixo disso, ordenar em paralelo não compensa
+
 /**
  * Insere um novo número no final da lista
  * @param cabeca Ponteiro para o início da lista
@@ -30,7 +44,7 @@ struct no {
  */
 struct no *inserir(struct no *cabeca, int numero) {
     // Aloca e inicializa novo nó
-    struct no *novoNo = (struct no *) malloc(sizeof(struct no));
+    struct no *novoNo = (struct no *) alocarNo(&alocadorLista);
     novoNo->numero = numero;
     novoNo->anterior = NULL;
     novoNo->proximo = NULL;
@@ -68,7 +82,7 @@ struct no *remover(struct no *cabeca, int numero) {
     // Remoção do primeiro elemento
     if (cabeca->numero == numero) {
         struct no *novoInicio = cabeca->proximo;
-        free(cabeca);
+        liberarNo(&alocadorLista, cabeca);
         
         if (novoInicio != NULL) {
             novoInicio->anterior = NULL;
@@ -93,10 +107,266 @@ struct no *remover(struct no *cabeca, int numero) {
         atual->proximo->anterior = atual->anterior;
     }
 
-    free(atual);
+    liberarNo(&alocadorLista, atual);
+    return cabeca;
+}
+
+/**
+ * Insere um número mantendo a lista em ordem crescente (modo ordenado)
+ * Números iguais entram após os já existentes, preservando a estabilidade.
+ * @param cabeca Ponteiro para o início da lista (já ordenada)
+ * @param numero Valor a ser inserido
+ * @return Ponteiro para o início da lista
+ */
+struct no *inserirOrdenado(struct no *cabeca, int numero) {
+    struct no *novoNo = (struct no *) alocarNo(&alocadorLista);
+    novoNo->numero = numero;
+    novoNo->anterior = NULL;
+    novoNo->proximo = NULL;
+
+    // Novo menor elemento (ou lista vazia): vira a cabeça
+    if (cabeca == NULL || numero < cabeca->numero) {
+        novoNo->proximo = cabeca;
+        if (cabeca != NULL) {
+            cabeca->anterior = novoNo;
+        }
+        return novoNo;
+    }
+
+    // Avança até o último nó menor ou igual ao número
+    struct no *atual = cabeca;
+    while (atual->proximo != NULL && atual->proximo->numero <= numero) {
+        atual = atual->proximo;
+    }
+
+    novoNo->anterior = atual;
+    novoNo->proximo = atual->proximo;
+    if (atual->proximo != NULL) {
+        atual->proximo->anterior = novoNo;
+    }
+    atual->proximo = novoNo;
+    return cabeca;
+}
+
+/**
+ * Remove um número de uma lista ordenada, parando ao passar do valor
+ * @param cabeca Ponteiro para o início da lista (já ordenada)
+ * @param numero Valor a ser removido
+ * @return Ponteiro para o início da lista
+ */
+struct no *removerOrdenado(struct no *cabeca, int numero) {
+    struct no *atual = cabeca;
+    while (atual != NULL && atual->numero < numero) {
+        atual = atual->proximo;
+    }
+
+    // Elemento não encontrado
+    if (atual == NULL || atual->numero != numero) {
+        return cabeca;
+    }
+
+    if (atual->anterior != NULL) {
+        atual->anterior->proximo = atual->proximo;
+    } else {
+        cabeca = atual->proximo;
+    }
+    if (atual->proximo != NULL) {
+        atual->proximo->anterior = atual->anterior;
+    }
+
+    liberarNo(&alocadorLista, atual);
+    return cabeca;
+}
+
+/**
+ * Intercala duas listas ordenadas usando apenas os ponteiros proximo
+ * Em caso de empate o nó de a vem primeiro, o que torna a ordenação estável.
+ * @param a Lista com os elementos que vinham antes
+ * @param b Lista com os elementos que vinham depois
+ * @return Início da lista intercalada
+ */
+static struct no *intercalar(struct no *a, struct no *b) {
+    struct no inicio;
+    struct no *fim = &inicio;
+
+    while (a != NULL && b != NULL) {
+        if (b->numero < a->numero) {
+            fim->proximo = b;
+            b = b->proximo;
+        } else {
+            fim->proximo = a;
+            a = a->proximo;
+        }
+        fim = fim->proximo;
+    }
+    fim->proximo = a != NULL ? a : b;
+    return inicio.proximo;
+}
+
+/**
+ * Merge sort de baixo para cima sobre os ponteiros proximo
+ * Sublistas de tamanho 2^i ficam em faixas[i] e são intercaladas como em
+ * um contador binário: nenhuma memória é alocada além do vetor de faixas.
+ * @param cabeca Início da lista (os ponteiros anterior são ignorados)
+ * @return Início da lista ordenada
+ */
+static struct no *ordenarSequencial(struct no *cabeca) {
+    struct no *faixas[64] = {NULL};
+    int maiorFaixa = 0;
+
+    while (cabeca != NULL) {
+        struct no *atual = cabeca;
+        cabeca = cabeca->proximo;
+        atual->proximo = NULL;
+
+        int i = 0;
+        while (faixas[i] != NULL) {
+            atual = intercalar(faixas[i], atual);
+            faixas[i] = NULL;
+            i++;
+        }
+        faixas[i] = atual;
+        if (i > maiorFaixa) {
+            maiorFaixa = i;
+        }
+    }
+
+    // Faixas mais altas guardam os elementos mais antigos
+    struct no *resultado = NULL;
+    for (int i = 0; i <= maiorFaixa; i++) {
+        if (faixas[i] != NULL) {
+            resultado = intercalar(faixas[i], resultado);
+        }
+    }
+    return resultado;
+}
+
+// Trecho da lista entregue a uma thread de ordenação
+struct trechoOrdenacao {
+    struct no *a;
+    struct no *b;
+    struct no *resultado;
+};
+
+/**
+ * Thread que ordena um trecho
+ */
+static void *ordenarTrecho(void *arg) {
+    struct trechoOrdenacao *t = (struct trechoOrdenacao *) arg;
+    t->resultado = ordenarSequencial(t->a);
+    return NULL;
+}
+
+/**
+ * Thread que intercala dois trechos ordenados
+ */
+static void *intercalarTrecho(void *arg) {
+    struct trechoOrdenacao *t = (struct trechoOrdenacao *) arg;
+    t->resultado = intercalar(t->a, t->b);
+    return NULL;
+}
+
+/**
+ * Ordena a lista em ordem crescente (merge sort estável, sem alocar nós)
+ * A lista é cortada em até um trecho por núcleo; cada trecho é ordenado em
+ * sua thread e os pares de trechos são intercalados em paralelo, nível a
+ * nível, até restar uma única lista. Ao final os ponteiros anterior são
+ * refeitos em uma passada.
+ * @param cabeca Ponteiro para o início da lista
+ * @return Ponteiro para o início da lista ordenada
+ */
+struct no *ordenar(struct no *cabeca) {
+    size_t tamanho = 0;
+    for (struct no *atual = cabeca; atual != NULL; atual = atual->proximo) {
+        tamanho++;
+    }
+
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads = 1;
+    while (threads * 2 <= nucleos && threads * 2 <= MAX_THREADS_ORDENACAO &&
+           tamanho / (size_t) (threads * 2) >= MINIMO_POR_THREAD) {
+        threads *= 2;
+    }
+
+    struct trechoOrdenacao trechos[MAX_THREADS_ORDENACAO];
+    pthread_t ids[MAX_THREADS_ORDENACAO];
+    bool criada[MAX_THREADS_ORDENACAO];
+
+    // Corta a lista em trechos consecutivos de tamanhos iguais
+    struct no *atual = cabeca;
+    for (int t = 0; t < threads; t++) {
+        size_t quantidade = tamanho / (size_t) threads + ((size_t) t < tamanho % (size_t) threads);
+        trechos[t].a = atual;
+        for (size_t i = 1; i < quantidade; i++) {
+            atual = atual->proximo;
+        }
+        if (atual != NULL) {
+            struct no *seguinte = atual->proximo;
+            atual->proximo = NULL;
+            atual = seguinte;
+        }
+    }
+
+    if (threads == 1) {
+        cabeca = ordenarSequencial(trechos[0].a);
+    } else {
+        // Se uma thread não puder ser criada, o trecho é ordenado nesta mesma
+        for (int t = 0; t < threads; t++) {
+            criada[t] = pthread_create(&ids[t], NULL, ordenarTrecho, &trechos[t]) == 0;
+            if (!criada[t]) {
+                ordenarTrecho(&trechos[t]);
+            }
+        }
+        for (int t = 0; t < threads; t++) {
+            if (criada[t] && pthread_join(ids[t], NULL) != 0) {
+                fprintf(stderr, "Erro ao aguardar a thread de ordenação.\n");
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        // Intercala pares vizinhos em paralelo até sobrar um trecho
+        for (int restantes = threads; restantes > 1; restantes /= 2) {
+            for (int t = 0; t < restantes / 2; t++) {
+                trechos[t].a = trechos[2 * t].resultado;
+                trechos[t].b = trechos[2 * t + 1].resultado;
+                criada[t] = pthread_create(&ids[t], NULL, intercalarTrecho, &trechos[t]) == 0;
+                if (!criada[t]) {
+                    intercalarTrecho(&trechos[t]);
+                }
+            }
+            for (int t = 0; t < restantes / 2; t++) {
+                if (criada[t] && pthread_join(ids[t], NULL) != 0) {
+                    fprintf(stderr, "Erro ao aguardar a thread de ordenação.\n");
+                    exit(EXIT_FAILURE);
+                }
+            }
+        }
+        cabeca = trechos[0].resultado;
+    }
+
+    // Refaz os ponteiros anterior
+    struct no *anterior = NULL;
+    for (atual = cabeca; atual != NULL; atual = atual->proximo) {
+        atual->anterior = anterior;
+        anterior = atual;
+    }
     return cabeca;
 }
 
+/**
+ * Busca um número na lista
+ * @param cabeca Ponteiro para o início da lista
+ * @param numero Valor procurado
+ * @return Ponteiro para o primeiro nó com o número ou NULL
+ */
+struct no *buscar(struct no *cabeca, int numero) {
+    struct no *atual = cabeca;
+    while (atual != NULL && atual->numero != numero) {
+        atual = atual->proximo;
+    }
+    return atual;
+}
+
 /**
  * Imprime todos os elementos da lista
  * @param cabeca Ponteiro para o início da lista
@@ -123,6 +393,8 @@ int menu() {
     printf("| 2 - Remover    |\n");
     printf("| 3 - Imprimir   |\n");
     printf("| 4 - Sair       |\n");
+    printf("| 5 - Ordenar    |\n");
+    printf("| 6 - Modo ordem |\n");
     printf("+----------------+\n");
     printf("Digite a opcao: ");
     scanf("%d", &opcao);
@@ -131,6 +403,7 @@ int menu() {
 
 int main() {
     struct no *cabeca = NULL;
+    bool modoOrdenado = false;
     int opcao = 0;
     int numero;
 
@@ -140,16 +413,27 @@ int main() {
             case 1:
                 printf("Digite o numero: ");
                 scanf("%d", &numero);
-                cabeca = inserir(cabeca, numero);
+                cabeca = modoOrdenado ? inserirOrdenado(cabeca, numero) : inserir(cabeca, numero);
                 break;
             case 2:
                 printf("Digite o numero: ");
                 scanf("%d", &numero);
-                cabeca = remover(cabeca, numero);
+                cabeca = modoOrdenado ? removerOrdenado(cabeca, numero) : remover(cabeca, numero);
                 break;
             case 3:
                 imprimir(cabeca);
                 break;
+            case 5:
+                cabeca = ordenar(cabeca);
+                break;
+            case 6:
+                // Ao ligar o modo ordenado, a lista é ordenada uma vez
+                modoOrdenado = !modoOrdenado;
+                if (modoOrdenado) {
+                    cabeca = ordenar(cabeca);
+                }
+                printf("Modo ordenado %s\n", modoOrdenado ? "ligado" : "desligado");
+                break;
         }
     }
     return 0;
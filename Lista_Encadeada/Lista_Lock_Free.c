@@ -0,0 +1,499 @@
+/**
+ * Implementação de Conjunto em Lista Encadeada sem Travas (Harris-Michael) em C
+ *
+ * Este código implementa um conjunto ordenado de números compartilhado entre
+ * threads sem mutex, onde:
+ * - A lista é simplesmente encadeada e ordenada; cada ponteiro proximo é
+ *   atômico e o bit menos significativo marca o nó como removido
+ * - Remover é feito em dois passos: marcar o proximo do nó (remoção lógica)
+ *   e depois desligá-lo do anterior com compare-and-swap. Qualquer thread
+ *   que encontre um nó marcado ajuda a desligá-lo
+ * - A consulta apenas percorre a lista, sem escrever e sem recomeçar, então
+ *   leitores nunca bloqueiam nem atrasam escritores
+ * - A memória é recuperada por épocas (Recuperacao_Epocas.h): cada operação
+ *   anuncia a época global em que entrou, um nó desligado vai para a sacola
+ *   da época global lida logo após desligá-lo, e a sacola só é liberada duas
+ *   épocas depois, quando nenhuma thread ativa pode mais ter o nó em mãos
+ *
+ * O main compara a vazão com uma lista protegida por mutex de 1 a 64
+ * threads em cargas com 90%, 50% e 0% de consultas.
+ *
+ *   gcc -O2 -pthread Lista_Lock_Free.c -o lista_lock_free
+ *   ./lista_lock_free [operacoes_por_teste] [faixa_de_numeros]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <stdalign.h>
+#include <pthread.h>
+#include <time.h>
+#include "../Recuperacao_Epocas/Recuperacao_Epocas.h"
+
+#define MAX_THREADS 128
+
+struct no {
+    int numero;
+    atomic_uintptr_t proximo;   // Ponteiro para o próximo nó | marca de remoção
+    struct noAposentado aposentado;  // Encadeia os nós de uma sacola
+};
+
+// Estrutura da lista sem travas
+struct listaLockFree {
+    alignas(LINHA_CACHE) atomic_uintptr_t cabeca;
+    alignas(LINHA_CACHE) atomic_int threadsRegistradas;
+    struct dominioEpocas epocas;
+};
+
+// Manipulação da marca no bit baixo dos ponteiros
+static inline struct no *ponteiro(uintptr_t valor) {
+    return (struct no *) (valor & ~(uintptr_t) 1);
+}
+
+static inline bool marcado(uintptr_t valor) {
+    return (valor & 1) != 0;
+}
+
+/**
+ * Cria uma lista sem travas vazia
+ * @return Ponteiro para a nova lista
+ */
+struct listaLockFree *criarListaLockFree(void) {
+    struct listaLockFree *lista = (struct listaLockFree *) aligned_alloc(LINHA_CACHE, sizeof(struct listaLockFree));
+    if (lista == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    atomic_init(&lista->cabeca, (uintptr_t) 0);
+    atomic_init(&lista->threadsRegistradas, 0);
+    iniciarEpocas(&lista->epocas, MAX_THREADS, offsetof(struct no, aposentado));
+    return lista;
+}
+
+/**
+ * Registra a thread atual na lista
+ * @param lista Ponteiro para a lista
+ * @return Identificador da thread, usado nas demais operações
+ */
+int registrarThread(struct listaLockFree *lista) {
+    int id = atomic_fetch_add(&lista->threadsRegistradas, 1);
+    if (id >= MAX_THREADS) {
+        fprintf(stderr, "Limite de %d threads excedido.\n", MAX_THREADS);
+        exit(EXIT_FAILURE);
+    }
+    return id;
+}
+
+/**
+ * Localiza a posição de um número, desligando os nós marcados do caminho
+ * @param lista Ponteiro para a lista
+ * @param registro Estado da thread (para aposentar os nós desligados)
+ * @param numero Valor procurado
+ * @param anterior Recebe o ponteiro atômico que aponta para atual
+ * @param atual Recebe o primeiro nó com número maior ou igual (ou NULL)
+ * @return true se atual contém o número
+ */
+static bool localizar(struct listaLockFree *lista, struct registroThread *registro, int numero,
+                      atomic_uintptr_t **anterior, struct no **atual) {
+recomecar:
+    *anterior = &lista->cabeca;
+    *atual = ponteiro(atomic_load(*anterior));
+    while (*atual != NULL) {
+        uintptr_t seguinte = atomic_load(&(*atual)->proximo);
+        if (marcado(seguinte)) {
+            // Ajuda a desligar o nó removido
+            uintptr_t esperado = (uintptr_t) *atual;
+            if (!atomic_compare_exchange_strong(*anterior, &esperado, (uintptr_t) ponteiro(seguinte))) {
+                goto recomecar;
+            }
+            aposentar(&lista->epocas, registro, *atual);
+            *atual = ponteiro(seguinte);
+            continue;
+        }
+        if ((*atual)->numero >= numero) {
+            return (*atual)->numero == numero;
+        }
+        *anterior = &(*atual)->proximo;
+        *atual = ponteiro(seguinte);
+    }
+    return false;
+}
+
+/**
+ * Verifica se um número pertence ao conjunto
+ * @param lista Ponteiro para a lista
+ * @param id Identificador da thread (registrarThread)
+ * @param numero Valor procurado
+ * @return true se o número está presente
+ */
+bool contemLockFree(struct listaLockFree *lista, int id, int numero) {
+    struct registroThread *registro = &lista->epocas.registros[id];
+    entrarEpoca(&lista->epocas, registro);
+
+    struct no *atual = ponteiro(atomic_load_explicit(&lista->cabeca, memory_order_acquire));
+    while (atual != NULL && atual->numero < numero) {
+        atual = ponteiro(atomic_load_explicit(&atual->proximo, memory_order_acquire));
+    }
+    bool presente = atual != NULL && atual->numero == numero &&
+                    !marcado(atomic_load_explicit(&atual->proximo, memory_order_acquire));
+
+    sairEpoca(registro);
+    return presente;
+}
+
+/**
+ * Insere um número no conjunto
+ * @param lista Ponteiro para a lista
+ * @param id Identificador da thread (registrarThread)
+ * @param numero Valor a ser inserido
+ * @return true se inseriu, false se o número já estava presente
+ */
+bool inserirLockFree(struct listaLockFree *lista, int id, int numero) {
+    struct registroThread *registro = &lista->epocas.registros[id];
+    struct no *novoNo = NULL;
+    atomic_uintptr_t *anterior;
+    struct no *atual;
+    bool inserido;
+
+    entrarEpoca(&lista->epocas, registro);
+    for (;;) {
+        if (localizar(lista, registro, numero, &anterior, &atual)) {
+            inserido = false;
+            break;
+        }
+        if (novoNo == NULL) {
+            novoNo = (struct no *) malloc(sizeof(struct no));
+            if (novoNo == NULL) {
+                fprintf(stderr, "Erro na alocação de memória.\n");
+                exit(EXIT_FAILURE);
+            }
+            novoNo->numero = numero;
+        }
+        atomic_store_explicit(&novoNo->proximo, (uintptr_t) atual, memory_order_relaxed);
+
+        uintptr_t esperado = (uintptr_t) atual;
+        if (atomic_compare_exchange_strong(anterior, &esperado, (uintptr_t) novoNo)) {
+            novoNo = NULL;
+            inserido = true;
+            break;
+        }
+    }
+    sairEpoca(registro);
+
+    free(novoNo);  // Nunca publicado
+    return inserido;
+}
+
+/**
+ * Remove um número do conjunto
+ * @param lista Ponteiro para a lista
+ * @param id Identificador da thread (registrarThread)
+ * @param numero Valor a ser removido
+ * @return true se esta chamada removeu o número
+ */
+bool removerLockFree(struct listaLockFree *lista, int id, int numero) {
+    struct registroThread *registro = &lista->epocas.registros[id];
+    atomic_uintptr_t *anterior;
+    struct no *atual;
+    bool removido = false;
+
+    entrarEpoca(&lista->epocas, registro);
+    while (localizar(lista, registro, numero, &anterior, &atual)) {
+        // Remoção lógica: marca o proximo do nó
+        uintptr_t seguinte = atomic_load(&atual->proximo);
+        if (marcado(seguinte) ||
+            !atomic_compare_exchange_strong(&atual->proximo, &seguinte, seguinte | 1)) {
+            continue;  // Outra thread mexeu no nó; localiza de novo
+        }
+        removido = true;
+
+        // Remoção física; se falhar, a próxima localização desliga o nó
+        uintptr_t esperado = (uintptr_t) atual;
+        if (atomic_compare_exchange_strong(anterior, &esperado, seguinte)) {
+            aposentar(&lista->epocas, registro, atual);
+        } else {
+            localizar(lista, registro, numero, &anterior, &atual);
+        }
+        break;
+    }
+    sairEpoca(registro);
+    return removido;
+}
+
+/**
+ * Imprime todos os elementos do conjunto (sem concorrência)
+ * @param lista Ponteiro para a lista
+ */
+void imprimir(struct listaLockFree *lista) {
+    for (struct no *atual = ponteiro(atomic_load(&lista->cabeca)); atual != NULL;
+         atual = ponteiro(atomic_load(&atual->proximo))) {
+        printf("%d, ", atual->numero);
+    }
+    printf("\n");
+}
+
+/**
+ * Libera toda a memória da lista (sem outras threads em uso)
+ * @param lista Ponteiro para a lista
+ */
+void liberarListaLockFree(struct listaLockFree *lista) {
+    struct no *atual = ponteiro(atomic_load(&lista->cabeca));
+    while (atual != NULL) {
+        struct no *remover = atual;
+        atual = ponteiro(atomic_load(&atual->proximo));
+        free(remover);
+    }
+    finalizarEpocas(&lista->epocas);
+    free(lista);
+}
+
+// Lista ordenada protegida por mutex, usada como referência na comparação
+struct listaTravada {
+    pthread_mutex_t trava;
+    struct no *cabeca;
+};
+
+/**
+ * Verifica se um número pertence à lista com mutex
+ */
+bool contemTravada(struct listaTravada *lista, int numero) {
+    pthread_mutex_lock(&lista->trava);
+    struct no *atual = lista->cabeca;
+    while (atual != NULL && atual->numero < numero) {
+        atual = (struct no *) atomic_load_explicit(&atual->proximo, memory_order_relaxed);
+    }
+    bool presente = atual != NULL && atual->numero == numero;
+    pthread_mutex_unlock(&lista->trava);
+    return presente;
+}
+
+/**
+ * Insere um número na lista com mutex
+ */
+bool inserirTravada(struct listaTravada *lista, int numero) {
+    pthread_mutex_lock(&lista->trava);
+    atomic_uintptr_t *anterior = NULL;
+    struct no *atual = lista->cabeca;
+    while (atual != NULL && atual->numero < numero) {
+        anterior = &atual->proximo;
+        atual = (struct no *) atomic_load_explicit(&atual->proximo, memory_order_relaxed);
+    }
+    if (atual != NULL && atual->numero == numero) {
+        pthread_mutex_unlock(&lista->trava);
+        return false;
+    }
+
+    struct no *novoNo = (struct no *) malloc(sizeof(struct no));
+    if (novoNo == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    novoNo->numero = numero;
+    atomic_store_explicit(&novoNo->proximo, (uintptr_t) atual, memory_order_relaxed);
+    if (anterior == NULL) {
+        lista->cabeca = novoNo;
+    } else {
+        atomic_store_explicit(anterior, (uintptr_t) novoNo, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&lista->trava);
+    return true;
+}
+
+/**
+ * Remove um número da lista com mutex
+ */
+bool removerTravada(struct listaTravada *lista, int numero) {
+    pthread_mutex_lock(&lista->trava);
+    atomic_uintptr_t *anterior = NULL;
+    struct no *atual = lista->cabeca;
+    while (atual != NULL && atual->numero < numero) {
+        anterior = &atual->proximo;
+        atual = (struct no *) atomic_load_explicit(&atual->proximo, memory_order_relaxed);
+    }
+    if (atual == NULL || atual->numero != numero) {
+        pthread_mutex_unlock(&lista->trava);
+        return false;
+    }
+
+    uintptr_t seguinte = atomic_load_explicit(&atual->proximo, memory_order_relaxed);
+    if (anterior == NULL) {
+        lista->cabeca = (struct no *) seguinte;
+    } else {
+        atomic_store_explicit(anterior, seguinte, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&lista->trava);
+    free(atual);
+    return true;
+}
+
+/**
+ * Libera a lista com mutex
+ */
+void liberarListaTravada(struct listaTravada *lista) {
+    struct no *atual = lista->cabeca;
+    while (atual != NULL) {
+        struct no *remover = atual;
+        atual = (struct no *) atomic_load_explicit(&atual->proximo, memory_order_relaxed);
+        free(remover);
+    }
+}
+
+// Parâmetros de cada thread do teste de disputa
+struct parametrosTeste {
+    struct listaLockFree *lockFree;
+    struct listaTravada *travada;
+    long operacoes;
+    int faixa;          // Números sorteados em [0, faixa)
+    int consultas;      // Porcentagem de consultas; o resto é metade inserção, metade remoção
+    long saldo;         // Inserções menos remoções bem-sucedidas
+};
+
+/**
+ * Thread do teste: carga mista na lista sem travas
+ */
+static void *trabalharLockFree(void *arg) {
+    struct parametrosTeste *p = (struct parametrosTeste *) arg;
+    int id = registrarThread(p->lockFree);
+    uint64_t x = 0x2545F4914F6CDD1Dull * (uint64_t) (id + 1);
+
+    for (long i = 0; i < p->operacoes; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        int numero = (int) ((x >> 8) % (uint64_t) p->faixa);
+        int sorteio = (int) ((x >> 40) % 100);
+        if (sorteio < p->consultas) {
+            contemLockFree(p->lockFree, id, numero);
+        } else if (sorteio & 1) {
+            p->saldo += inserirLockFree(p->lockFree, id, numero);
+        } else {
+            p->saldo -= removerLockFree(p->lockFree, id, numero);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Thread do teste: a mesma carga na lista com mutex
+ */
+static void *trabalharTravada(void *arg) {
+    struct parametrosTeste *p = (struct parametrosTeste *) arg;
+    uint64_t x = 0x2545F4914F6CDD1Dull * (uint64_t) ((uintptr_t) arg | 1);
+
+    for (long i = 0; i < p->operacoes; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        int numero = (int) ((x >> 8) % (uint64_t) p->faixa);
+        int sorteio = (int) ((x >> 40) % 100);
+        if (sorteio < p->consultas) {
+            contemTravada(p->travada, numero);
+        } else if (sorteio & 1) {
+            p->saldo += inserirTravada(p->travada, numero);
+        } else {
+            p->saldo -= removerTravada(p->travada, numero);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Executa um teste de disputa com n threads
+ * @param lockFree true para a lista sem travas, false para a lista com mutex
+ * @param threads Quantidade de threads
+ * @param total Operações somadas de todas as threads
+ * @param faixa Números sorteados em [0, faixa), metade pré-inserida
+ * @param consultas Porcentagem de consultas
+ * @param correto Recebe se o tamanho final confere com as operações
+ * @return Milhões de operações por segundo
+ */
+static double executarTeste(bool lockFree, int threads, long total, int faixa, int consultas, bool *correto) {
+    struct listaLockFree *listaLF = criarListaLockFree();
+    struct listaTravada listaT = {PTHREAD_MUTEX_INITIALIZER, NULL};
+    pthread_t ids[MAX_THREADS];
+    struct parametrosTeste params[MAX_THREADS];
+    struct timespec t0, t1;
+
+    // Pré-insere os números pares, para o conjunto começar com metade da faixa
+    int id = registrarThread(listaLF);
+    for (int numero = faixa - 2 + faixa % 2; numero >= 0; numero -= 2) {
+        if (lockFree) {
+            inserirLockFree(listaLF, id, numero);
+        } else {
+            inserirTravada(&listaT, numero);
+        }
+    }
+    long inicial = (faixa + 1) / 2;
+
+    for (int i = 0; i < threads; i++) {
+        params[i] = (struct parametrosTeste) {listaLF, &listaT, total / threads, faixa, consultas, 0};
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < threads; i++) {
+        pthread_create(&ids[i], NULL, lockFree ? trabalharLockFree : trabalharTravada, &params[i]);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(ids[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    // Confere: tamanho final = inicial + inserções - remoções, e em ordem estrita
+    long saldo = inicial, contados = 0;
+    for (int i = 0; i < threads; i++) {
+        saldo += params[i].saldo;
+    }
+    bool ordenada = true;
+    long ultimo = -1;
+    struct no *atual = lockFree ? ponteiro(atomic_load(&listaLF->cabeca)) : listaT.cabeca;
+    while (atual != NULL) {
+        ordenada = ordenada && atual->numero > ultimo;
+        ultimo = atual->numero;
+        contados++;
+        atual = ponteiro(atomic_load(&atual->proximo));
+    }
+    *correto = ordenada && contados == saldo;
+
+    liberarListaLockFree(listaLF);
+    liberarListaTravada(&listaT);
+    double segundos = (double) (t1.tv_sec - t0.tv_sec) + (double) (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    return (double) (total / threads * threads) / segundos / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+    long total = argc > 1 ? atol(argv[1]) : 1000000;
+    int faixa = argc > 2 ? atoi(argv[2]) : 1024;
+
+    // Exemplo de uso em uma única thread
+    struct listaLockFree *lista = criarListaLockFree();
+    int id = registrarThread(lista);
+    int valores[] = {30, 10, 50, 20, 40, 20};
+    for (int i = 0; i < 6; i++) {
+        inserirLockFree(lista, id, valores[i]);
+    }
+    removerLockFree(lista, id, 50);
+    imprimir(lista);
+    printf("Contem 40: %s, contem 50: %s\n", contemLockFree(lista, id, 40) ? "sim" : "nao",
+           contemLockFree(lista, id, 50) ? "sim" : "nao");
+    liberarListaLockFree(lista);
+
+    // Comparação de vazão sob disputa
+    int cargas[] = {90, 50, 0};
+    for (int c = 0; c < 3; c++) {
+        printf("\n%ld operacoes, numeros em [0, %d), %d%% consultas por teste\n", total, faixa, cargas[c]);
+        printf("Threads | Lock-free (Mops/s) | Mutex (Mops/s)\n");
+        for (int threads = 1; threads <= 64; threads *= 2) {
+            bool corretoLF, corretoT;
+            double vazaoLF = executarTeste(true, threads, total, faixa, cargas[c], &corretoLF);
+            double vazaoT = executarTeste(false, threads, total, faixa, cargas[c], &corretoT);
+            printf("%7d | %18.2f | %14.2f%s\n", threads, vazaoLF, vazaoT,
+                   corretoLF && corretoT ? "" : "  (CONTEUDO INCORRETO)");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,361 @@
+/**
+ * Implementação de Lista Skip sobre Lista Duplamente Encadeada em C
+ *
+ * Este código implementa uma lista ordenada com índice skip, onde:
+ * - O nível 0 é a própria lista duplamente encadeada: cada nó começa com
+ *   numero, anterior e proximo, como em Lista_Duplamente_Encadeada.c, e o
+ *   vizinho de qualquer nó continua a um ponteiro de distância
+ * - Cada nó recebe uma torre de altura aleatória; o ponteiro do nível i
+ *   salta para o próximo nó com torre de altura maior que i
+ * - Um nó sobe mais um nível com probabilidade 1/fator, de modo que busca,
+ *   inserção e remoção custam O(log n) esperado. Fatores maiores deixam
+ *   as torres mais baixas (menos memória) e a busca com mais passos por nível
+ * - Valores repetidos são permitidos e entram após os já existentes
+ *
+ * O main compara a inserção ordenada com a busca linear da lista comum e
+ * mostra o efeito do fator de ramificação.
+ *
+ *   gcc -O2 Lista_Skip.c -o lista_skip
+ *   ./lista_skip [elementos]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define MAX_NIVEL 32
+
+// Estrutura de um nó: nível 0 duplamente encadeado + torre de índice
+struct no {
+    int numero;
+    struct no *anterior;
+    struct no *proximo;
+    int altura;             // Níveis em que o nó aparece (1 = só a lista base)
+    struct no *acima[];     // acima[i - 1] é o próximo nó no nível i
+};
+
+// Estrutura da lista skip
+struct listaSkip {
+    struct no *cabeca;      // Sentinela com torre de MAX_NIVEL níveis
+    int nivel;              // Maior altura em uso
+    unsigned fator;         // Fator de ramificação (2, 4, 8...)
+    uint64_t semente;
+    size_t tamanho;
+};
+
+/**
+ * Devolve o endereço do ponteiro de avanço de um nó no nível dado
+ */
+static inline struct no **avanco(struct no *no, int nivel) {
+    return nivel == 0 ? &no->proximo : &no->acima[nivel - 1];
+}
+
+/**
+ * Aloca um nó com torre da altura pedida
+ */
+static struct no *criarNo(int numero, int altura) {
+    struct no *novoNo = (struct no *) malloc(sizeof(struct no) + (size_t) (altura - 1) * sizeof(struct no *));
+    if (novoNo == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    novoNo->numero = numero;
+    novoNo->anterior = NULL;
+    novoNo->proximo = NULL;
+    novoNo->altura = altura;
+    for (int i = 1; i < altura; i++) {
+        novoNo->acima[i - 1] = NULL;
+    }
+    return novoNo;
+}
+
+/**
+ * Cria uma lista skip vazia
+ * @param fator Fator de ramificação (cada nível tem ~1/fator dos nós do anterior)
+ * @return Ponteiro para a nova lista
+ */
+struct listaSkip *criarListaSkip(unsigned fator) {
+    struct listaSkip *lista = (struct listaSkip *) malloc(sizeof(struct listaSkip));
+    if (lista == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    lista->cabeca = criarNo(0, MAX_NIVEL);
+    lista->nivel = 1;
+    lista->fator = fator < 2 ? 2 : fator;
+    lista->semente = 0x9E3779B97F4A7C15ull;
+    lista->tamanho = 0;
+    return lista;
+}
+
+/**
+ * Sorteia a altura de uma nova torre (distribuição geométrica)
+ */
+static int sortearAltura(struct listaSkip *lista) {
+    int altura = 1;
+    for (;;) {
+        // xorshift64
+        lista->semente ^= lista->semente << 13;
+        lista->semente ^= lista->semente >> 7;
+        lista->semente ^= lista->semente << 17;
+        if (altura == MAX_NIVEL || lista->semente % lista->fator != 0) {
+            return altura;
+        }
+        altura++;
+    }
+}
+
+/**
+ * Primeiro elemento da lista (início do nível 0)
+ * @param lista Ponteiro para a lista
+ * @return Primeiro nó ou NULL se a lista estiver vazia
+ */
+struct no *primeiro(const struct listaSkip *lista) {
+    return lista->cabeca->proximo;
+}
+
+/**
+ * Busca a primeira ocorrência de um número
+ * @param lista Ponteiro para a lista
+ * @param numero Valor procurado
+ * @return Nó encontrado ou NULL; a partir dele, anterior/proximo dão os vizinhos
+ */
+struct no *buscarSkip(const struct listaSkip *lista, int numero) {
+    struct no *atual = lista->cabeca;
+    for (int i = lista->nivel - 1; i >= 0; i--) {
+        struct no *seguinte;
+        while ((seguinte = *avanco(atual, i)) != NULL && seguinte->numero < numero) {
+            atual = seguinte;
+        }
+    }
+    atual = atual->proximo;
+    return atual != NULL && atual->numero == numero ? atual : NULL;
+}
+
+/**
+ * Insere um número mantendo a ordem crescente
+ * @param lista Ponteiro para a lista
+ * @param numero Valor a ser inserido
+ * @return Ponteiro para o nó inserido
+ */
+struct no *inserirSkip(struct listaSkip *lista, int numero) {
+    struct no *anteriores[MAX_NIVEL];
+    struct no *atual = lista->cabeca;
+
+    // Último nó menor ou igual ao número em cada nível
+    for (int i = lista->nivel - 1; i >= 0; i--) {
+        struct no *seguinte;
+        while ((seguinte = *avanco(atual, i)) != NULL && seguinte->numero <= numero) {
+            atual = seguinte;
+        }
+        anteriores[i] = atual;
+    }
+
+    int altura = sortearAltura(lista);
+    for (int i = lista->nivel; i < altura; i++) {
+        anteriores[i] = lista->cabeca;
+    }
+    if (altura > lista->nivel) {
+        lista->nivel = altura;
+    }
+
+    struct no *novoNo = criarNo(numero, altura);
+    for (int i = 0; i < altura; i++) {
+        *avanco(novoNo, i) = *avanco(anteriores[i], i);
+        *avanco(anteriores[i], i) = novoNo;
+    }
+
+    // Ponteiros anterior do nível 0; o primeiro nó não aponta para a sentinela
+    novoNo->anterior = anteriores[0] == lista->cabeca ? NULL : anteriores[0];
+    if (novoNo->proximo != NULL) {
+        novoNo->proximo->anterior = novoNo;
+    }
+
+    lista->tamanho++;
+    return novoNo;
+}
+
+/**
+ * Remove a primeira ocorrência de um número
+ * @param lista Ponteiro para a lista
+ * @param numero Valor a ser removido
+ * @return true se o número foi removido
+ */
+bool removerSkip(struct listaSkip *lista, int numero) {
+    struct no *anteriores[MAX_NIVEL];
+    struct no *atual = lista->cabeca;
+
+    // Último nó menor que o número em cada nível
+    for (int i = lista->nivel - 1; i >= 0; i--) {
+        struct no *seguinte;
+        while ((seguinte = *avanco(atual, i)) != NULL && seguinte->numero < numero) {
+            atual = seguinte;
+        }
+        anteriores[i] = atual;
+    }
+
+    struct no *alvo = atual->proximo;
+    if (alvo == NULL || alvo->numero != numero) {
+        return false;
+    }
+
+    // Em cada nível da torre o alvo é o sucessor do nó anterior
+    for (int i = 0; i < alvo->altura; i++) {
+        *avanco(anteriores[i], i) = *avanco(alvo, i);
+    }
+    if (alvo->proximo != NULL) {
+        alvo->proximo->anterior = alvo->anterior;
+    }
+    while (lista->nivel > 1 && *avanco(lista->cabeca, lista->nivel - 1) == NULL) {
+        lista->nivel--;
+    }
+
+    free(alvo);
+    lista->tamanho--;
+    return true;
+}
+
+/**
+ * Imprime todos os elementos da lista
+ * @param lista Ponteiro para a lista
+ */
+void imprimir(const struct listaSkip *lista) {
+    for (struct no *atual = primeiro(lista); atual != NULL; atual = atual->proximo) {
+        printf("%d, ", atual->numero);
+    }
+    printf("\n");
+}
+
+/**
+ * Imprime a quantidade de nós em cada nível do índice
+ * @param lista Ponteiro para a lista
+ */
+void imprimirNiveis(const struct listaSkip *lista) {
+    for (int i = lista->nivel - 1; i >= 0; i--) {
+        size_t quantidade = 0;
+        for (struct no *atual = *avanco(lista->cabeca, i); atual != NULL; atual = *avanco(atual, i)) {
+            quantidade++;
+        }
+        printf("Nivel %2d: %zu nos\n", i, quantidade);
+    }
+}
+
+/**
+ * Libera toda a memória alocada pela lista
+ * @param lista Ponteiro para a lista
+ */
+void liberarListaSkip(struct listaSkip *lista) {
+    struct no *atual = lista->cabeca;
+    while (atual != NULL) {
+        struct no *remover = atual;
+        atual = atual->proximo;
+        free(remover);
+    }
+    free(lista);
+}
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+/**
+ * Gera o i-ésimo número pseudoaleatório da carga de teste
+ */
+static inline int numeroTeste(int i, int total) {
+    return (int) ((unsigned) i * 2654435761u % (unsigned) (4 * total));
+}
+
+int main(int argc, char *argv[]) {
+    int total = argc > 1 ? atoi(argv[1]) : 1000000;
+    struct timespec t0;
+
+    // Exemplo de uso
+    struct listaSkip *lista = criarListaSkip(2);
+    int valores[] = {30, 10, 50, 20, 40, 20};
+    for (int i = 0; i < 6; i++) {
+        inserirSkip(lista, valores[i]);
+    }
+    removerSkip(lista, 50);
+    imprimir(lista);
+    imprimirNiveis(lista);
+    struct no *encontrado = buscarSkip(lista, 30);
+    if (encontrado != NULL) {
+        printf("30 encontrado entre %d e %d\n", encontrado->anterior->numero, encontrado->proximo->numero);
+    }
+    liberarListaSkip(lista);
+
+    // Lista comum ordenada: cada inserção percorre a lista até a posição
+    int totalLinear = total < 20000 ? total : 20000;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    struct no *cabeca = NULL;
+    for (int i = 0; i < totalLinear; i++) {
+        int numero = numeroTeste(i, total);
+        struct no *novoNo = criarNo(numero, 1);
+        if (cabeca == NULL || numero < cabeca->numero) {
+            novoNo->proximo = cabeca;
+            if (cabeca != NULL) {
+                cabeca->anterior = novoNo;
+            }
+            cabeca = novoNo;
+            continue;
+        }
+        struct no *atual = cabeca;
+        while (atual->proximo != NULL && atual->proximo->numero <= numero) {
+            atual = atual->proximo;
+        }
+        novoNo->anterior = atual;
+        novoNo->proximo = atual->proximo;
+        if (atual->proximo != NULL) {
+            atual->proximo->anterior = novoNo;
+        }
+        atual->proximo = novoNo;
+    }
+    double tempoLinear = segundosDesde(&t0);
+    while (cabeca != NULL) {
+        struct no *remover = cabeca;
+        cabeca = cabeca->proximo;
+        free(remover);
+    }
+    printf("\nLista ordenada comum: %d insercoes em %.3f s (%.0f ns/op)\n",
+           totalLinear, tempoLinear, tempoLinear * 1e9 / totalLinear);
+
+    // Lista skip com fatores de ramificação diferentes
+    unsigned fatores[] = {2, 4, 8};
+    for (int f = 0; f < 3; f++) {
+        lista = criarListaSkip(fatores[f]);
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int i = 0; i < total; i++) {
+            inserirSkip(lista, numeroTeste(i, total));
+        }
+        double tempoInsercao = segundosDesde(&t0);
+
+        long encontrados = 0;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int i = 0; i < total; i++) {
+            encontrados += buscarSkip(lista, numeroTeste(i * 7 + 3, total)) != NULL;
+        }
+        double tempoBusca = segundosDesde(&t0);
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int i = 0; i < total; i += 2) {
+            removerSkip(lista, numeroTeste(i, total));
+        }
+        double tempoRemocao = segundosDesde(&t0);
+
+        printf("Lista skip (fator %u, %d niveis): insercao %.0f ns/op, busca %.0f ns/op "
+               "(%ld encontrados), remocao %.0f ns/op, restam %zu\n",
+               fatores[f], lista->nivel, tempoInsercao * 1e9 / total, tempoBusca * 1e9 / total,
+               encontrados, tempoRemocao * 1e9 / ((total + 1) / 2), lista->tamanho);
+        liberarListaSkip(lista);
+    }
+
+    return 0;
+}
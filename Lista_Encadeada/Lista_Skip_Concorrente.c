@@ -0,0 +1,507 @@
+/**
+ * Implementação de Lista Skip Concorrente sem Travas em C
+ *
+ * Este código implementa a variante multithread da lista skip de
+ * Lista_Skip.c como um conjunto ordenado, onde:
+ * - Cada ponteiro de avanço é atômico e o bit menos significativo marca o
+ *   nó como removido naquele nível (remoção lógica)
+ * - A inserção liga o nó primeiro no nível 0 com compare-and-swap; a partir
+ *   desse ponto o número já pertence ao conjunto e os níveis de cima são
+ *   ligados em seguida, refazendo a busca quando um CAS falha
+ * - A remoção marca os níveis de cima para baixo; quem marca o nível 0 é o
+ *   dono da remoção. As buscas de inserção/remoção desligam fisicamente os
+ *   nós marcados que encontram pelo caminho
+ * - A consulta nunca escreve nem refaz a busca, então leitores não
+ *   bloqueiam nem atrasam escritores
+ * - A memória é recuperada por épocas (Recuperacao_Epocas.h, o mesmo código
+ *   de Lista_Lock_Free.c): cada operação anuncia a época global em que
+ *   entrou, um nó desligado vai para a sacola da época global lida logo
+ *   após desligá-lo, e a sacola só é liberada duas épocas depois
+ * - Um nó só é aposentado quando não está ligado em nenhum nível. A inserção
+ *   pode ainda estar ligando os níveis de cima de um nó que outra thread já
+ *   removeu; por isso inserção e remoção contam como donas da torre, e a
+ *   última a terminar refaz a busca (que desliga o nó) e o aposenta
+ *
+ * O main insere números em ordem aleatória com 1 a 8 threads, confere se o
+ * nível 0 ficou ordenado e completo e mede uma carga mista em paralelo.
+ *
+ *   gcc -O2 -pthread Lista_Skip_Concorrente.c -o lista_skip_concorrente
+ *   ./lista_skip_concorrente [elementos]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <stdalign.h>
+#include <limits.h>
+#include <pthread.h>
+#include <time.h>
+#include "../Recuperacao_Epocas/Recuperacao_Epocas.h"
+
+#define MAX_NIVEL 24
+#define MAX_THREADS 8
+
+// Estrutura de um nó: a chave é long long para caber as sentinelas
+struct no {
+    long long numero;
+    int altura;
+    atomic_int donos;               // Inserção e remoção que ainda usam a torre
+    struct noAposentado aposentado; // Encadeia os nós de uma sacola
+    atomic_uintptr_t proximo[];     // Ponteiro para o próximo nó | marca de remoção
+};
+
+// Estrutura da lista skip concorrente
+struct listaSkipConcorrente {
+    struct no *cabeca;              // Sentinela com chave LLONG_MIN
+    struct no *cauda;               // Sentinela com chave LLONG_MAX
+    unsigned fator;
+    atomic_size_t tamanho;
+    struct dominioEpocas epocas;
+};
+
+static _Thread_local uint64_t sementeThread;
+
+// Manipulação da marca no bit baixo dos ponteiros
+static inline struct no *ponteiro(uintptr_t valor) {
+    return (struct no *) (valor & ~(uintptr_t) 1);
+}
+
+static inline bool marcado(uintptr_t valor) {
+    return (valor & 1) != 0;
+}
+
+/**
+ * Aloca um nó com torre da altura pedida
+ */
+static struct no *criarNo(long long numero, int altura) {
+    struct no *novoNo = (struct no *) malloc(sizeof(struct no) + (size_t) altura * sizeof(atomic_uintptr_t));
+    if (novoNo == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    novoNo->numero = numero;
+    novoNo->altura = altura;
+    atomic_init(&novoNo->donos, 2);
+    novoNo->aposentado.proximo = NULL;
+    for (int i = 0; i < altura; i++) {
+        atomic_init(&novoNo->proximo[i], (uintptr_t) 0);
+    }
+    return novoNo;
+}
+
+/**
+ * Cria uma lista skip concorrente vazia
+ * @param fator Fator de ramificação (cada nível tem ~1/fator dos nós do anterior)
+ * @return Ponteiro para a nova lista
+ */
+struct listaSkipConcorrente *criarListaSkipConcorrente(unsigned fator) {
+    struct listaSkipConcorrente *lista =
+        (struct listaSkipConcorrente *) aligned_alloc(LINHA_CACHE, sizeof(struct listaSkipConcorrente));
+    if (lista == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    lista->cabeca = criarNo(LLONG_MIN, MAX_NIVEL);
+    lista->cauda = criarNo(LLONG_MAX, MAX_NIVEL);
+    for (int i = 0; i < MAX_NIVEL; i++) {
+        atomic_init(&lista->cabeca->proximo[i], (uintptr_t) lista->cauda);
+    }
+    lista->fator = fator < 2 ? 2 : fator;
+    atomic_init(&lista->tamanho, 0);
+    iniciarEpocas(&lista->epocas, MAX_THREADS, offsetof(struct no, aposentado));
+    return lista;
+}
+
+/**
+ * Sorteia a altura de uma nova torre com o gerador da thread
+ */
+static int sortearAltura(const struct listaSkipConcorrente *lista) {
+    if (sementeThread == 0) {
+        sementeThread = (uint64_t) (uintptr_t) &sementeThread * 0x9E3779B97F4A7C15ull | 1;
+    }
+    int altura = 1;
+    for (;;) {
+        sementeThread ^= sementeThread << 13;
+        sementeThread ^= sementeThread >> 7;
+        sementeThread ^= sementeThread << 17;
+        if (altura == MAX_NIVEL || sementeThread % lista->fator != 0) {
+            return altura;
+        }
+        altura++;
+    }
+}
+
+/**
+ * Localiza os vizinhos de um número em todos os níveis
+ * Nós marcados encontrados no caminho são desligados; se um CAS falhar, a
+ * busca recomeça da cabeça.
+ * @param anteriores Recebe o último nó menor que o número em cada nível
+ * @param seguintes Recebe o primeiro nó maior ou igual em cada nível
+ * @return true se o número está presente no nível 0
+ */
+static bool localizar(struct listaSkipConcorrente *lista, long long numero,
+                      struct no **anteriores, struct no **seguintes) {
+recomecar:
+    ;
+    struct no *anterior = lista->cabeca;
+    for (int i = MAX_NIVEL - 1; i >= 0; i--) {
+        struct no *atual = ponteiro(atomic_load(&anterior->proximo[i]));
+        for (;;) {
+            uintptr_t seguinte = atomic_load(&atual->proximo[i]);
+            while (marcado(seguinte)) {
+                uintptr_t esperado = (uintptr_t) atual;
+                if (!atomic_compare_exchange_strong(&anterior->proximo[i], &esperado,
+                                                    (uintptr_t) ponteiro(seguinte))) {
+                    goto recomecar;
+                }
+                atual = ponteiro(seguinte);
+                seguinte = atomic_load(&atual->proximo[i]);
+            }
+            if (atual->numero < numero) {
+                anterior = atual;
+                atual = ponteiro(seguinte);
+            } else {
+                break;
+            }
+        }
+        anteriores[i] = anterior;
+        seguintes[i] = atual;
+    }
+    return seguintes[0]->numero == numero;
+}
+
+/**
+ * Larga a torre de um nó: chamada pela inserção ao terminar de ligar os
+ * níveis e pela remoção ao marcar o nível 0
+ * A última das duas refaz a busca, que desliga o nó marcado de todos os
+ * níveis (inclusive de um nível ligado pela inserção depois que a remoção
+ * já tinha desligado os outros), e então o aposenta.
+ * @param lista Ponteiro para a lista
+ * @param registro Estado da thread
+ * @param no Nó inserido ou removido por esta thread
+ */
+static void soltarTorre(struct listaSkipConcorrente *lista, struct registroThread *registro, struct no *no) {
+    if (atomic_fetch_sub(&no->donos, 1) == 1) {
+        struct no *anteriores[MAX_NIVEL];
+        struct no *seguintes[MAX_NIVEL];
+        localizar(lista, no->numero, anteriores, seguintes);
+        aposentar(&lista->epocas, registro, no);
+    }
+}
+
+/**
+ * Verifica se um número pertence ao conjunto (sem escrever na lista)
+ * @param lista Ponteiro para a lista
+ * @param id Identificador da thread (0 a MAX_THREADS - 1, único entre as ativas)
+ * @param numero Valor procurado
+ * @return true se o número está presente
+ */
+bool contemSkip(struct listaSkipConcorrente *lista, int id, int numero) {
+    struct registroThread *registro = &lista->epocas.registros[id];
+    entrarEpoca(&lista->epocas, registro);
+
+    struct no *anterior = lista->cabeca;
+    struct no *atual = NULL;
+    for (int i = MAX_NIVEL - 1; i >= 0; i--) {
+        atual = ponteiro(atomic_load_explicit(&anterior->proximo[i], memory_order_acquire));
+        for (;;) {
+            uintptr_t seguinte = atomic_load_explicit(&atual->proximo[i], memory_order_acquire);
+            // Pula os nós marcados sem desligá-los
+            while (marcado(seguinte)) {
+                atual = ponteiro(seguinte);
+                seguinte = atomic_load_explicit(&atual->proximo[i], memory_order_acquire);
+            }
+            if (atual->numero < numero) {
+                anterior = atual;
+                atual = ponteiro(seguinte);
+            } else {
+                break;
+            }
+        }
+    }
+    bool presente = atual->numero == numero;
+
+    sairEpoca(registro);
+    return presente;
+}
+
+/**
+ * Insere um número no conjunto (dentro de uma época)
+ */
+static bool inserir(struct listaSkipConcorrente *lista, struct registroThread *registro, int numero) {
+    struct no *anteriores[MAX_NIVEL];
+    struct no *seguintes[MAX_NIVEL];
+    struct no *novoNo = NULL;
+
+    // Nível 0: liga o nó e o torna visível
+    for (;;) {
+        if (localizar(lista, numero, anteriores, seguintes)) {
+            free(novoNo);
+            return false;
+        }
+        if (novoNo == NULL) {
+            novoNo = criarNo(numero, sortearAltura(lista));
+        }
+        for (int i = 0; i < novoNo->altura; i++) {
+            atomic_store_explicit(&novoNo->proximo[i], (uintptr_t) seguintes[i], memory_order_relaxed);
+        }
+        uintptr_t esperado = (uintptr_t) seguintes[0];
+        if (atomic_compare_exchange_strong(&anteriores[0]->proximo[0], &esperado, (uintptr_t) novoNo)) {
+            break;
+        }
+    }
+    atomic_fetch_add_explicit(&lista->tamanho, 1, memory_order_relaxed);
+
+    // Níveis de cima: apenas atalhos, podem ser ligados depois
+    bool ligando = true;
+    for (int i = 1; i < novoNo->altura && ligando; i++) {
+        for (;;) {
+            uintptr_t proprio = atomic_load(&novoNo->proximo[i]);
+            if (marcado(proprio)) {
+                ligando = false;  // Uma remoção concorrente já começou
+                break;
+            }
+            if (ponteiro(proprio) != seguintes[i] &&
+                !atomic_compare_exchange_strong(&novoNo->proximo[i], &proprio, (uintptr_t) seguintes[i])) {
+                continue;
+            }
+            uintptr_t esperado = (uintptr_t) seguintes[i];
+            if (atomic_compare_exchange_strong(&anteriores[i]->proximo[i], &esperado, (uintptr_t) novoNo)) {
+                break;
+            }
+            // Vizinhos mudaram: refaz a busca; se o nó sumiu, não há o que ligar
+            localizar(lista, numero, anteriores, seguintes);
+            if (seguintes[0] != novoNo) {
+                ligando = false;
+                break;
+            }
+        }
+    }
+    soltarTorre(lista, registro, novoNo);
+    return true;
+}
+
+/**
+ * Insere um número no conjunto
+ * @param lista Ponteiro para a lista
+ * @param id Identificador da thread (0 a MAX_THREADS - 1, único entre as ativas)
+ * @param numero Valor a ser inserido
+ * @return true se inseriu, false se o número já estava presente
+ */
+bool inserirSkipConcorrente(struct listaSkipConcorrente *lista, int id, int numero) {
+    struct registroThread *registro = &lista->epocas.registros[id];
+    entrarEpoca(&lista->epocas, registro);
+    bool inserido = inserir(lista, registro, numero);
+    sairEpoca(registro);
+    return inserido;
+}
+
+/**
+ * Remove um número do conjunto (dentro de uma época)
+ */
+static bool remover(struct listaSkipConcorrente *lista, struct registroThread *registro, int numero) {
+    struct no *anteriores[MAX_NIVEL];
+    struct no *seguintes[MAX_NIVEL];
+
+    if (!localizar(lista, numero, anteriores, seguintes)) {
+        return false;
+    }
+    struct no *alvo = seguintes[0];
+
+    // Marca os níveis de cima
+    for (int i = alvo->altura - 1; i >= 1; i--) {
+        uintptr_t seguinte = atomic_load(&alvo->proximo[i]);
+        while (!marcado(seguinte)) {
+            atomic_compare_exchange_weak(&alvo->proximo[i], &seguinte, seguinte | 1);
+        }
+    }
+
+    // Quem marca o nível 0 é o dono da remoção
+    uintptr_t seguinte = atomic_load(&alvo->proximo[0]);
+    for (;;) {
+        if (marcado(seguinte)) {
+            return false;
+        }
+        if (atomic_compare_exchange_weak(&alvo->proximo[0], &seguinte, seguinte | 1)) {
+            break;
+        }
+    }
+    atomic_fetch_sub_explicit(&lista->tamanho, 1, memory_order_relaxed);
+
+    // Desliga fisicamente e aposenta o nó, se a inserção já terminou
+    soltarTorre(lista, registro, alvo);
+    return true;
+}
+
+/**
+ * Remove um número do conjunto
+ * @param lista Ponteiro para a lista
+ * @param id Identificador da thread (0 a MAX_THREADS - 1, único entre as ativas)
+ * @param numero Valor a ser removido
+ * @return true se esta chamada removeu o número
+ */
+bool removerSkipConcorrente(struct listaSkipConcorrente *lista, int id, int numero) {
+    struct registroThread *registro = &lista->epocas.registros[id];
+    entrarEpoca(&lista->epocas, registro);
+    bool removido = remover(lista, registro, numero);
+    sairEpoca(registro);
+    return removido;
+}
+
+/**
+ * Imprime todos os elementos do conjunto (sem concorrência)
+ * @param lista Ponteiro para a lista
+ */
+void imprimir(struct listaSkipConcorrente *lista) {
+    struct no *atual = ponteiro(atomic_load(&lista->cabeca->proximo[0]));
+    while (atual != lista->cauda) {
+        printf("%lld, ", atual->numero);
+        atual = ponteiro(atomic_load(&atual->proximo[0]));
+    }
+    printf("\n");
+}
+
+/**
+ * Libera toda a memória da lista (sem outras threads em uso)
+ * @param lista Ponteiro para a lista
+ */
+void liberarListaSkipConcorrente(struct listaSkipConcorrente *lista) {
+    struct no *atual = ponteiro(atomic_load(&lista->cabeca->proximo[0]));
+    while (atual != lista->cauda) {
+        struct no *remover = atual;
+        atual = ponteiro(atomic_load(&atual->proximo[0]));
+        free(remover);
+    }
+    finalizarEpocas(&lista->epocas);
+    free(lista->cabeca);
+    free(lista->cauda);
+    free(lista);
+}
+
+// Parâmetros de cada thread de teste
+struct tarefa {
+    struct listaSkipConcorrente *lista;
+    int id;
+    int threads;
+    int total;
+    long encontrados;
+};
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+/**
+ * Gera o i-ésimo número da carga de teste (permutação de 0..total-1 quando
+ * total é potência de 2; senão apenas espalhado)
+ */
+static inline int numeroTeste(int i, int total) {
+    return (int) ((unsigned) i * 2654435761u % (unsigned) total);
+}
+
+/**
+ * Thread que insere a sua fatia dos números
+ */
+static void *inserirFatia(void *arg) {
+    struct tarefa *t = (struct tarefa *) arg;
+    for (int i = t->id; i < t->total; i += t->threads) {
+        inserirSkipConcorrente(t->lista, t->id, numeroTeste(i, t->total));
+    }
+    return NULL;
+}
+
+/**
+ * Thread com carga mista: 80% consultas, 10% inserções, 10% remoções
+ */
+static void *cargaMista(void *arg) {
+    struct tarefa *t = (struct tarefa *) arg;
+    uint64_t x = 88172645463325252ull + (uint64_t) t->id;
+    for (int i = t->id; i < t->total; i += t->threads) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        int numero = (int) (x % (uint64_t) (2 * t->total));
+        unsigned sorteio = (unsigned) (x >> 40) % 10;
+        if (sorteio == 0) {
+            inserirSkipConcorrente(t->lista, t->id, numero);
+        } else if (sorteio == 1) {
+            removerSkipConcorrente(t->lista, t->id, numero);
+        } else {
+            t->encontrados += contemSkip(t->lista, t->id, numero);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Executa uma função de teste com o número de threads pedido
+ * @return Tempo em segundos
+ */
+static double executar(void *(*funcao)(void *), struct listaSkipConcorrente *lista,
+                       int threads, int total, long *encontrados) {
+    pthread_t ids[MAX_THREADS];
+    struct tarefa tarefas[MAX_THREADS];
+    struct timespec t0;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < threads; i++) {
+        tarefas[i] = (struct tarefa) {lista, i, threads, total, 0};
+        pthread_create(&ids[i], NULL, funcao, &tarefas[i]);
+    }
+    *encontrados = 0;
+    for (int i = 0; i < threads; i++) {
+        pthread_join(ids[i], NULL);
+        *encontrados += tarefas[i].encontrados;
+    }
+    return segundosDesde(&t0);
+}
+
+int main(int argc, char *argv[]) {
+    int total = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    long encontrados;
+
+    // Exemplo de uso
+    struct listaSkipConcorrente *lista = criarListaSkipConcorrente(4);
+    int valores[] = {30, 10, 50, 20, 40, 20};
+    for (int i = 0; i < 6; i++) {
+        inserirSkipConcorrente(lista, 0, valores[i]);
+    }
+    removerSkipConcorrente(lista, 0, 50);
+    imprimir(lista);
+    printf("Contem 40: %s, contem 50: %s\n", contemSkip(lista, 0, 40) ? "sim" : "nao",
+           contemSkip(lista, 0, 50) ? "sim" : "nao");
+    liberarListaSkipConcorrente(lista);
+
+    printf("\n%-8s %-16s %-8s %-16s\n", "Threads", "Insercoes/s", "Ordem", "Carga mista/s");
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        lista = criarListaSkipConcorrente(4);
+        double tempoInsercao = executar(inserirFatia, lista, threads, total, &encontrados);
+
+        // Confere se o nível 0 está ordenado e sem repetições
+        size_t contados = 0;
+        bool ordenada = true;
+        long long ultimo = LLONG_MIN;
+        for (struct no *atual = ponteiro(atomic_load(&lista->cabeca->proximo[0]));
+             atual != lista->cauda; atual = ponteiro(atomic_load(&atual->proximo[0]))) {
+            ordenada = ordenada && atual->numero > ultimo;
+            ultimo = atual->numero;
+            contados++;
+        }
+        ordenada = ordenada && contados == atomic_load(&lista->tamanho);
+
+        double tempoMisto = executar(cargaMista, lista, threads, total, &encontrados);
+        printf("%-8d %-16.0f %-8s %-16.0f (%zu elementos)\n", threads, total / tempoInsercao,
+               ordenada ? "ok" : "ERRO", total / tempoMisto, atomic_load(&lista->tamanho));
+        liberarListaSkipConcorrente(lista);
+    }
+
+    return 0;
+}
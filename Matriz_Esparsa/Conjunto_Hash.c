@@ -0,0 +1,446 @@
+/**
+ * Implementação de Conjunto Hash com Endereçamento Aberto (Swiss Table) em C
+ *
+ * Matriz_Esparsa.c espalha os números em MODULO = 5 listas, então toda
+ * busca, inserção ou remoção percorre em média n/5 nós. Este conjunto usa
+ * endereçamento aberto no estilo Swiss Table:
+ * - As chaves ficam em um vetor contíguo, e cada posição tem um byte de
+ *   controle: vazio, apagado ou ocupado + 7 bits do hash da chave
+ * - Os bytes de controle são lidos em grupos de 16 com SSE2: uma comparação
+ *   e um movemask dizem quais das 16 posições podem conter a chave, e só
+ *   essas chaves são comparadas. Um grupo com posição vazia encerra a busca
+ * - Fator de carga configurável (posições ocupadas + apagadas / capacidade)
+ * - Redimensionamento incremental: ao passar do fator de carga, uma tabela
+ *   nova é criada e cada inserção ou remoção seguinte migra alguns grupos
+ *   da antiga. Nenhuma operação para para copiar a tabela inteira, o que
+ *   evita picos de latência de segundos em tabelas de 10^8 chaves
+ * - O byte vazio é 0, então a tabela nova sai de calloc já vazia, sem um
+ *   memset do tamanho da tabela no meio de uma inserção
+ *
+ * O main mostra um exemplo pequeno e mede inserção, busca e remoção, além
+ * da maior latência de uma inserção com e sem redimensionamento incremental.
+ *
+ *   gcc -O2 Conjunto_Hash.c -o conjunto_hash
+ *   ./conjunto_hash [chaves] [fator_de_carga]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define TAMANHO_GRUPO 16
+#define GRUPOS_POR_PASSO 2      // Grupos migrados a cada inserção ou remoção
+
+#define CONTROLE_VAZIO 0x00
+#define CONTROLE_APAGADO 0x01
+#define CONTROLE_OCUPADO 0x80   // Ocupado: 0x80 | 7 bits do hash
+
+// Uma tabela de endereçamento aberto
+struct tabelaHash {
+    uint8_t *controle;          // Um byte por posição
+    int *chaves;
+    size_t capacidade;          // Potência de 2, múltiplo de TAMANHO_GRUPO
+    size_t ocupados;
+    size_t apagados;
+};
+
+// Conjunto: a tabela atual e, durante um redimensionamento, a antiga
+struct conjuntoHash {
+    struct tabelaHash atual;
+    struct tabelaHash antiga;
+    bool migrando;
+    size_t cursorMigracao;      // Próximo grupo da tabela antiga a migrar
+    double fatorCarga;
+    bool incremental;           // false = migra tudo de uma vez (para comparação)
+    size_t tamanho;
+};
+
+/**
+ * Hash de 64 bits da chave (finalizador do MurmurHash3)
+ * Os 7 bits baixos vão para o byte de controle e o resto escolhe o grupo.
+ */
+static inline uint64_t hashChave(int chave) {
+    uint64_t h = (uint32_t) chave;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * Máscara das posições do grupo cujo controle é igual a valor
+ */
+static inline uint32_t compararGrupo(const uint8_t *grupo, uint8_t valor) {
+#ifdef __SSE2__
+    __m128i controles = _mm_loadu_si128((const __m128i *) grupo);
+    return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(controles, _mm_set1_epi8((char) valor)));
+#else
+    uint32_t mascara = 0;
+    for (int i = 0; i < TAMANHO_GRUPO; i++) {
+        mascara |= (uint32_t) (grupo[i] == valor) << i;
+    }
+    return mascara;
+#endif
+}
+
+/**
+ * Máscara das posições livres do grupo (vazias ou apagadas: bit alto 0)
+ */
+static inline uint32_t livresGrupo(const uint8_t *grupo) {
+#ifdef __SSE2__
+    __m128i controles = _mm_loadu_si128((const __m128i *) grupo);
+    return (uint32_t) _mm_movemask_epi8(controles) ^ 0xFFFFu;
+#else
+    uint32_t mascara = 0;
+    for (int i = 0; i < TAMANHO_GRUPO; i++) {
+        mascara |= (uint32_t) (grupo[i] < CONTROLE_OCUPADO) << i;
+    }
+    return mascara;
+#endif
+}
+
+/**
+ * Cria uma tabela vazia
+ * @param capacidade Posições (potência de 2, pelo menos TAMANHO_GRUPO)
+ */
+static struct tabelaHash criarTabela(size_t capacidade) {
+    struct tabelaHash t;
+    t.capacidade = capacidade;
+    t.ocupados = 0;
+    t.apagados = 0;
+    t.controle = (uint8_t *) calloc(capacidade, 1);
+    t.chaves = (int *) malloc(capacidade * sizeof(int));
+    if (t.controle == NULL || t.chaves == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    return t;
+}
+
+static void liberarTabela(struct tabelaHash *t) {
+    free(t->controle);
+    free(t->chaves);
+    t->controle = NULL;
+    t->chaves = NULL;
+    t->capacidade = 0;
+    t->ocupados = 0;
+    t->apagados = 0;
+}
+
+/**
+ * Procura uma chave na tabela
+ * Os grupos são visitados em sondagem quadrática (0, 1, 3, 6, ... grupos
+ * adiante), que passa por todos quando a quantidade de grupos é potência de 2.
+ * @return Posição da chave ou -1
+ */
+static inline long procurarNaTabela(const struct tabelaHash *t, int chave, uint64_t h) {
+    if (t->capacidade == 0) {
+        return -1;
+    }
+    size_t mascaraGrupos = t->capacidade / TAMANHO_GRUPO - 1;
+    size_t grupo = (h >> 7) & mascaraGrupos;
+    uint8_t marca = (uint8_t) (CONTROLE_OCUPADO | (h & 0x7F));
+    for (size_t passo = 1;; passo++) {
+        const uint8_t *controles = t->controle + grupo * TAMANHO_GRUPO;
+        uint32_t candidatos = compararGrupo(controles, marca);
+        while (candidatos != 0) {
+            size_t posicao = grupo * TAMANHO_GRUPO + (size_t) __builtin_ctz(candidatos);
+            if (t->chaves[posicao] == chave) {
+                return (long) posicao;
+            }
+            candidatos &= candidatos - 1;
+        }
+        if (compararGrupo(controles, CONTROLE_VAZIO) != 0 || passo > mascaraGrupos) {
+            return -1;
+        }
+        grupo = (grupo + passo) & mascaraGrupos;
+    }
+}
+
+/**
+ * Grava uma chave que não está na tabela na primeira posição livre
+ */
+static inline void colocarNaTabela(struct tabelaHash *t, int chave, uint64_t h) {
+    size_t mascaraGrupos = t->capacidade / TAMANHO_GRUPO - 1;
+    size_t grupo = (h >> 7) & mascaraGrupos;
+    for (size_t passo = 1;; passo++) {
+        uint32_t livres = livresGrupo(t->controle + grupo * TAMANHO_GRUPO);
+        if (livres != 0) {
+            size_t posicao = grupo * TAMANHO_GRUPO + (size_t) __builtin_ctz(livres);
+            if (t->controle[posicao] == CONTROLE_APAGADO) {
+                t->apagados--;
+            }
+            t->controle[posicao] = (uint8_t) (CONTROLE_OCUPADO | (h & 0x7F));
+            t->chaves[posicao] = chave;
+            t->ocupados++;
+            return;
+        }
+        grupo = (grupo + passo) & mascaraGrupos;
+    }
+}
+
+/**
+ * Libera uma posição ocupada
+ * Se o grupo ainda tem posição vazia, ele nunca ficou cheio desde que a
+ * tabela foi criada, então nenhuma busca passou por ele e a posição pode
+ * voltar a vazia. Senão vira apagada, para não interromper as buscas.
+ */
+static inline void esvaziarPosicao(struct tabelaHash *t, size_t posicao) {
+    const uint8_t *grupo = t->controle + (posicao / TAMANHO_GRUPO) * TAMANHO_GRUPO;
+    if (compararGrupo(grupo, CONTROLE_VAZIO) != 0) {
+        t->controle[posicao] = CONTROLE_VAZIO;
+    } else {
+        t->controle[posicao] = CONTROLE_APAGADO;
+        t->apagados++;
+    }
+    t->ocupados--;
+}
+
+/**
+ * Cria um conjunto vazio
+ * @param capacidadeInicial Posições reservadas (arredondadas para potência de 2)
+ * @param fatorCarga Ocupação máxima antes de redimensionar (entre 0.25 e 0.9375)
+ * @return Conjunto criado
+ */
+struct conjuntoHash *criarConjunto(size_t capacidadeInicial, double fatorCarga) {
+    struct conjuntoHash *c = (struct conjuntoHash *) calloc(1, sizeof(struct conjuntoHash));
+    if (c == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    size_t capacidade = TAMANHO_GRUPO;
+    while (capacidade < capacidadeInicial) {
+        capacidade *= 2;
+    }
+    c->atual = criarTabela(capacidade);
+    c->fatorCarga = fatorCarga < 0.25 ? 0.25 : fatorCarga > 0.9375 ? 0.9375 : fatorCarga;
+    c->incremental = true;
+    return c;
+}
+
+/**
+ * Migra alguns grupos da tabela antiga para a atual
+ * As posições migradas viram apagadas na antiga: a chave não é mais achada
+ * lá, e as buscas que passam pelo grupo continuam até as chaves restantes.
+ * @param grupos Quantidade de grupos a migrar
+ */
+static void migrarGrupos(struct conjuntoHash *c, size_t grupos) {
+    size_t totalGrupos = c->antiga.capacidade / TAMANHO_GRUPO;
+    for (size_t g = 0; g < grupos && c->cursorMigracao < totalGrupos; g++, c->cursorMigracao++) {
+        size_t base = c->cursorMigracao * TAMANHO_GRUPO;
+        uint32_t ocupadas = livresGrupo(c->antiga.controle + base) ^ 0xFFFFu;
+        while (ocupadas != 0) {
+            size_t posicao = base + (size_t) __builtin_ctz(ocupadas);
+            int chave = c->antiga.chaves[posicao];
+            colocarNaTabela(&c->atual, chave, hashChave(chave));
+            c->antiga.controle[posicao] = CONTROLE_APAGADO;
+            ocupadas &= ocupadas - 1;
+        }
+    }
+    if (c->cursorMigracao >= totalGrupos) {
+        liberarTabela(&c->antiga);
+        c->migrando = false;
+    }
+}
+
+/**
+ * Troca a tabela atual por uma nova quando passa do fator de carga
+ * Se quase tudo o que ocupa a tabela são posições apagadas, a nova tem a
+ * mesma capacidade (só limpa os apagados); senão tem o dobro.
+ */
+static void verificarCarga(struct conjuntoHash *c) {
+    struct tabelaHash *t = &c->atual;
+    if ((double) (t->ocupados + t->apagados + 1) <= c->fatorCarga * (double) t->capacidade) {
+        return;
+    }
+    if (c->migrando) {
+        migrarGrupos(c, SIZE_MAX);   // Migração anterior ainda não acabou
+    }
+    size_t capacidade = t->capacidade;
+    if ((double) (c->tamanho + 1) > c->fatorCarga * (double) capacidade / 2) {
+        capacidade *= 2;
+    }
+    c->antiga = c->atual;
+    c->atual = criarTabela(capacidade);
+    c->cursorMigracao = 0;
+    c->migrando = true;
+    if (!c->incremental) {
+        migrarGrupos(c, SIZE_MAX);
+    }
+}
+
+/**
+ * Verifica se a chave está no conjunto
+ * @param c Conjunto
+ * @param chave Chave procurada
+ * @return true se a chave está no conjunto
+ */
+bool contemConjunto(const struct conjuntoHash *c, int chave) {
+    uint64_t h = hashChave(chave);
+    return procurarNaTabela(&c->atual, chave, h) >= 0 ||
+           (c->migrando && procurarNaTabela(&c->antiga, chave, h) >= 0);
+}
+
+/**
+ * Insere uma chave no conjunto
+ * @param c Conjunto
+ * @param chave Chave a inserir
+ * @return true se a chave era nova
+ */
+bool inserirConjunto(struct conjuntoHash *c, int chave) {
+    if (c->migrando) {
+        migrarGrupos(c, GRUPOS_POR_PASSO);
+    }
+    if (contemConjunto(c, chave)) {
+        return false;
+    }
+    verificarCarga(c);
+    colocarNaTabela(&c->atual, chave, hashChave(chave));
+    c->tamanho++;
+    return true;
+}
+
+/**
+ * Remove uma chave do conjunto
+ * @param c Conjunto
+ * @param chave Chave a remover
+ * @return true se a chave estava no conjunto
+ */
+bool removerConjunto(struct conjuntoHash *c, int chave) {
+    if (c->migrando) {
+        migrarGrupos(c, GRUPOS_POR_PASSO);
+    }
+    uint64_t h = hashChave(chave);
+    long posicao = procurarNaTabela(&c->atual, chave, h);
+    if (posicao >= 0) {
+        esvaziarPosicao(&c->atual, (size_t) posicao);
+    } else if (c->migrando && (posicao = procurarNaTabela(&c->antiga, chave, h)) >= 0) {
+        esvaziarPosicao(&c->antiga, (size_t) posicao);
+    } else {
+        return false;
+    }
+    c->tamanho--;
+    return true;
+}
+
+/**
+ * Imprime as chaves do conjunto (na ordem da tabela)
+ */
+void imprimir(const struct conjuntoHash *c) {
+    printf("Conjunto com %zu chaves (capacidade %zu%s): ", c->tamanho, c->atual.capacidade,
+           c->migrando ? ", migrando" : "");
+    const struct tabelaHash *tabelas[2] = {&c->atual, &c->antiga};
+    for (int k = 0; k < (c->migrando ? 2 : 1); k++) {
+        for (size_t i = 0; i < tabelas[k]->capacidade; i++) {
+            if (tabelas[k]->controle[i] >= CONTROLE_OCUPADO) {
+                printf("%d ", tabelas[k]->chaves[i]);
+            }
+        }
+    }
+    printf("\n");
+}
+
+/**
+ * Libera toda a memória do conjunto
+ */
+void liberarConjunto(struct conjuntoHash *c) {
+    liberarTabela(&c->atual);
+    liberarTabela(&c->antiga);
+    free(c);
+}
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+/**
+ * i-ésima chave do teste: multiplicação por um ímpar é uma bijeção em 32
+ * bits, então as chaves são distintas e espalhadas
+ */
+static inline int chaveTeste(size_t i) {
+    return (int) (uint32_t) ((uint32_t) i * 2654435761u);
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+    double fatorCarga = argc > 2 ? atof(argv[2]) : 0.875;
+    struct timespec t0, t1, t2;
+
+    // Exemplo pequeno, como em Matriz_Esparsa.c
+    struct conjuntoHash *c = criarConjunto(0, fatorCarga);
+    for (int i = 0; i < 100; i++) {
+        inserirConjunto(c, i);
+    }
+    for (int i = 0; i < 50; i++) {
+        removerConjunto(c, i);
+    }
+    imprimir(c);
+    printf("Contém 10? %s  Contém 75? %s\n\n", contemConjunto(c, 10) ? "sim" : "não", contemConjunto(c, 75) ? "sim" : "não");
+    liberarConjunto(c);
+
+    printf("%zu chaves, fator de carga %.3f\n", n, fatorCarga);
+    printf("%-12s %12s %14s %16s\n", "Migracao", "ns/insercao", "maior (us)", "acima de 100 us");
+    for (int incremental = 0; incremental < 2; incremental++) {
+        c = criarConjunto(0, fatorCarga);
+        c->incremental = incremental;
+        double maior = 0.0;
+        size_t lentas = 0;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (size_t i = 0; i < n; i++) {
+            clock_gettime(CLOCK_MONOTONIC, &t1);
+            inserirConjunto(c, chaveTeste(i));
+            clock_gettime(CLOCK_MONOTONIC, &t2);
+            double latencia = (double) (t2.tv_sec - t1.tv_sec) * 1e6 + (double) (t2.tv_nsec - t1.tv_nsec) / 1e3;
+            if (latencia > maior) {
+                maior = latencia;
+            }
+            lentas += latencia > 100.0;
+        }
+        double segundos = segundosDesde(&t0);
+        printf("%-12s %12.1f %14.1f %16zu\n", incremental ? "incremental" : "de uma vez",
+               segundos * 1e9 / (double) n, maior, lentas);
+        if (!incremental) {
+            liberarConjunto(c);
+        }
+    }
+    printf("(ns/insercao inclui as duas leituras de relogio por operacao)\n\n");
+
+    // Buscas e remoções no conjunto incremental
+    size_t achados = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (size_t i = 0; i < n; i++) {
+        achados += contemConjunto(c, chaveTeste(i));
+    }
+    double tempoAcertos = segundosDesde(&t0);
+    size_t falsos = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (size_t i = n; i < 2 * n; i++) {
+        falsos += contemConjunto(c, chaveTeste(i));
+    }
+    double tempoFalhas = segundosDesde(&t0);
+    size_t removidos = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (size_t i = 0; i < n; i++) {
+        removidos += removerConjunto(c, chaveTeste(i));
+    }
+    double tempoRemocao = segundosDesde(&t0);
+
+    printf("Busca (presente): %6.1f ns  (%zu de %zu achadas)\n", tempoAcertos * 1e9 / (double) n, achados, n);
+    printf("Busca (ausente):  %6.1f ns  (%zu falsos positivos)\n", tempoFalhas * 1e9 / (double) n, falsos);
+    printf("Remoção:          %6.1f ns  (%zu removidas, sobraram %zu)\n", tempoRemocao * 1e9 / (double) n, removidos, c->tamanho);
+    liberarConjunto(c);
+    return 0;
+}
@@ -0,0 +1,543 @@
+/**
+ * Implementação de Mapa Hash Concorrente com Travas por Faixa em C
+ *
+ * Em Matriz_Esparsa.c cada diretor é dono de um grupo de números. Este mapa
+ * leva a mesma ideia para várias threads: os baldes da tabela são divididos
+ * em faixas (balde i pertence à faixa i % faixas), e cada faixa tem a sua
+ * trava de leitura/escrita. Threads que mexem em faixas diferentes não se
+ * esperam, em vez de todas passarem por um mutex global.
+ * - inserirOuAtualizar: procura a chave e, existindo ou não, aplica uma
+ *   função ao valor sob a trava da faixa, então a atualização é atômica em
+ *   relação às outras operações sobre a mesma chave
+ * - Redimensionamento online: a tabela dobra faixa por faixa. Cada faixa
+ *   guarda qual tabela usa; migrar uma faixa trava só ela, enquanto leitores
+ *   e escritores das outras continuam (cada um na tabela antiga ou na nova,
+ *   conforme a sua faixa já tenha sido migrada ou não). Como a capacidade é
+ *   sempre múltiplo da quantidade de faixas, uma chave fica na mesma faixa
+ *   nas duas tabelas
+ * - paraCadaParalelo: percorre o mapa com várias threads, cada uma com
+ *   algumas faixas sob trava de leitura e o seu próprio contexto
+ *
+ * O main compara a vazão de inserções concorrentes com 64 faixas e com uma
+ * faixa só (equivalente a uma trava global), e confere que leitores nunca
+ * deixam de achar uma chave enquanto a tabela é redimensionada.
+ *
+ *   gcc -O2 -pthread Mapa_Hash_Concorrente.c -o mapa_concorrente
+ *   ./mapa_concorrente [operacoes] [chaves_distintas]
+ */
+
+#define _GNU_SOURCE             // pthread_rwlockattr_setkind_np
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include "../Alocador_Nos/Alocador_Nos.h"
+
+#define FAIXAS_PADRAO 64
+#define CARGA_MAXIMA 2          // Média de nós por balde antes de dobrar a tabela
+#define MAX_THREADS 64
+
+// Par chave/valor encadeado no balde
+struct no {
+    int chave;
+    long valor;
+    struct no *proximo;
+};
+
+// Alocador dos nós (caches por thread, ver Alocador_Nos.h)
+static struct alocadorNos alocadorMapa = ALOCADOR_NOS_INICIALIZADOR(struct no);
+
+// Faixa de baldes com trava própria (uma linha de cache por faixa)
+struct faixa {
+    alignas(64) pthread_rwlock_t trava;
+    struct no **baldes;         // Tabela usada por esta faixa (a antiga até ser migrada)
+    size_t capacidade;
+    size_t quantidade;          // Chaves nesta faixa
+};
+
+// Mapa concorrente
+struct mapaConcorrente {
+    struct faixa *faixas;
+    size_t quantidadeFaixas;    // Potência de 2
+    pthread_mutex_t travaRedimensionamento;
+    struct no **baldes;         // Tabela mais nova
+    atomic_size_t capacidade;
+    atomic_long redimensionamentos;
+};
+
+// Função aplicada ao valor por inserirOuAtualizar
+typedef void (*atualizador)(long *valor, bool nova, void *contexto);
+
+// Função chamada para cada par por paraCadaParalelo
+typedef void (*visitante)(int chave, long valor, void *contexto);
+
+static inline uint32_t hashChave(int chave) {
+    uint32_t h = (uint32_t) chave;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+static struct no **alocarBaldes(size_t capacidade) {
+    struct no **baldes = (struct no **) calloc(capacidade, sizeof(struct no *));
+    if (baldes == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    return baldes;
+}
+
+/**
+ * Cria um mapa vazio
+ * @param quantidadeFaixas Travas independentes (arredondado para potência de 2)
+ * @param capacidadeInicial Baldes iniciais (arredondado para potência de 2 >= faixas)
+ * @return Mapa criado
+ */
+struct mapaConcorrente *criarMapa(size_t quantidadeFaixas, size_t capacidadeInicial) {
+    struct mapaConcorrente *m = (struct mapaConcorrente *) malloc(sizeof(struct mapaConcorrente));
+    if (m == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    size_t faixas = 1;
+    while (faixas < quantidadeFaixas) {
+        faixas *= 2;
+    }
+    size_t capacidade = faixas;
+    while (capacidade < capacidadeInicial) {
+        capacidade *= 2;
+    }
+    m->faixas = (struct faixa *) aligned_alloc(alignof(struct faixa), faixas * sizeof(struct faixa));
+    if (m->faixas == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    m->quantidadeFaixas = faixas;
+    m->baldes = alocarBaldes(capacidade);
+    atomic_init(&m->capacidade, capacidade);
+    atomic_init(&m->redimensionamentos, 0);
+    pthread_mutex_init(&m->travaRedimensionamento, NULL);
+
+    // Escritores têm preferência: com a preferência padrão (leitores), uma
+    // faixa muito lida impediria para sempre a sua migração
+    pthread_rwlockattr_t atributos;
+    pthread_rwlockattr_init(&atributos);
+    pthread_rwlockattr_setkind_np(&atributos, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+    for (size_t f = 0; f < faixas; f++) {
+        pthread_rwlock_init(&m->faixas[f].trava, &atributos);
+        m->faixas[f].baldes = m->baldes;
+        m->faixas[f].capacidade = capacidade;
+        m->faixas[f].quantidade = 0;
+    }
+    pthread_rwlockattr_destroy(&atributos);
+    return m;
+}
+
+/**
+ * Dobra a tabela, migrando uma faixa de cada vez
+ * Só um redimensionamento acontece por vez; quem chega depois e vê que a
+ * tabela já cresceu desde que decidiu crescer simplesmente volta.
+ * @param m Mapa
+ * @param capacidadeVista Capacidade que motivou o pedido
+ */
+static void redimensionar(struct mapaConcorrente *m, size_t capacidadeVista) {
+    pthread_mutex_lock(&m->travaRedimensionamento);
+    size_t antiga = atomic_load(&m->capacidade);
+    if (antiga != capacidadeVista) {
+        pthread_mutex_unlock(&m->travaRedimensionamento);
+        return;
+    }
+    size_t nova = antiga * 2;
+    struct no **baldesAntigos = m->baldes;
+    struct no **baldesNovos = alocarBaldes(nova);
+
+    for (size_t f = 0; f < m->quantidadeFaixas; f++) {
+        struct faixa *faixa = &m->faixas[f];
+        pthread_rwlock_wrlock(&faixa->trava);
+        for (size_t b = f; b < antiga; b += m->quantidadeFaixas) {
+            struct no *atual = baldesAntigos[b];
+            while (atual != NULL) {
+                struct no *proximo = atual->proximo;
+                size_t destino = hashChave(atual->chave) & (nova - 1);
+                atual->proximo = baldesNovos[destino];
+                baldesNovos[destino] = atual;
+                atual = proximo;
+            }
+        }
+        faixa->baldes = baldesNovos;
+        faixa->capacidade = nova;
+        pthread_rwlock_unlock(&faixa->trava);
+    }
+
+    // Nenhuma faixa aponta mais para a tabela antiga
+    free(baldesAntigos);
+    m->baldes = baldesNovos;
+    atomic_store(&m->capacidade, nova);
+    atomic_fetch_add(&m->redimensionamentos, 1);
+    pthread_mutex_unlock(&m->travaRedimensionamento);
+}
+
+/**
+ * Busca o valor de uma chave
+ * @param m Mapa
+ * @param chave Chave procurada
+ * @param valor Recebe o valor, se encontrado (pode ser NULL)
+ * @return true se a chave está no mapa
+ */
+bool buscarMapa(struct mapaConcorrente *m, int chave, long *valor) {
+    uint32_t h = hashChave(chave);
+    struct faixa *faixa = &m->faixas[h & (m->quantidadeFaixas - 1)];
+    pthread_rwlock_rdlock(&faixa->trava);
+    struct no *atual = faixa->baldes[h & (faixa->capacidade - 1)];
+    while (atual != NULL && atual->chave != chave) {
+        atual = atual->proximo;
+    }
+    bool achou = atual != NULL;
+    if (achou && valor != NULL) {
+        *valor = atual->valor;
+    }
+    pthread_rwlock_unlock(&faixa->trava);
+    return achou;
+}
+
+/**
+ * Insere a chave (com valor 0) se não existir e aplica a função ao valor
+ * Tudo acontece sob a trava de escrita da faixa: duas threads atualizando
+ * a mesma chave nunca perdem uma atualização.
+ * @param m Mapa
+ * @param chave Chave
+ * @param funcao Recebe o ponteiro do valor e se a chave acabou de ser criada
+ * @param contexto Repassado à função
+ * @return true se a chave foi criada
+ */
+bool inserirOuAtualizar(struct mapaConcorrente *m, int chave, atualizador funcao, void *contexto) {
+    uint32_t h = hashChave(chave);
+    struct faixa *faixa = &m->faixas[h & (m->quantidadeFaixas - 1)];
+    pthread_rwlock_wrlock(&faixa->trava);
+    struct no **balde = &faixa->baldes[h & (faixa->capacidade - 1)];
+    struct no *atual = *balde;
+    while (atual != NULL && atual->chave != chave) {
+        atual = atual->proximo;
+    }
+    bool nova = atual == NULL;
+    if (nova) {
+        atual = (struct no *) alocarNo(&alocadorMapa);
+        if (atual == NULL) {
+            fprintf(stderr, "Erro na alocação de memória.\n");
+            exit(EXIT_FAILURE);
+        }
+        atual->chave = chave;
+        atual->valor = 0;
+        atual->proximo = *balde;
+        *balde = atual;
+        faixa->quantidade++;
+    }
+    funcao(&atual->valor, nova, contexto);
+
+    // A faixa tem capacidade / faixas baldes; passou da carga, a tabela dobra
+    size_t capacidadeVista = faixa->capacidade;
+    bool crescer = nova && faixa->quantidade > CARGA_MAXIMA * (capacidadeVista / m->quantidadeFaixas);
+    pthread_rwlock_unlock(&faixa->trava);
+    if (crescer) {
+        redimensionar(m, capacidadeVista);
+    }
+    return nova;
+}
+
+/**
+ * Remove uma chave do mapa
+ * @param m Mapa
+ * @param chave Chave a remover
+ * @return true se a chave estava no mapa
+ */
+bool removerMapa(struct mapaConcorrente *m, int chave) {
+    uint32_t h = hashChave(chave);
+    struct faixa *faixa = &m->faixas[h & (m->quantidadeFaixas - 1)];
+    pthread_rwlock_wrlock(&faixa->trava);
+    struct no **anterior = &faixa->baldes[h & (faixa->capacidade - 1)];
+    while (*anterior != NULL && (*anterior)->chave != chave) {
+        anterior = &(*anterior)->proximo;
+    }
+    struct no *excluir = *anterior;
+    if (excluir != NULL) {
+        *anterior = excluir->proximo;
+        faixa->quantidade--;
+    }
+    pthread_rwlock_unlock(&faixa->trava);
+    if (excluir != NULL) {
+        liberarNo(&alocadorMapa, excluir);
+    }
+    return excluir != NULL;
+}
+
+/**
+ * Quantidade de chaves (soma das faixas, cada uma lida sob a sua trava)
+ */
+size_t tamanhoMapa(struct mapaConcorrente *m) {
+    size_t total = 0;
+    for (size_t f = 0; f < m->quantidadeFaixas; f++) {
+        pthread_rwlock_rdlock(&m->faixas[f].trava);
+        total += m->faixas[f].quantidade;
+        pthread_rwlock_unlock(&m->faixas[f].trava);
+    }
+    return total;
+}
+
+// Parte de um percurso paralelo
+struct tarefaPercurso {
+    struct mapaConcorrente *mapa;
+    size_t primeiraFaixa;
+    size_t passo;               // Quantidade de threads
+    visitante funcao;
+    void *contexto;
+};
+
+static void *percorrerFaixas(void *arg) {
+    struct tarefaPercurso *t = (struct tarefaPercurso *) arg;
+    struct mapaConcorrente *m = t->mapa;
+    for (size_t f = t->primeiraFaixa; f < m->quantidadeFaixas; f += t->passo) {
+        struct faixa *faixa = &m->faixas[f];
+        pthread_rwlock_rdlock(&faixa->trava);
+        for (size_t b = f; b < faixa->capacidade; b += m->quantidadeFaixas) {
+            for (struct no *atual = faixa->baldes[b]; atual != NULL; atual = atual->proximo) {
+                t->funcao(atual->chave, atual->valor, t->contexto);
+            }
+        }
+        pthread_rwlock_unlock(&faixa->trava);
+    }
+    return NULL;
+}
+
+/**
+ * Aplica uma função a todos os pares, em paralelo
+ * Cada faixa é lida sob trava de leitura, então o percurso pode rodar junto
+ * com outras operações; a função não deve alterar o mapa.
+ * @param m Mapa
+ * @param threads Quantidade de threads (até MAX_THREADS)
+ * @param funcao Função chamada para cada par
+ * @param contextos Vetor com um contexto por thread
+ * @param tamanhoContexto sizeof de cada contexto
+ */
+void paraCadaParalelo(struct mapaConcorrente *m, int threads, visitante funcao, void *contextos, size_t tamanhoContexto) {
+    pthread_t ids[MAX_THREADS];
+    struct tarefaPercurso tarefas[MAX_THREADS];
+    if (threads > MAX_THREADS) {
+        threads = MAX_THREADS;
+    }
+    for (int t = 0; t < threads; t++) {
+        tarefas[t] = (struct tarefaPercurso) {m, (size_t) t, (size_t) threads, funcao,
+                                              (char *) contextos + (size_t) t * tamanhoContexto};
+        pthread_create(&ids[t], NULL, percorrerFaixas, &tarefas[t]);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+}
+
+/**
+ * Libera toda a memória do mapa
+ */
+void liberarMapa(struct mapaConcorrente *m) {
+    size_t capacidade = atomic_load(&m->capacidade);
+    for (size_t b = 0; b < capacidade; b++) {
+        struct no *atual = m->baldes[b];
+        while (atual != NULL) {
+            struct no *excluir = atual;
+            atual = atual->proximo;
+            liberarNo(&alocadorMapa, excluir);
+        }
+    }
+    for (size_t f = 0; f < m->quantidadeFaixas; f++) {
+        pthread_rwlock_destroy(&m->faixas[f].trava);
+    }
+    pthread_mutex_destroy(&m->travaRedimensionamento);
+    free(m->baldes);
+    free(m->faixas);
+    free(m);
+}
+
+// Funções usadas pelo main
+static void somar(long *valor, bool nova, void *contexto) {
+    (void) nova;
+    *valor += *(const long *) contexto;
+}
+
+static void definir(long *valor, bool nova, void *contexto) {
+    (void) nova;
+    *valor = *(const long *) contexto;
+}
+
+// Contexto de cada thread no percurso: soma dos valores e chaves vistas
+struct totais {
+    long soma;
+    long chaves;
+};
+
+static void acumular(int chave, long valor, void *contexto) {
+    (void) chave;
+    struct totais *t = (struct totais *) contexto;
+    t->soma += valor;
+    t->chaves++;
+}
+
+static void imprimirPar(int chave, long valor, void *contexto) {
+    (void) contexto;
+    printf("%d:%ld ", chave, valor);
+}
+
+// Parâmetros de cada thread dos testes
+struct parametrosTeste {
+    struct mapaConcorrente *mapa;
+    long operacoes;
+    int chaves;                 // Chaves sorteadas em [0, chaves)
+    long semente;
+    atomic_bool *parar;         // Teste de leitores: avisa o fim das escritas
+    long leituras;
+    long erradas;
+};
+
+/**
+ * Thread do teste de ingestão: soma 1 em chaves sorteadas
+ */
+static void *ingerir(void *arg) {
+    struct parametrosTeste *p = (struct parametrosTeste *) arg;
+    uint64_t x = 0x2545F4914F6CDD1Dull * (uint64_t) (p->semente + 1);
+    long um = 1;
+    for (long i = 0; i < p->operacoes; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        inserirOuAtualizar(p->mapa, (int) ((x >> 8) % (uint64_t) p->chaves), somar, &um);
+    }
+    liberarCacheThread(&alocadorMapa);
+    return NULL;
+}
+
+/**
+ * Thread leitora: busca chaves pré-inseridas (valor = chave) até o fim das escritas
+ */
+static void *ler(void *arg) {
+    struct parametrosTeste *p = (struct parametrosTeste *) arg;
+    uint64_t x = 0x9E3779B97F4A7C15ull * (uint64_t) (p->semente + 1);
+    while (!atomic_load(p->parar)) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        int chave = (int) ((x >> 8) % (uint64_t) p->chaves);
+        long valor;
+        if (!buscarMapa(p->mapa, chave, &valor) || valor != chave) {
+            p->erradas++;
+        }
+        p->leituras++;
+    }
+    return NULL;
+}
+
+/**
+ * Executa o teste de ingestão com n threads
+ * @param faixas Faixas do mapa (1 = trava global)
+ * @param correto Recebe se a soma dos valores confere com as operações
+ * @return Milhões de operações por segundo
+ */
+static double executarTeste(size_t faixas, int threads, long total, int chaves, bool *correto) {
+    struct mapaConcorrente *m = criarMapa(faixas, 64);
+    pthread_t ids[MAX_THREADS];
+    struct parametrosTeste params[MAX_THREADS];
+    struct timespec t0, t1;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < threads; i++) {
+        params[i] = (struct parametrosTeste) {m, total / threads, chaves, i, NULL, 0, 0};
+        pthread_create(&ids[i], NULL, ingerir, &params[i]);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(ids[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    // Confere com um percurso paralelo: a soma dos contadores é o total de operações
+    struct totais totais[4] = {{0, 0}};
+    paraCadaParalelo(m, 4, acumular, totais, sizeof(struct totais));
+    long soma = 0, contadas = 0;
+    for (int i = 0; i < 4; i++) {
+        soma += totais[i].soma;
+        contadas += totais[i].chaves;
+    }
+    *correto = soma == total / threads * threads && (size_t) contadas == tamanhoMapa(m);
+
+    liberarMapa(m);
+    double segundos = (double) (t1.tv_sec - t0.tv_sec) + (double) (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    return (double) (total / threads * threads) / segundos / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+    long total = argc > 1 ? atol(argv[1]) : 2000000;
+    int chaves = argc > 2 ? atoi(argv[2]) : 1 << 20;
+
+    // Exemplo de uso em uma única thread
+    struct mapaConcorrente *m = criarMapa(4, 4);
+    long valores[] = {10, 20, 30, 40, 50};
+    for (int i = 0; i < 5; i++) {
+        inserirOuAtualizar(m, i * 7, definir, &valores[i]);
+    }
+    long cinco = 5;
+    inserirOuAtualizar(m, 14, somar, &cinco);
+    removerMapa(m, 21);
+    long valor = 0;
+    printf("Mapa com %zu chaves: ", tamanhoMapa(m));
+    struct totais vazio;
+    paraCadaParalelo(m, 1, imprimirPar, &vazio, sizeof(vazio));
+    bool achou14 = buscarMapa(m, 14, &valor);
+    printf("\nChave 14: %s%ld, chave 21: %s\n", achou14 ? "" : "ausente ", valor,
+           buscarMapa(m, 21, NULL) ? "presente" : "ausente");
+    liberarMapa(m);
+
+    // Ingestão concorrente: faixas independentes contra uma trava única
+    printf("\n%ld atualizacoes em %d chaves por teste (tabela comeca com 64 baldes)\n", total, chaves);
+    printf("Threads | %d faixas (Mops/s) | Trava global (Mops/s)\n", FAIXAS_PADRAO);
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        bool corretoFaixas, corretoGlobal;
+        double vazaoFaixas = executarTeste(FAIXAS_PADRAO, threads, total, chaves, &corretoFaixas);
+        double vazaoGlobal = executarTeste(1, threads, total, chaves, &corretoGlobal);
+        printf("%7d | %18.2f | %21.2f%s\n", threads, vazaoFaixas, vazaoGlobal,
+               corretoFaixas && corretoGlobal ? "" : "  (CONTAGEM INCORRETA)");
+    }
+
+    // Leitores durante o redimensionamento
+    int preCarregadas = 100000;
+    m = criarMapa(FAIXAS_PADRAO, 64);
+    for (long i = 0; i < preCarregadas; i++) {
+        inserirOuAtualizar(m, (int) i, definir, &i);
+    }
+    long redimensionamentosAntes = atomic_load(&m->redimensionamentos);
+    atomic_bool parar;
+    atomic_init(&parar, false);
+    pthread_t ids[4];
+    struct parametrosTeste leitores[4];
+    for (int i = 0; i < 4; i++) {
+        leitores[i] = (struct parametrosTeste) {m, 0, preCarregadas, i, &parar, 0, 0};
+        pthread_create(&ids[i], NULL, ler, &leitores[i]);
+    }
+    for (long i = preCarregadas; i < 16L * preCarregadas; i++) {
+        inserirOuAtualizar(m, (int) i, definir, &i);
+    }
+    atomic_store(&parar, true);
+    long leituras = 0, erradas = 0;
+    for (int i = 0; i < 4; i++) {
+        pthread_join(ids[i], NULL);
+        leituras += leitores[i].leituras;
+        erradas += leitores[i].erradas;
+    }
+    printf("\nLeitores durante %ld redimensionamentos: %ld buscas, %ld sem a chave ou com valor errado\n",
+           atomic_load(&m->redimensionamentos) - redimensionamentosAntes, leituras, erradas);
+    liberarMapa(m);
+    return 0;
+}
@@ -0,0 +1,590 @@
+/**
+ * Leitor de Arquivos Matrix Market com Cache Binário em C
+ *
+ * O main de Matriz_Esparsa.c só insere os números de 0 a 99; não havia
+ * como carregar dados reais. Este arquivo lê matrizes no formato Matrix
+ * Market (.mtx, formato coordinate) para a COO de Matriz_CSR.h:
+ * - O arquivo é mapeado na memória (mmap) e o corpo é dividido em trechos
+ *   que terminam em quebra de linha, um por thread
+ * - Primeira passada: cada thread conta as linhas do seu trecho; a soma de
+ *   prefixos dá a posição de cada thread na COO, alocada uma vez
+ * - Segunda passada: cada thread converte seu trecho direto na sua faixa
+ *   da COO, com um conversor de números próprio (strtod só nos casos que o
+ *   caminho rápido não garante exatos)
+ * - Matrizes symmetric e skew-symmetric são expandidas em uma terceira
+ *   passada, também paralela; pattern recebe valor 1 e integer vira double
+ *
+ * A CSR resultante pode ser gravada em um cache binário (cabeçalho, inicio,
+ * valor e coluna, nessa ordem e alinhados). Nas execuções seguintes o cache
+ * é mapeado e os vetores da CSR apontam direto para o mapeamento: não há
+ * conversão nenhuma. O cache guarda o tamanho e a data de modificação do
+ * .mtx e é ignorado se o original mudar.
+ *
+ * Todas as funções são static inline, como em Matriz_CSR.h. Usa mmap,
+ * madvise e st_mtim (POSIX 2008 com extensões): defina _DEFAULT_SOURCE antes
+ * do primeiro #include de sistema se compilar com -std=c11 (definido aqui
+ * quando este é o primeiro).
+ */
+
+#ifndef MATRIX_MARKET_H
+#define MATRIX_MARKET_H
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "Matriz_CSR.h"
+
+#define VERSAO_CACHE 1
+#define DIGITOS_EXATOS 19       // Dígitos que cabem em um uint64_t sem estourar
+
+enum simetria {
+    SIMETRIA_GERAL,
+    SIMETRIA_SIMETRICA,
+    SIMETRIA_ANTISSIMETRICA
+};
+
+// Trecho do arquivo convertido por uma thread
+struct tarefaLeitura {
+    const char *inicio;
+    const char *fim;
+    struct matrizCOO *coo;
+    bool padrao;                // pattern: sem valores
+    size_t linhas;              // Passada 1: quebras de linha no trecho
+    size_t posicao;             // Primeira posição da thread na COO
+    size_t lidos;               // Passada 2: entradas convertidas
+    size_t foraDiagonal;        // Entradas com linha != coluna
+    size_t posicaoEspelho;      // Passada 3: onde gravar as entradas espelhadas
+    double sinalEspelho;        // 1 (symmetric) ou -1 (skew-symmetric)
+    const char *erro;           // Posição de uma entrada inválida (ou NULL)
+};
+
+// Cabeçalho do cache binário
+struct cabecalhoCache {
+    char magica[8];             // "CSRCACHE"
+    uint32_t versao;
+    int32_t linhas;
+    int32_t colunas;
+    uint32_t reservado;
+    uint64_t nnz;
+    uint64_t tamanhoOrigem;     // Tamanho do .mtx que gerou o cache
+    int64_t segundosOrigem;     // Data de modificação do .mtx
+    int64_t nanossegundosOrigem;
+    uint64_t preenchimento;     // Completa 64 bytes
+};
+
+// Matriz carregada, do cache mapeado ou convertida do .mtx
+struct matrizCarregada {
+    struct matrizCSR csr;
+    void *mapa;                 // NULL se a CSR foi alocada com malloc
+    size_t tamanhoMapa;
+};
+
+/**
+ * Pula espaços e tabulações (não a quebra de linha)
+ */
+static inline const char *pularEspacos(const char *p, const char *fim) {
+    while (p < fim && (*p == ' ' || *p == '\t' || *p == '\r')) {
+        p++;
+    }
+    return p;
+}
+
+/**
+ * Converte um inteiro sem sinal
+ * @return Posição depois do número, ou NULL se não houver dígitos
+ */
+static inline const char *lerInteiro(const char *p, const char *fim, long long *valor) {
+    long long v = 0;
+    const char *comeco = p;
+    while (p < fim && *p >= '0' && *p <= '9' && p - comeco < 18) {
+        v = v * 10 + (*p - '0');
+        p++;
+    }
+    if (p == comeco || (p < fim && *p >= '0' && *p <= '9')) {
+        return NULL;
+    }
+    *valor = v;
+    return p;
+}
+
+/**
+ * Converte um número real
+ * O caminho rápido junta até 19 dígitos em um inteiro e aplica uma potência
+ * de 10 exata (até 1e22); com mantissa abaixo de 2^53 o resultado é o mesmo
+ * do strtod. Fora disso (muitos dígitos, expoentes grandes, inf, nan), o
+ * número é copiado e passado ao strtod.
+ * @return Posição depois do número, ou NULL se não for um número
+ */
+static inline const char *lerReal(const char *p, const char *fim, double *valor) {
+    static const double potencias[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const char *comeco = p;
+    bool negativo = false;
+    if (p < fim && (*p == '-' || *p == '+')) {
+        negativo = *p == '-';
+        p++;
+    }
+    uint64_t mantissa = 0;
+    int digitos = 0, expoente = 0;
+    bool rapido = true;
+    const char *inicioDigitos = p;
+    while (p < fim && *p >= '0' && *p <= '9') {
+        if (digitos < DIGITOS_EXATOS) {
+            mantissa = mantissa * 10 + (uint64_t) (*p - '0');
+            digitos += mantissa > 0;
+        } else {
+            rapido = false;
+        }
+        p++;
+    }
+    if (p < fim && *p == '.') {
+        p++;
+        while (p < fim && *p >= '0' && *p <= '9') {
+            if (digitos < DIGITOS_EXATOS) {
+                mantissa = mantissa * 10 + (uint64_t) (*p - '0');
+                digitos += mantissa > 0;
+                expoente--;
+            } else {
+                rapido = false;
+            }
+            p++;
+        }
+    }
+    if (p == inicioDigitos || (p == inicioDigitos + 1 && *inicioDigitos == '.')) {
+        rapido = false;             // Sem dígitos: talvez inf ou nan
+    }
+    if (rapido && p < fim && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool expoenteNegativo = false;
+        if (q < fim && (*q == '-' || *q == '+')) {
+            expoenteNegativo = *q == '-';
+            q++;
+        }
+        long long e;
+        q = lerInteiro(q, fim, &e);
+        if (q == NULL || e > 400) {
+            rapido = false;
+        } else {
+            expoente += expoenteNegativo ? -(int) e : (int) e;
+            p = q;
+        }
+    }
+    if (rapido && mantissa < (1ull << 53) && expoente >= -22 && expoente <= 22) {
+        double v = (double) mantissa;
+        v = expoente < 0 ? v / potencias[-expoente] : v * potencias[expoente];
+        *valor = negativo ? -v : v;
+        return p;
+    }
+
+    // Caminho lento: copia o número para terminar em '\0'
+    char copia[128];
+    size_t n = 0;
+    p = comeco;
+    while (p < fim && n < sizeof(copia) - 1 && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') {
+        copia[n++] = *p++;
+    }
+    copia[n] = '\0';
+    char *final;
+    *valor = strtod(copia, &final);
+    if (final == copia || *final != '\0') {
+        return NULL;
+    }
+    return p;
+}
+
+/**
+ * Passada 1: conta as quebras de linha do trecho
+ */
+static inline void *contarLinhasTrecho(void *arg) {
+    struct tarefaLeitura *t = (struct tarefaLeitura *) arg;
+    size_t linhas = 0;
+    const char *p = t->inicio;
+    while (p < t->fim) {
+        const char *quebra = (const char *) memchr(p, '\n', (size_t) (t->fim - p));
+        linhas++;
+        p = quebra != NULL ? quebra + 1 : t->fim;
+    }
+    t->linhas = linhas;
+    return NULL;
+}
+
+/**
+ * Passada 2: converte as entradas do trecho para a COO
+ */
+static inline void *converterTrecho(void *arg) {
+    struct tarefaLeitura *t = (struct tarefaLeitura *) arg;
+    struct matrizCOO *coo = t->coo;
+    const char *p = t->inicio;
+    size_t destino = t->posicao;
+    while (p < t->fim) {
+        p = pularEspacos(p, t->fim);
+        if (p == t->fim || *p == '\n' || *p == '%') {
+            // Linha vazia ou comentário
+            const char *quebra = (const char *) memchr(p, '\n', (size_t) (t->fim - p));
+            p = quebra != NULL ? quebra + 1 : t->fim;
+            continue;
+        }
+        const char *entrada = p;
+        long long i, j;
+        double v = 1.0;
+        p = lerInteiro(p, t->fim, &i);
+        if (p != NULL) {
+            p = lerInteiro(pularEspacos(p, t->fim), t->fim, &j);
+        }
+        if (p != NULL && !t->padrao) {
+            p = lerReal(pularEspacos(p, t->fim), t->fim, &v);
+        }
+        if (p != NULL) {
+            p = pularEspacos(p, t->fim);
+        }
+        if (p == NULL || (p < t->fim && *p != '\n') || i < 1 || i > coo->linhas || j < 1 || j > coo->colunas) {
+            t->erro = entrada;
+            return NULL;
+        }
+        if (p < t->fim) {
+            p++;
+        }
+        coo->linha[destino] = (int) i - 1;
+        coo->coluna[destino] = (int) j - 1;
+        coo->valor[destino] = v;
+        t->foraDiagonal += i != j;
+        destino++;
+    }
+    t->lidos = destino - t->posicao;
+    return NULL;
+}
+
+/**
+ * Passada 3: grava a entrada espelhada de cada entrada fora da diagonal
+ */
+static inline void *espelharTrecho(void *arg) {
+    struct tarefaLeitura *t = (struct tarefaLeitura *) arg;
+    struct matrizCOO *coo = t->coo;
+    size_t destino = t->posicaoEspelho;
+    for (size_t k = t->posicao; k < t->posicao + t->lidos; k++) {
+        if (coo->linha[k] != coo->coluna[k]) {
+            coo->linha[destino] = coo->coluna[k];
+            coo->coluna[destino] = coo->linha[k];
+            coo->valor[destino] = t->sinalEspelho * coo->valor[k];
+            destino++;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Encerra o programa com uma mensagem de erro sobre o arquivo
+ */
+static inline void erroMatrixMarket(const char *caminho, const char *mensagem) {
+    fprintf(stderr, "Erro em %s: %s\n", caminho, mensagem);
+    exit(EXIT_FAILURE);
+}
+
+/**
+ * Lê um arquivo Matrix Market (formato coordinate) para uma matriz COO
+ * Aceita real, integer e pattern; general, symmetric e skew-symmetric.
+ * @param caminho Arquivo .mtx
+ * @return Matriz COO (as entradas repetidas são somadas na conversão para CSR)
+ */
+static inline struct matrizCOO lerMatrixMarket(const char *caminho) {
+    int fd = open(caminho, O_RDONLY);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0) {
+        perror(caminho);
+        exit(EXIT_FAILURE);
+    }
+    size_t tamanho = (size_t) info.st_size;
+    if (tamanho == 0) {
+        erroMatrixMarket(caminho, "arquivo vazio");
+    }
+    const char *mapa = (const char *) mmap(NULL, tamanho, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapa == MAP_FAILED) {
+        perror(caminho);
+        exit(EXIT_FAILURE);
+    }
+    madvise((void *) mapa, tamanho, MADV_SEQUENTIAL);
+    const char *fim = mapa + tamanho;
+
+    // Cabeçalho: %%MatrixMarket matrix coordinate <campo> <simetria>
+    const char *quebra = (const char *) memchr(mapa, '\n', tamanho);
+    size_t tamanhoCabecalho = quebra != NULL ? (size_t) (quebra - mapa) : tamanho;
+    char cabecalho[256], objeto[32], formato[32], campo[32], simetria[32];
+    if (tamanhoCabecalho >= sizeof(cabecalho)) {
+        erroMatrixMarket(caminho, "cabeçalho inválido");
+    }
+    // As palavras do cabeçalho não diferenciam maiúsculas de minúsculas
+    for (size_t k = 0; k < tamanhoCabecalho; k++) {
+        cabecalho[k] = (char) tolower((unsigned char) mapa[k]);
+    }
+    cabecalho[tamanhoCabecalho] = '\0';
+    if (sscanf(cabecalho, "%%%%matrixmarket %31s %31s %31s %31s", objeto, formato, campo, simetria) != 4 ||
+        strcmp(objeto, "matrix") != 0) {
+        erroMatrixMarket(caminho, "cabeçalho %%MatrixMarket inválido");
+    }
+    if (strcmp(formato, "coordinate") != 0) {
+        erroMatrixMarket(caminho, "apenas o formato coordinate é suportado");
+    }
+    bool padrao = strcmp(campo, "pattern") == 0;
+    if (!padrao && strcmp(campo, "real") != 0 && strcmp(campo, "integer") != 0) {
+        erroMatrixMarket(caminho, "campo não suportado (use real, integer ou pattern)");
+    }
+    enum simetria tipo;
+    if (strcmp(simetria, "general") == 0) {
+        tipo = SIMETRIA_GERAL;
+    } else if (strcmp(simetria, "symmetric") == 0) {
+        tipo = SIMETRIA_SIMETRICA;
+    } else if (strcmp(simetria, "skew-symmetric") == 0) {
+        tipo = SIMETRIA_ANTISSIMETRICA;
+    } else {
+        erroMatrixMarket(caminho, "simetria não suportada (use general, symmetric ou skew-symmetric)");
+    }
+
+    // Comentários e a linha de tamanho: linhas colunas entradas
+    const char *p = quebra != NULL ? quebra + 1 : fim;
+    long long linhas = 0, colunas = 0, entradas = 0;
+    for (;;) {
+        p = pularEspacos(p, fim);
+        if (p == fim) {
+            erroMatrixMarket(caminho, "falta a linha de tamanho");
+        }
+        if (*p != '%' && *p != '\n') {
+            break;
+        }
+        quebra = (const char *) memchr(p, '\n', (size_t) (fim - p));
+        p = quebra != NULL ? quebra + 1 : fim;
+    }
+    p = lerInteiro(p, fim, &linhas);
+    if (p != NULL) {
+        p = lerInteiro(pularEspacos(p, fim), fim, &colunas);
+    }
+    if (p != NULL) {
+        p = lerInteiro(pularEspacos(p, fim), fim, &entradas);
+    }
+    if (p == NULL || linhas < 1 || colunas < 1 || linhas > INT32_MAX || colunas > INT32_MAX) {
+        erroMatrixMarket(caminho, "linha de tamanho inválida");
+    }
+    if (tipo != SIMETRIA_GERAL && linhas != colunas) {
+        erroMatrixMarket(caminho, "matriz simétrica precisa ser quadrada");
+    }
+    quebra = (const char *) memchr(p, '\n', (size_t) (fim - p));
+    const char *corpo = quebra != NULL ? quebra + 1 : fim;
+
+    // Trechos terminados em quebra de linha, um por thread
+    int threads = threadsMatriz((size_t) (fim - corpo) / 32);
+    struct tarefaLeitura tarefas[MAX_THREADS_MATRIZ];
+    const char *inicioTrecho = corpo;
+    for (int t = 0; t < threads; t++) {
+        const char *fimTrecho = corpo + (size_t) (fim - corpo) * (size_t) (t + 1) / (size_t) threads;
+        if (fimTrecho < inicioTrecho) {
+            fimTrecho = inicioTrecho;
+        }
+        if (t < threads - 1 && fimTrecho < fim) {
+            quebra = (const char *) memchr(fimTrecho, '\n', (size_t) (fim - fimTrecho));
+            fimTrecho = quebra != NULL ? quebra + 1 : fim;
+        }
+        memset(&tarefas[t], 0, sizeof(struct tarefaLeitura));
+        tarefas[t].inicio = inicioTrecho;
+        tarefas[t].fim = t < threads - 1 ? fimTrecho : fim;
+        tarefas[t].padrao = padrao;
+        tarefas[t].sinalEspelho = tipo == SIMETRIA_ANTISSIMETRICA ? -1.0 : 1.0;
+        inicioTrecho = tarefas[t].fim;
+    }
+
+    // Passada 1: linhas por trecho e posição de cada thread
+    executarParalelo(threads, contarLinhasTrecho, tarefas, sizeof(struct tarefaLeitura));
+    size_t totalLinhas = 0;
+    for (int t = 0; t < threads; t++) {
+        tarefas[t].posicao = totalLinhas;
+        totalLinhas += tarefas[t].linhas;
+    }
+    struct matrizCOO coo = criarCOO((int) linhas, (int) colunas, tipo == SIMETRIA_GERAL ? totalLinhas : 2 * totalLinhas);
+    for (int t = 0; t < threads; t++) {
+        tarefas[t].coo = &coo;
+    }
+
+    // Passada 2: conversão
+    executarParalelo(threads, converterTrecho, tarefas, sizeof(struct tarefaLeitura));
+    size_t lidos = 0;
+    for (int t = 0; t < threads; t++) {
+        if (tarefas[t].erro != NULL) {
+            fprintf(stderr, "Erro em %s: entrada inválida no byte %zu\n", caminho, (size_t) (tarefas[t].erro - mapa));
+            exit(EXIT_FAILURE);
+        }
+        // Linhas vazias ou de comentário deixam buracos: junta as faixas
+        if (tarefas[t].posicao != lidos) {
+            memmove(coo.linha + lidos, coo.linha + tarefas[t].posicao, tarefas[t].lidos * sizeof(int));
+            memmove(coo.coluna + lidos, coo.coluna + tarefas[t].posicao, tarefas[t].lidos * sizeof(int));
+            memmove(coo.valor + lidos, coo.valor + tarefas[t].posicao, tarefas[t].lidos * sizeof(double));
+            tarefas[t].posicao = lidos;
+        }
+        lidos += tarefas[t].lidos;
+    }
+    munmap((void *) mapa, tamanho);
+    if (lidos != (size_t) entradas) {
+        fprintf(stderr, "Erro em %s: o cabeçalho anuncia %lld entradas, mas há %zu\n", caminho, entradas, lidos);
+        exit(EXIT_FAILURE);
+    }
+    coo.nnz = lidos;
+
+    // Passada 3: metade que falta das matrizes simétricas
+    if (tipo != SIMETRIA_GERAL) {
+        for (int t = 0; t < threads; t++) {
+            tarefas[t].posicaoEspelho = coo.nnz;
+            coo.nnz += tarefas[t].foraDiagonal;
+        }
+        executarParalelo(threads, espelharTrecho, tarefas, sizeof(struct tarefaLeitura));
+    }
+    return coo;
+}
+
+/**
+ * Grava uma matriz CSR no cache binário
+ * O arquivo é escrito com outro nome e renomeado no fim, então um cache
+ * pela metade nunca é aberto.
+ * @param a Matriz CSR
+ * @param caminho Arquivo de cache
+ * @param origem stat do .mtx de origem
+ * @return true se gravou
+ */
+static inline bool salvarCacheCSR(const struct matrizCSR *a, const char *caminho, const struct stat *origem) {
+    char temporario[4096];
+    if (snprintf(temporario, sizeof(temporario), "%s.tmp", caminho) >= (int) sizeof(temporario)) {
+        return false;
+    }
+    FILE *arquivo = fopen(temporario, "wb");
+    if (arquivo == NULL) {
+        return false;
+    }
+    struct cabecalhoCache c;
+    memset(&c, 0, sizeof(c));
+    memcpy(c.magica, "CSRCACHE", 8);
+    c.versao = VERSAO_CACHE;
+    c.linhas = a->linhas;
+    c.colunas = a->colunas;
+    c.nnz = a->nnz;
+    c.tamanhoOrigem = (uint64_t) origem->st_size;
+    c.segundosOrigem = (int64_t) origem->st_mtim.tv_sec;
+    c.nanossegundosOrigem = (int64_t) origem->st_mtim.tv_nsec;
+
+    bool ok = fwrite(&c, sizeof(c), 1, arquivo) == 1 &&
+              fwrite(a->inicio, sizeof(size_t), (size_t) a->linhas + 1, arquivo) == (size_t) a->linhas + 1 &&
+              fwrite(a->valor, sizeof(double), a->nnz, arquivo) == a->nnz &&
+              fwrite(a->coluna, sizeof(int), a->nnz, arquivo) == a->nnz;
+    ok = fclose(arquivo) == 0 && ok;
+    if (!ok || rename(temporario, caminho) != 0) {
+        remove(temporario);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Abre um cache binário, mapeando-o na memória
+ * O mapeamento é privado e gravável: alterar a matriz não altera o arquivo.
+ * @param caminho Arquivo de cache
+ * @param origem stat do .mtx (o cache precisa ter sido gerado dele)
+ * @param m Recebe a matriz, com os vetores apontando para o mapeamento
+ * @return false se o cache não existe, está corrompido ou desatualizado
+ */
+static inline bool abrirCacheCSR(const char *caminho, const struct stat *origem, struct matrizCarregada *m) {
+    int fd = open(caminho, O_RDONLY);
+    struct stat info;
+    if (fd < 0) {
+        return false;
+    }
+    if (fstat(fd, &info) != 0 || (size_t) info.st_size < sizeof(struct cabecalhoCache)) {
+        close(fd);
+        return false;
+    }
+    size_t tamanho = (size_t) info.st_size;
+    char *mapa = (char *) mmap(NULL, tamanho, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapa == MAP_FAILED) {
+        return false;
+    }
+
+    const struct cabecalhoCache *c = (const struct cabecalhoCache *) mapa;
+    size_t esperado = sizeof(struct cabecalhoCache) + ((size_t) c->linhas + 1) * sizeof(size_t) +
+                      (size_t) c->nnz * (sizeof(double) + sizeof(int));
+    if (memcmp(c->magica, "CSRCACHE", 8) != 0 || c->versao != VERSAO_CACHE || c->linhas < 0 || c->colunas < 0 ||
+        esperado != tamanho || c->tamanhoOrigem != (uint64_t) origem->st_size ||
+        c->segundosOrigem != (int64_t) origem->st_mtim.tv_sec ||
+        c->nanossegundosOrigem != (int64_t) origem->st_mtim.tv_nsec) {
+        munmap(mapa, tamanho);
+        return false;
+    }
+    m->csr.linhas = c->linhas;
+    m->csr.colunas = c->colunas;
+    m->csr.nnz = (size_t) c->nnz;
+    m->csr.inicio = (size_t *) (mapa + sizeof(struct cabecalhoCache));
+    m->csr.valor = (double *) (m->csr.inicio + c->linhas + 1);
+    m->csr.coluna = (int *) (m->csr.valor + c->nnz);
+    m->mapa = mapa;
+    m->tamanhoMapa = tamanho;
+    return true;
+}
+
+/**
+ * Carrega uma matriz .mtx usando o cache "<caminho>.csr" quando possível
+ * Sem cache válido, lê o .mtx, converte para CSR e grava o cache.
+ * @param caminho Arquivo .mtx
+ * @param usouCache Recebe true se a matriz veio do cache (pode ser NULL)
+ * @return Matriz carregada; libere com liberarCarregada
+ */
+static inline struct matrizCarregada carregarMatriz(const char *caminho, bool *usouCache) {
+    struct matrizCarregada m;
+    struct stat origem;
+    char cache[4096];
+    if (stat(caminho, &origem) != 0) {
+        perror(caminho);
+        exit(EXIT_FAILURE);
+    }
+    bool podeUsarCache = snprintf(cache, sizeof(cache), "%s.csr", caminho) < (int) sizeof(cache);
+    if (podeUsarCache && abrirCacheCSR(cache, &origem, &m)) {
+        if (usouCache != NULL) {
+            *usouCache = true;
+        }
+        return m;
+    }
+
+    struct matrizCOO coo = lerMatrixMarket(caminho);
+    m.csr = cooParaCSR(&coo);
+    liberarCOO(&coo);
+    m.mapa = NULL;
+    m.tamanhoMapa = 0;
+    if (podeUsarCache && !salvarCacheCSR(&m.csr, cache, &origem)) {
+        fprintf(stderr, "Aviso: não foi possível gravar o cache %s\n", cache);
+    }
+    if (usouCache != NULL) {
+        *usouCache = false;
+    }
+    return m;
+}
+
+/**
+ * Libera uma matriz carregada (desfaz o mapeamento ou libera a CSR)
+ */
+static inline void liberarCarregada(struct matrizCarregada *m) {
+    if (m->mapa != NULL) {
+        munmap(m->mapa, m->tamanhoMapa);
+        m->mapa = NULL;
+    } else {
+        liberarCSR(&m->csr);
+    }
+}
+
+#endif
@@ -0,0 +1,138 @@
+/**
+ * Demonstração da Matriz Esparsa COO/CSR/CSC em C
+ *
+ * Este código mostra o uso de Matriz_CSR.h:
+ * - Montagem de uma matriz pequena em COO, com elementos repetidos
+ * - Conversão para CSR e CSC, transposta, fatia de linhas e SpMV
+ * - Uma matriz aleatória com alguns milhões de elementos: tempo da
+ *   conversão paralela, da SpMV e conferência da transposta e da CSC
+ *
+ *   gcc -O2 -pthread Matriz_CSR.c -o matriz_csr -lm
+ *   ./matriz_csr [linhas] [elementos_por_linha]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+#include "Matriz_CSR.h"
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+/**
+ * Verifica se duas matrizes CSR são idênticas
+ */
+static bool iguais(const struct matrizCSR *a, const struct matrizCSR *b) {
+    if (a->linhas != b->linhas || a->colunas != b->colunas || a->nnz != b->nnz) {
+        return false;
+    }
+    return memcmp(a->inicio, b->inicio, ((size_t) a->linhas + 1) * sizeof(size_t)) == 0 &&
+           memcmp(a->coluna, b->coluna, a->nnz * sizeof(int)) == 0 &&
+           memcmp(a->valor, b->valor, a->nnz * sizeof(double)) == 0;
+}
+
+int main(int argc, char *argv[]) {
+    int linhas = argc > 1 ? atoi(argv[1]) : 1000000;
+    int porLinha = argc > 2 ? atoi(argv[2]) : 8;
+    struct timespec t0;
+
+    // Exemplo pequeno
+    struct matrizCOO coo = criarCOO(4, 5, 4);
+    adicionarCOO(&coo, 0, 0, 1.0);
+    adicionarCOO(&coo, 2, 4, 5.0);
+    adicionarCOO(&coo, 1, 2, 3.0);
+    adicionarCOO(&coo, 0, 3, 2.0);
+    adicionarCOO(&coo, 3, 1, 4.0);
+    adicionarCOO(&coo, 2, 0, 6.0);
+    adicionarCOO(&coo, 1, 2, 0.5);   // Repetido: soma com o (1, 2) anterior
+
+    struct matrizCSR a = cooParaCSR(&coo);
+    struct matrizCSR csc = cooParaCSC(&coo);
+    struct matrizCSR t = transposta(&a);
+    struct matrizCSR f = fatiarLinhas(&a, 1, 3);
+    liberarCOO(&coo);
+
+    printf("A (CSR, %zu elementos):\n", a.nnz);
+    imprimirCSR(&a);
+    printf("\nTransposta de A:\n");
+    imprimirCSR(&t);
+    printf("\nCSC de A %s a transposta\n", iguais(&csc, &t) ? "igual" : "DIFERENTE de");
+    printf("\nLinhas 1 e 2 de A:\n");
+    imprimirCSR(&f);
+
+    double x[5] = {1, 1, 1, 1, 1}, y[4];
+    multiplicarVetor(&a, x, y);
+    printf("\nA * [1 1 1 1 1] = [%.1f %.1f %.1f %.1f]\n", y[0], y[1], y[2], y[3]);
+    liberarCSR(&a);
+    liberarCSR(&csc);
+    liberarCSR(&t);
+    liberarCSR(&f);
+
+    // Matriz aleatória grande com linhas de tamanho variado (algumas muito longas)
+    size_t total = (size_t) linhas * (size_t) porLinha;
+    coo = criarCOO(linhas, linhas, total);
+    uint64_t s = 0x9E3779B97F4A7C15ull;
+    for (size_t k = 0; k < total; k++) {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        // Linhas concentradas no começo (lei de potência aproximada)
+        double u = (double) (s >> 11) / 9007199254740992.0;
+        int i = (int) ((double) linhas * u * u * u);
+        int j = (int) ((s >> 3) % (uint64_t) linhas);
+        adicionarCOO(&coo, i, j, (double) (k % 7) - 3.0);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    a = cooParaCSR(&coo);
+    double tempoCSR = segundosDesde(&t0);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    csc = cooParaCSC(&coo);
+    double tempoCSC = segundosDesde(&t0);
+    liberarCOO(&coo);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    t = transposta(&a);
+    double tempoTransposta = segundosDesde(&t0);
+    struct matrizCSR tt = transposta(&t);
+
+    double *vx = (double *) alocarMatriz((size_t) linhas * sizeof(double));
+    double *vy = (double *) alocarMatriz((size_t) linhas * sizeof(double));
+    for (int i = 0; i < linhas; i++) {
+        vx[i] = 1.0 / (1.0 + i % 13);
+    }
+    const int repeticoes = 10;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int r = 0; r < repeticoes; r++) {
+        multiplicarVetor(&a, vx, vy);
+    }
+    double tempoSpMV = segundosDesde(&t0) / repeticoes;
+    double norma = 0.0;
+    for (int i = 0; i < linhas; i++) {
+        norma += vy[i] * vy[i];
+    }
+
+    printf("\nMatriz %d x %d, %zu triplas -> %zu elementos (%d threads)\n",
+           linhas, linhas, total, a.nnz, threadsMatriz(total));
+    printf("COO -> CSR:  %.3f s\n", tempoCSR);
+    printf("COO -> CSC:  %.3f s (%s a transposta da CSR)\n", tempoCSC, iguais(&csc, &t) ? "igual" : "DIFERENTE de");
+    printf("Transposta:  %.3f s (transposta da transposta %s)\n", tempoTransposta, iguais(&a, &tt) ? "confere" : "NAO CONFERE");
+    printf("SpMV:        %.4f s, %.2f GFLOP/s (|y| = %.6g)\n", tempoSpMV, 2.0 * (double) a.nnz / tempoSpMV / 1e9, sqrt(norma));
+
+    free(vx);
+    free(vy);
+    liberarCSR(&a);
+    liberarCSR(&csc);
+    liberarCSR(&t);
+    liberarCSR(&tt);
+    return 0;
+}
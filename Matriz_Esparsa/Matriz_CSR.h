@@ -0,0 +1,473 @@
+/**
+ * Matriz Esparsa em Formatos COO, CSR e CSC em C
+ *
+ * Matriz_Esparsa.c agrupa números pelo resto da divisão, sem linhas, colunas
+ * nem valores. Este arquivo implementa uma matriz esparsa de verdade:
+ * - COO (coordenadas): vetores paralelos linha/coluna/valor, na ordem em que
+ *   os elementos chegam; é o formato de montagem e de leitura de arquivos
+ * - CSR (linhas comprimidas): os elementos de cada linha ficam contíguos e
+ *   ordenados por coluna; inicio[i]..inicio[i+1] delimita a linha i
+ * - CSC (colunas comprimidas): o mesmo por colunas. É guardada na mesma
+ *   struct matrizCSR, que passa a ser lida como a CSR da transposta
+ *
+ * A conversão COO -> CSR é uma ordenação por contagem em paralelo: cada
+ * thread conta os elementos de cada linha no seu trecho em um histograma
+ * próprio (sem operações atômicas), uma soma de prefixos dá a posição de
+ * cada thread dentro de cada linha, as threads espalham os elementos e por
+ * fim ordenam cada linha por coluna, somando elementos repetidos.
+ *
+ * Também há multiplicação matriz-vetor (SpMV), transposta e fatia de linhas.
+ *
+ * Todas as funções são static inline: o arquivo é incluído por cada programa,
+ * que deve ser compilado com -pthread.
+ */
+
+#ifndef MATRIZ_CSR_H
+#define MATRIZ_CSR_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define MAX_THREADS_MATRIZ 64
+#define MINIMO_POR_THREAD_MATRIZ 16384   // Elementos abaixo dos quais não vale dividir
+
+// Matriz em coordenadas (COO)
+struct matrizCOO {
+    int linhas;
+    int colunas;
+    size_t nnz;                 // Elementos não nulos
+    size_t capacidade;
+    int *linha;
+    int *coluna;
+    double *valor;
+};
+
+// Matriz em linhas comprimidas (CSR); também guarda a CSC, lida como CSR da transposta
+struct matrizCSR {
+    int linhas;
+    int colunas;
+    size_t nnz;
+    size_t *inicio;             // linhas + 1 posições
+    int *coluna;
+    double *valor;
+};
+
+/**
+ * Aloca memória ou encerra o programa
+ */
+static inline void *alocarMatriz(size_t bytes) {
+    void *p = malloc(bytes > 0 ? bytes : 1);
+    if (p == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+/**
+ * Quantidade de threads para um trabalho de n elementos
+ */
+static inline int threadsMatriz(size_t n) {
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t porTamanho = n / MINIMO_POR_THREAD_MATRIZ;
+    int threads = nucleos > 0 ? (int) nucleos : 1;
+    if (threads > MAX_THREADS_MATRIZ) {
+        threads = MAX_THREADS_MATRIZ;
+    }
+    if ((size_t) threads > porTamanho) {
+        threads = porTamanho > 0 ? (int) porTamanho : 1;
+    }
+    return threads;
+}
+
+/**
+ * Executa uma função em paralelo, uma thread por tarefa
+ * A última tarefa roda na própria thread que chamou.
+ * @param threads Quantidade de tarefas
+ * @param funcao Função de cada thread
+ * @param tarefas Vetor de tarefas
+ * @param tamanhoTarefa sizeof de cada tarefa
+ */
+static inline void executarParalelo(int threads, void *(*funcao)(void *), void *tarefas, size_t tamanhoTarefa) {
+    pthread_t ids[MAX_THREADS_MATRIZ];
+    for (int t = 0; t < threads - 1; t++) {
+        pthread_create(&ids[t], NULL, funcao, (char *) tarefas + (size_t) t * tamanhoTarefa);
+    }
+    funcao((char *) tarefas + (size_t) (threads - 1) * tamanhoTarefa);
+    for (int t = 0; t < threads - 1; t++) {
+        pthread_join(ids[t], NULL);
+    }
+}
+
+/**
+ * Cria uma matriz COO vazia
+ * @param linhas Quantidade de linhas
+ * @param colunas Quantidade de colunas
+ * @param capacidade Elementos reservados (o vetor cresce se preciso)
+ * @return Matriz criada
+ */
+static inline struct matrizCOO criarCOO(int linhas, int colunas, size_t capacidade) {
+    struct matrizCOO coo;
+    coo.linhas = linhas;
+    coo.colunas = colunas;
+    coo.nnz = 0;
+    coo.capacidade = capacidade > 0 ? capacidade : 16;
+    coo.linha = (int *) alocarMatriz(coo.capacidade * sizeof(int));
+    coo.coluna = (int *) alocarMatriz(coo.capacidade * sizeof(int));
+    coo.valor = (double *) alocarMatriz(coo.capacidade * sizeof(double));
+    return coo;
+}
+
+/**
+ * Acrescenta um elemento (linha, coluna, valor) à matriz COO
+ * Elementos repetidos são somados na conversão para CSR.
+ */
+static inline void adicionarCOO(struct matrizCOO *coo, int linha, int coluna, double valor) {
+    if (coo->nnz == coo->capacidade) {
+        coo->capacidade *= 2;
+        coo->linha = (int *) realloc(coo->linha, coo->capacidade * sizeof(int));
+        coo->coluna = (int *) realloc(coo->coluna, coo->capacidade * sizeof(int));
+        coo->valor = (double *) realloc(coo->valor, coo->capacidade * sizeof(double));
+        if (coo->linha == NULL || coo->coluna == NULL || coo->valor == NULL) {
+            fprintf(stderr, "Erro na alocação de memória.\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    coo->linha[coo->nnz] = linha;
+    coo->coluna[coo->nnz] = coluna;
+    coo->valor[coo->nnz] = valor;
+    coo->nnz++;
+}
+
+/**
+ * Libera a memória de uma matriz COO
+ */
+static inline void liberarCOO(struct matrizCOO *coo) {
+    free(coo->linha);
+    free(coo->coluna);
+    free(coo->valor);
+    coo->linha = coo->coluna = NULL;
+    coo->valor = NULL;
+    coo->nnz = coo->capacidade = 0;
+}
+
+// Par (coluna, valor) espalhado e ordenado durante a conversão
+struct elementoLinha {
+    int coluna;
+    double valor;
+};
+
+// Tarefa de uma thread na conversão COO -> CSR
+struct tarefaConversao {
+    const int *chave;           // Índice de agrupamento (linha para CSR, coluna para CSC)
+    const int *outro;           // Índice dentro do grupo
+    const double *valor;
+    size_t inicio, fim;         // Faixa de elementos (contagem/espalhamento) ou de grupos (ordenação/cópia)
+    size_t *contagem;           // Histograma da thread, depois seu cursor de escrita em cada grupo
+    size_t *posicao;            // Início de cada grupo em elementos
+    size_t *tamanhos;           // Tamanho de cada grupo após somar os repetidos
+    struct elementoLinha *elementos;
+    struct matrizCSR *csr;
+};
+
+static inline int compararElementos(const void *a, const void *b) {
+    int x = ((const struct elementoLinha *) a)->coluna;
+    int y = ((const struct elementoLinha *) b)->coluna;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Fase 1: conta os elementos de cada grupo
+ */
+static inline void *contarGrupos(void *arg) {
+    struct tarefaConversao *t = (struct tarefaConversao *) arg;
+    for (size_t k = t->inicio; k < t->fim; k++) {
+        t->contagem[t->chave[k]]++;
+    }
+    return NULL;
+}
+
+/**
+ * Fase 2: espalha os elementos em seus grupos
+ * Coluna e valor vão juntos em um par, para cada elemento custar uma única
+ * escrita fora da cache.
+ */
+static inline void *espalharGrupos(void *arg) {
+    struct tarefaConversao *t = (struct tarefaConversao *) arg;
+    for (size_t k = t->inicio; k < t->fim; k++) {
+        size_t destino = t->contagem[t->chave[k]]++;
+        t->elementos[destino].coluna = t->outro[k];
+        t->elementos[destino].valor = t->valor[k];
+    }
+    return NULL;
+}
+
+/**
+ * Fase 3: ordena cada grupo pelo índice interno e soma os repetidos
+ * O grupo compactado fica no começo do seu espaço; o tamanho final vai em tamanhos.
+ */
+static inline void *ordenarGrupos(void *arg) {
+    struct tarefaConversao *t = (struct tarefaConversao *) arg;
+
+    for (size_t i = t->inicio; i < t->fim; i++) {
+        struct elementoLinha *e = t->elementos + t->posicao[i];
+        size_t n = t->posicao[i + 1] - t->posicao[i];
+
+        if (n <= 32) {
+            // Inserção: as linhas curtas são a grande maioria
+            for (size_t a = 1; a < n; a++) {
+                struct elementoLinha x = e[a];
+                size_t b = a;
+                while (b > 0 && e[b - 1].coluna > x.coluna) {
+                    e[b] = e[b - 1];
+                    b--;
+                }
+                e[b] = x;
+            }
+        } else {
+            qsort(e, n, sizeof(struct elementoLinha), compararElementos);
+        }
+
+        // Soma os repetidos
+        size_t m = 0;
+        for (size_t a = 0; a < n; a++) {
+            if (m > 0 && e[m - 1].coluna == e[a].coluna) {
+                e[m - 1].valor += e[a].valor;
+            } else {
+                e[m++] = e[a];
+            }
+        }
+        t->tamanhos[i] = m;
+    }
+    return NULL;
+}
+
+/**
+ * Fase 4: copia os grupos compactados para os vetores finais da matriz
+ */
+static inline void *copiarGrupos(void *arg) {
+    struct tarefaConversao *t = (struct tarefaConversao *) arg;
+    struct matrizCSR *csr = t->csr;
+    for (size_t i = t->inicio; i < t->fim; i++) {
+        const struct elementoLinha *e = t->elementos + t->posicao[i];
+        size_t destino = csr->inicio[i];
+        for (size_t a = 0; a < t->tamanhos[i]; a++) {
+            csr->coluna[destino + a] = e[a].coluna;
+            csr->valor[destino + a] = e[a].valor;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Converte vetores de coordenadas para o formato comprimido
+ * @param grupos Quantidade de grupos (linhas da CSR resultante)
+ * @param outros Tamanho do índice interno (colunas da CSR resultante)
+ */
+static inline struct matrizCSR comprimir(int grupos, int outros, size_t nnz,
+                                         const int *chave, const int *outro, const double *valor) {
+    struct matrizCSR csr;
+    csr.linhas = grupos;
+    csr.colunas = outros;
+    csr.inicio = (size_t *) alocarMatriz(((size_t) grupos + 1) * sizeof(size_t));
+
+    // Um histograma por thread; limita as threads para os histogramas não
+    // passarem do tamanho dos próprios dados
+    int threads = threadsMatriz(nnz);
+    while (threads > 1 && (size_t) threads * (size_t) grupos > nnz) {
+        threads /= 2;
+    }
+    size_t *contagem = (size_t *) calloc((size_t) threads * ((size_t) grupos + 1), sizeof(size_t));
+    if (contagem == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    size_t *posicao = (size_t *) alocarMatriz(((size_t) grupos + 1) * sizeof(size_t));
+    size_t *tamanhos = (size_t *) alocarMatriz(((size_t) grupos + 1) * sizeof(size_t));
+    struct elementoLinha *elementos = (struct elementoLinha *) alocarMatriz(nnz * sizeof(struct elementoLinha));
+
+    struct tarefaConversao tarefas[MAX_THREADS_MATRIZ];
+    for (int t = 0; t < threads; t++) {
+        tarefas[t] = (struct tarefaConversao) {chave, outro, valor, nnz * (size_t) t / (size_t) threads,
+                                               nnz * (size_t) (t + 1) / (size_t) threads,
+                                               contagem + (size_t) t * ((size_t) grupos + 1),
+                                               posicao, tamanhos, elementos, &csr};
+    }
+    executarParalelo(threads, contarGrupos, tarefas, sizeof(struct tarefaConversao));
+
+    // Soma de prefixos: início de cada grupo e, dentro dele, o trecho de cada
+    // thread na ordem original (o espalhamento fica estável)
+    size_t acumulado = 0;
+    for (int i = 0; i < grupos; i++) {
+        posicao[i] = acumulado;
+        for (int t = 0; t < threads; t++) {
+            size_t n = tarefas[t].contagem[i];
+            tarefas[t].contagem[i] = acumulado;
+            acumulado += n;
+        }
+    }
+    posicao[grupos] = acumulado;
+    executarParalelo(threads, espalharGrupos, tarefas, sizeof(struct tarefaConversao));
+
+    // Ordenação dos grupos, dividindo os grupos em faixas com nnz parecido
+    int g = 0;
+    for (int t = 0; t < threads; t++) {
+        size_t limite = nnz * (size_t) (t + 1) / (size_t) threads;
+        tarefas[t].inicio = (size_t) g;
+        while (g < grupos && (t == threads - 1 || posicao[g] < limite)) {
+            g++;
+        }
+        tarefas[t].fim = (size_t) g;
+    }
+    executarParalelo(threads, ordenarGrupos, tarefas, sizeof(struct tarefaConversao));
+
+    // Tamanho final sem os repetidos e cópia para os vetores definitivos
+    acumulado = 0;
+    for (int i = 0; i < grupos; i++) {
+        csr.inicio[i] = acumulado;
+        acumulado += tamanhos[i];
+    }
+    csr.inicio[grupos] = acumulado;
+    csr.nnz = acumulado;
+    csr.coluna = (int *) alocarMatriz(csr.nnz * sizeof(int));
+    csr.valor = (double *) alocarMatriz(csr.nnz * sizeof(double));
+    executarParalelo(threads, copiarGrupos, tarefas, sizeof(struct tarefaConversao));
+
+    free(contagem);
+    free(posicao);
+    free(tamanhos);
+    free(elementos);
+    return csr;
+}
+
+/**
+ * Converte uma matriz COO para CSR (ordenação paralela por linha e coluna)
+ * @param coo Matriz em coordenadas (não é alterada)
+ * @return Matriz CSR; elementos repetidos são somados
+ */
+static inline struct matrizCSR cooParaCSR(const struct matrizCOO *coo) {
+    return comprimir(coo->linhas, coo->colunas, coo->nnz, coo->linha, coo->coluna, coo->valor);
+}
+
+/**
+ * Converte uma matriz COO para CSC
+ * @param coo Matriz em coordenadas (não é alterada)
+ * @return Matriz CSC: inicio indexado por coluna e coluna[] guardando as linhas
+ */
+static inline struct matrizCSR cooParaCSC(const struct matrizCOO *coo) {
+    return comprimir(coo->colunas, coo->linhas, coo->nnz, coo->coluna, coo->linha, coo->valor);
+}
+
+/**
+ * Multiplicação matriz-vetor y = A x
+ * @param a Matriz CSR
+ * @param x Vetor com a->colunas posições
+ * @param y Recebe a->linhas posições
+ */
+static inline void multiplicarVetor(const struct matrizCSR *a, const double *x, double *y) {
+    for (int i = 0; i < a->linhas; i++) {
+        double soma = 0.0;
+        for (size_t k = a->inicio[i]; k < a->inicio[i + 1]; k++) {
+            soma += a->valor[k] * x[a->coluna[k]];
+        }
+        y[i] = soma;
+    }
+}
+
+/**
+ * Transposta de uma matriz CSR (também converte CSR <-> CSC)
+ * Percorre as linhas em ordem, então cada linha da transposta já sai
+ * ordenada por coluna.
+ * @param a Matriz CSR
+ * @return Nova matriz com a transposta
+ */
+static inline struct matrizCSR transposta(const struct matrizCSR *a) {
+    struct matrizCSR t;
+    t.linhas = a->colunas;
+    t.colunas = a->linhas;
+    t.nnz = a->nnz;
+    t.inicio = (size_t *) alocarMatriz(((size_t) t.linhas + 1) * sizeof(size_t));
+    t.coluna = (int *) alocarMatriz(a->nnz * sizeof(int));
+    t.valor = (double *) alocarMatriz(a->nnz * sizeof(double));
+
+    memset(t.inicio, 0, ((size_t) t.linhas + 1) * sizeof(size_t));
+    for (size_t k = 0; k < a->nnz; k++) {
+        t.inicio[a->coluna[k] + 1]++;
+    }
+    for (int j = 0; j < t.linhas; j++) {
+        t.inicio[j + 1] += t.inicio[j];
+    }
+
+    size_t *cursor = (size_t *) alocarMatriz(((size_t) t.linhas + 1) * sizeof(size_t));
+    memcpy(cursor, t.inicio, ((size_t) t.linhas + 1) * sizeof(size_t));
+    for (int i = 0; i < a->linhas; i++) {
+        for (size_t k = a->inicio[i]; k < a->inicio[i + 1]; k++) {
+            size_t destino = cursor[a->coluna[k]]++;
+            t.coluna[destino] = i;
+            t.valor[destino] = a->valor[k];
+        }
+    }
+    free(cursor);
+    return t;
+}
+
+/**
+ * Copia as linhas [primeira, ultima) para uma nova matriz
+ * @param a Matriz CSR
+ * @param primeira Primeira linha da fatia
+ * @param ultima Linha seguinte à última da fatia
+ * @return Nova matriz com ultima - primeira linhas e as mesmas colunas
+ */
+static inline struct matrizCSR fatiarLinhas(const struct matrizCSR *a, int primeira, int ultima) {
+    struct matrizCSR f;
+    size_t base = a->inicio[primeira];
+    f.linhas = ultima - primeira;
+    f.colunas = a->colunas;
+    f.nnz = a->inicio[ultima] - base;
+    f.inicio = (size_t *) alocarMatriz(((size_t) f.linhas + 1) * sizeof(size_t));
+    f.coluna = (int *) alocarMatriz(f.nnz * sizeof(int));
+    f.valor = (double *) alocarMatriz(f.nnz * sizeof(double));
+
+    for (int i = 0; i <= f.linhas; i++) {
+        f.inicio[i] = a->inicio[primeira + i] - base;
+    }
+    memcpy(f.coluna, a->coluna + base, f.nnz * sizeof(int));
+    memcpy(f.valor, a->valor + base, f.nnz * sizeof(double));
+    return f;
+}
+
+/**
+ * Imprime a matriz em forma densa (apenas para matrizes pequenas)
+ * @param a Matriz CSR
+ */
+static inline void imprimirCSR(const struct matrizCSR *a) {
+    for (int i = 0; i < a->linhas; i++) {
+        size_t k = a->inicio[i];
+        for (int j = 0; j < a->colunas; j++) {
+            if (k < a->inicio[i + 1] && a->coluna[k] == j) {
+                printf("%6.1f ", a->valor[k++]);
+            } else {
+                printf("%6s ", ".");
+            }
+        }
+        printf("\n");
+    }
+}
+
+/**
+ * Libera a memória de uma matriz CSR
+ */
+static inline void liberarCSR(struct matrizCSR *a) {
+    free(a->inicio);
+    free(a->coluna);
+    free(a->valor);
+    a->inicio = NULL;
+    a->coluna = NULL;
+    a->valor = NULL;
+    a->nnz = 0;
+}
+
+#endif
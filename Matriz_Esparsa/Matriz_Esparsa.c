@@ -9,10 +9,17 @@
  * - Agrupa números pelo resto da divisão (módulo)
  * - Estrutura dinâmica que cresce conforme necessário
  * - Otimiza busca por padrões de números
+ * - Imagem binária: os números de cada diretor ficam contíguos no arquivo,
+ *   consultados direto do mapeamento ou restaurados sem refazer inserções
+ *   (opcional, compilado com -DIMAGEM_BINARIA; ver Imagem_Binaria.h)
  */
 
+#if defined(IMAGEM_BINARIA) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE          // madvise e MADV_* com -std=c11 (ver Imagem_Binaria.h)
+#endif
 #include <stdio.h>
 #include <stdlib.h>
+#include "../Alocador_Nos/Alocador_Nos.h"
 
 #define MODULO 5  // Define o número de grupos possíveis
 
@@ -22,6 +29,9 @@ struct no {
     struct no *proximoNo;
 };
 
+// Alocador dos nós (caches por thread, ver Alocador_Nos.h)
+static struct alocadorNos alocadorMatriz = ALOCADOR_NOS_INICIALIZADOR(struct no);
+
 // Estrutura para os diretores (cabeças das listas)
 struct diretor {
     int resto;                    // Resto da divisão pelo módulo
@@ -62,6 +72,21 @@ struct diretor *buscarDiretor(struct diretor *cabeca, int resto) {
     return atual;
 }
 
+/**
+ * Busca um número na matriz esparsa
+ * @param cabeca Ponteiro para o início da lista de diretores
+ * @param numero Valor procurado
+ * @return Ponteiro para o nó com o número ou NULL
+ */
+struct no *buscar(struct diretor *cabeca, int numero) {
+    struct diretor *diretor = buscarDiretor(cabeca, numero % MODULO);
+    struct no *atual = diretor != NULL ? diretor->proximoNo : NULL;
+    while (atual != NULL && atual->numero != numero) {
+        atual = atual->proximoNo;
+    }
+    return atual;
+}
+
 /**
  * Insere um novo número na matriz esparsa
  * @param cabeca Ponteiro para o início da lista de diretores
@@ -79,7 +104,7 @@ struct diretor *inserir(struct diretor *cabeca, int numero) {
     }
 
     // Cria e insere o novo nó no início da lista
-    struct no *novoNo = (struct no *) malloc(sizeof(struct no));
+    struct no *novoNo = (struct no *) alocarNo(&alocadorMatriz);
     if (novoNo == NULL) {
         fprintf(stderr, "Erro na alocação de memória.\n");
         exit(EXIT_FAILURE);
@@ -108,7 +133,7 @@ void remover(struct diretor *cabeca, int numero) {
     if (diretor->proximoNo->numero == numero) {
         struct no *excluir = diretor->proximoNo;
         diretor->proximoNo = excluir->proximoNo;
-        free(excluir);
+        liberarNo(&alocadorMatriz, excluir);
         return;
     }
     
@@ -122,7 +147,7 @@ void remover(struct diretor *cabeca, int numero) {
     if (anterior->proximoNo != NULL) {
         struct no *excluir = anterior->proximoNo;
         anterior->proximoNo = excluir->proximoNo;
-        free(excluir);
+        liberarNo(&alocadorMatriz, excluir);
     }
 }
 
@@ -161,7 +186,7 @@ void liberarMemoria(struct diretor *cabeca) {
         while (no != NULL) {
             struct no *excluir = no;
             no = no->proximoNo;
-            free(excluir);
+            liberarNo(&alocadorMatriz, excluir);
         }
         
         // Libera o diretor atual
@@ -171,6 +196,175 @@ void liberarMemoria(struct diretor *cabeca) {
     }
 }
 
+#ifdef IMAGEM_BINARIA
+// Imagem binária (só POSIX: mmap). Compile com -DIMAGEM_BINARIA, ver Imagem_Binaria.h
+#include "../Imagem_Binaria/Imagem_Binaria.h"
+
+// Diretor na imagem binária: seus números ocupam uma faixa contígua
+struct diretorImagem {
+    int32_t resto;
+    uint32_t inicio;              // Primeiro número da faixa
+    uint32_t quantidade;          // Números na faixa
+};
+
+// Matriz esparsa aberta de uma imagem, consultada sem reconstrução
+struct imagemMatriz {
+    const int32_t *numeros;       // Primeira seção: números, diretor por diretor
+    const struct diretorImagem *diretores; // Segunda seção, na ordem da lista
+    uint32_t quantidadeDiretores;
+    struct imagemMapeada mapa;
+};
+
+/**
+ * Grava a matriz esparsa em uma imagem binária, em uma passada sequencial
+ * Os números saem lista por lista, na ordem das listas; a tabela de
+ * diretores (resto e faixa de cada um) vai no fim do arquivo.
+ * @param cabeca Ponteiro para o início da lista de diretores
+ * @param caminho Arquivo da imagem
+ * @return true se gravou
+ */
+bool salvarMatriz(struct diretor *cabeca, const char *caminho) {
+    size_t quantidadeDiretores = 0;
+    for (struct diretor *diretor = cabeca; diretor != NULL; diretor = diretor->proximoDiretor) {
+        quantidadeDiretores++;
+    }
+    struct diretorImagem *diretores =
+        (struct diretorImagem *) malloc((quantidadeDiretores + 1) * sizeof(struct diretorImagem));
+    if (diretores == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    struct gravacaoImagem g;
+    if (!iniciarGravacaoImagem(&g, caminho)) {
+        free(diretores);
+        return false;
+    }
+    uint32_t total = 0;
+    size_t d = 0;
+    for (struct diretor *diretor = cabeca; diretor != NULL; diretor = diretor->proximoDiretor, d++) {
+        diretores[d].resto = diretor->resto;
+        diretores[d].inicio = total;
+        for (struct no *no = diretor->proximoNo; no != NULL && g.ok; no = no->proximoNo) {
+            int32_t numero = no->numero;
+            gravarRegistro(&g, &numero, sizeof(numero));
+            g.ok = ++total < SEM_LIGACAO && g.ok;    // Índices de 32 bits
+        }
+        diretores[d].quantidade = total - diretores[d].inicio;
+    }
+    for (d = 0; d < quantidadeDiretores; d++) {
+        gravarRegistro(&g, &diretores[d], sizeof(struct diretorImagem));
+    }
+    free(diretores);
+
+    struct cabecalhoImagem c;
+    memset(&c, 0, sizeof(c));
+    memcpy(c.magica, "MATRIZES", 8);
+    c.tamanhoRegistro = sizeof(int32_t);
+    c.registros = total;
+    c.tamanhoExtra = sizeof(struct diretorImagem);
+    c.extras = quantidadeDiretores;
+    c.raiz = SEM_LIGACAO;
+    c.parametro = MODULO;
+    return concluirGravacaoImagem(&g, &c);
+}
+
+/**
+ * Abre uma imagem da matriz esparsa, mapeando-a na memória
+ * Confere a tabela de diretores (poucos registros, no fim do arquivo); os
+ * números só são lidos quando consultados.
+ * @param caminho Arquivo da imagem
+ * @param imagem Recebe a matriz mapeada
+ * @return false se o arquivo não existe, não é uma imagem de matriz válida
+ *         ou foi gravado com outro MODULO
+ */
+bool abrirImagemMatriz(const char *caminho, struct imagemMatriz *imagem) {
+    if (!mapearImagem(caminho, "MATRIZES", sizeof(int32_t), sizeof(struct diretorImagem), &imagem->mapa)) {
+        return false;
+    }
+    const struct cabecalhoImagem *c = imagem->mapa.cabecalho;
+    imagem->numeros = (const int32_t *) imagem->mapa.registros;
+    imagem->diretores = (const struct diretorImagem *) imagem->mapa.extras;
+    imagem->quantidadeDiretores = (uint32_t) c->extras;
+
+    bool valida = c->parametro == MODULO && c->extras < SEM_LIGACAO;
+    for (uint32_t d = 0; valida && d < imagem->quantidadeDiretores; d++) {
+        valida = (uint64_t) imagem->diretores[d].inicio + imagem->diretores[d].quantidade <= c->registros;
+    }
+    if (!valida) {
+        desmapearImagem(&imagem->mapa);
+        return false;
+    }
+    // Uma consulta percorre a faixa inteira do diretor: aqui a leitura adiante ajuda
+#ifdef MADV_NORMAL
+    madvise(imagem->mapa.mapa, imagem->mapa.tamanho, MADV_NORMAL);
+#endif
+    return true;
+}
+
+/**
+ * Busca um número direto na imagem mapeada
+ * Mesma busca de buscar, mas a lista do diretor é uma faixa contígua de
+ * int32_t em vez de nós espalhados pela memória.
+ * @param imagem Matriz aberta com abrirImagemMatriz
+ * @param numero Valor procurado
+ * @return Ponteiro para o número na imagem ou NULL
+ */
+const int32_t *buscarImagemMatriz(const struct imagemMatriz *imagem, int numero) {
+    int resto = numero % MODULO;
+    for (uint32_t d = 0; d < imagem->quantidadeDiretores; d++) {
+        if (imagem->diretores[d].resto != resto) {
+            continue;
+        }
+        const int32_t *atual = imagem->numeros + imagem->diretores[d].inicio;
+        const int32_t *fim = atual + imagem->diretores[d].quantidade;
+        for (; atual < fim; atual++) {
+            if (*atual == numero) {
+                return atual;
+            }
+        }
+        return NULL;
+    }
+    return NULL;
+}
+
+/**
+ * Reconstrói a matriz esparsa em memória a partir da imagem
+ * Diretores e listas ficam na mesma ordem da matriz gravada. Cada número é
+ * ligado no fim da sua lista, sem buscas: O(n) no total.
+ * @param imagem Matriz aberta com abrirImagemMatriz
+ * @return Ponteiro para o início da lista de diretores
+ */
+struct diretor *restaurarMatriz(const struct imagemMatriz *imagem) {
+    struct diretor *cabeca = NULL;
+    // criarDiretor insere no início, então os diretores são criados de trás para frente
+    for (uint32_t d = imagem->quantidadeDiretores; d-- > 0;) {
+        cabeca = criarDiretor(cabeca, imagem->diretores[d].resto);
+        struct no **fim = &cabeca->proximoNo;
+        const int32_t *numeros = imagem->numeros + imagem->diretores[d].inicio;
+        for (uint32_t k = 0; k < imagem->diretores[d].quantidade; k++) {
+            struct no *novoNo = (struct no *) alocarNo(&alocadorMatriz);
+            if (novoNo == NULL) {
+                fprintf(stderr, "Erro na alocação de memória.\n");
+                exit(EXIT_FAILURE);
+            }
+            novoNo->numero = numeros[k];
+            novoNo->proximoNo = NULL;
+            *fim = novoNo;
+            fim = &novoNo->proximoNo;
+        }
+    }
+    return cabeca;
+}
+
+/**
+ * Fecha uma imagem da matriz esparsa (desfaz o mapeamento)
+ */
+void fecharImagemMatriz(struct imagemMatriz *imagem) {
+    desmapearImagem(&imagem->mapa);
+}
+#endif
+
 int main() {
     struct diretor *matriz = NULL;
     
@@ -0,0 +1,515 @@
+/**
+ * Multiplicação de Matrizes Esparsas (SpGEMM) Paralela em C
+ *
+ * Este código calcula C = A B para duas matrizes CSR de Matriz_CSR.h:
+ * - Fase simbólica: conta quantas colunas distintas cada linha de C terá,
+ *   sem calcular valores. A soma de prefixos desses tamanhos dá o vetor
+ *   inicio de C, e coluna/valor são alocados uma única vez, já no tamanho
+ *   exato (nada de realloc no meio do cálculo)
+ * - Fase numérica: recalcula cada linha, agora com os valores, e a escreve
+ *   direto na sua posição final, com as colunas ordenadas
+ * - Acumulador por thread escolhido por linha: denso (um vetor do tamanho
+ *   do número de colunas de B) quando a linha gera muitos produtos, ou
+ *   tabela hash com sondagem linear quando gera poucos
+ * - As linhas são distribuídas dinamicamente: cada thread pega o próximo
+ *   lote de linhas de um contador compartilhado, então linhas muito longas
+ *   (matrizes de grafos com lei de potência) não travam uma thread só
+ * - Pico de memória: a multiplicação contabiliza tudo o que aloca (saída e
+ *   acumuladores), e o main também mostra o pico de RSS do processo
+ *
+ *   gcc -O2 -pthread SpGEMM.c -o spgemm
+ *   ./spgemm [linhas] [elementos_por_linha]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "Matriz_CSR.h"
+
+#define LOTE_LINHAS 64          // Linhas que uma thread pega de cada vez
+#define FRACAO_DENSO 16         // Acumulador denso quando a linha gera mais de colunas/16 produtos
+#define ORDENACAO_SIMPLES 32    // Até este tamanho, ordena por inserção
+#define BITS_RADIX 11
+
+// Memória alocada pela multiplicação (bytes em uso e maior valor já visto)
+static atomic_size_t memoriaAtual;
+static atomic_size_t memoriaPico;
+
+// Acumulador de uma thread, reaproveitado entre as linhas e entre as fases
+struct acumulador {
+    int colunas;
+    int *marca;                 // Denso: marca[j] = linha que usou a coluna j por último
+    double *denso;
+    int *chaves;                // Hash: -1 = posição livre
+    double *valores;
+    size_t capacidadeHash;
+    int *presentes;             // Colunas que apareceram na linha atual
+    int *auxiliar;              // Vetor de trabalho da ordenação
+    size_t capacidadePresentes;
+};
+
+// Tarefa de uma thread
+struct tarefaSpGEMM {
+    const struct matrizCSR *a;
+    const struct matrizCSR *b;
+    struct matrizCSR *c;
+    atomic_int *proxima;        // Próxima linha ainda não distribuída
+    bool numerica;              // false = fase simbólica
+    struct acumulador acumulador;
+};
+
+/**
+ * Registra bytes alocados e atualiza o pico
+ */
+static void contabilizar(size_t bytes) {
+    size_t atual = atomic_fetch_add(&memoriaAtual, bytes) + bytes;
+    size_t pico = atomic_load(&memoriaPico);
+    while (atual > pico && !atomic_compare_exchange_weak(&memoriaPico, &pico, atual)) {
+    }
+}
+
+/**
+ * Aloca memória contabilizada
+ */
+static void *reservar(size_t bytes) {
+    void *p = alocarMatriz(bytes);
+    contabilizar(bytes);
+    return p;
+}
+
+/**
+ * Libera memória contabilizada
+ */
+static void devolver(void *p, size_t bytes) {
+    if (p != NULL) {
+        free(p);
+        atomic_fetch_sub(&memoriaAtual, bytes);
+    }
+}
+
+static uint32_t hashColuna(int coluna) {
+    uint32_t h = (uint32_t) coluna;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/**
+ * Ordena as colunas de uma linha de C
+ * Linhas curtas por inserção; longas por radix sort de 11 bits por passada
+ * (sem a chamada de função por comparação do qsort).
+ * @param v Colunas
+ * @param auxiliar Vetor de trabalho com n posições
+ * @param n Quantidade de colunas
+ * @param colunas Maior coluna possível + 1 (define quantas passadas são necessárias)
+ */
+static void ordenarColunas(int *v, int *auxiliar, size_t n, int colunas) {
+    if (n <= ORDENACAO_SIMPLES) {
+        for (size_t i = 1; i < n; i++) {
+            int atual = v[i];
+            size_t j = i;
+            while (j > 0 && v[j - 1] > atual) {
+                v[j] = v[j - 1];
+                j--;
+            }
+            v[j] = atual;
+        }
+        return;
+    }
+    // Passadas necessárias para os bits de colunas - 1 (o deslocamento fica abaixo de 32)
+    int bits = 0;
+    for (unsigned maior = colunas > 1 ? (unsigned) colunas - 1 : 0; maior > 0; maior >>= 1) {
+        bits++;
+    }
+    int passadas = (bits + BITS_RADIX - 1) / BITS_RADIX;
+
+    int *origem = v, *destino = auxiliar;
+    for (int passada = 0; passada < passadas; passada++) {
+        int deslocamento = passada * BITS_RADIX;
+        size_t contagem[1 << BITS_RADIX] = {0};
+        for (size_t i = 0; i < n; i++) {
+            contagem[((unsigned) origem[i] >> deslocamento) & ((1u << BITS_RADIX) - 1)]++;
+        }
+        size_t soma = 0;
+        for (int d = 0; d < 1 << BITS_RADIX; d++) {
+            size_t c = contagem[d];
+            contagem[d] = soma;
+            soma += c;
+        }
+        for (size_t i = 0; i < n; i++) {
+            destino[contagem[((unsigned) origem[i] >> deslocamento) & ((1u << BITS_RADIX) - 1)]++] = origem[i];
+        }
+        int *troca = origem;
+        origem = destino;
+        destino = troca;
+    }
+    if (origem != v) {
+        memcpy(v, origem, n * sizeof(int));
+    }
+}
+
+/**
+ * Garante espaço para as colunas presentes em uma linha
+ */
+static void reservarPresentes(struct acumulador *acc, size_t limite) {
+    if (limite <= acc->capacidadePresentes) {
+        return;
+    }
+    devolver(acc->presentes, acc->capacidadePresentes * sizeof(int));
+    devolver(acc->auxiliar, acc->capacidadePresentes * sizeof(int));
+    acc->capacidadePresentes = limite;
+    acc->presentes = (int *) reservar(limite * sizeof(int));
+    acc->auxiliar = (int *) reservar(limite * sizeof(int));
+}
+
+/**
+ * Posição da coluna na tabela hash (livre ou já ocupada por ela)
+ */
+static size_t posicaoHash(const struct acumulador *acc, size_t mascara, int coluna) {
+    size_t i = hashColuna(coluna) & mascara;
+    while (acc->chaves[i] != -1 && acc->chaves[i] != coluna) {
+        i = (i + 1) & mascara;
+    }
+    return i;
+}
+
+/**
+ * Calcula uma linha de C (só o tamanho na fase simbólica)
+ * @param t Tarefa da thread
+ * @param i Linha
+ */
+static void processarLinha(struct tarefaSpGEMM *t, int i) {
+    const struct matrizCSR *a = t->a, *b = t->b;
+    struct acumulador *acc = &t->acumulador;
+
+    // Limite superior: quantidade de produtos que a linha gera
+    size_t limite = 0;
+    for (size_t k = a->inicio[i]; k < a->inicio[i + 1]; k++) {
+        int linhaB = a->coluna[k];
+        limite += b->inicio[linhaB + 1] - b->inicio[linhaB];
+    }
+    if (limite == 0) {
+        if (!t->numerica) {
+            t->c->inicio[i + 1] = 0;
+        }
+        return;
+    }
+    if (limite > (size_t) acc->colunas) {
+        limite = (size_t) acc->colunas;   // Nunca há mais colunas distintas que colunas
+    }
+    reservarPresentes(acc, limite);
+    size_t n = 0;
+
+    if (limite * FRACAO_DENSO >= (size_t) acc->colunas) {
+        // Acumulador denso, criado na primeira linha que precisar
+        if (acc->marca == NULL) {
+            acc->marca = (int *) reservar((size_t) acc->colunas * sizeof(int));
+            acc->denso = (double *) reservar((size_t) acc->colunas * sizeof(double));
+            memset(acc->marca, 0xFF, (size_t) acc->colunas * sizeof(int));
+        }
+        for (size_t k = a->inicio[i]; k < a->inicio[i + 1]; k++) {
+            int linhaB = a->coluna[k];
+            double v = a->valor[k];
+            for (size_t p = b->inicio[linhaB]; p < b->inicio[linhaB + 1]; p++) {
+                int j = b->coluna[p];
+                if (acc->marca[j] != i) {
+                    acc->marca[j] = i;
+                    acc->presentes[n++] = j;
+                    if (t->numerica) {
+                        acc->denso[j] = v * b->valor[p];
+                    }
+                } else if (t->numerica) {
+                    acc->denso[j] += v * b->valor[p];
+                }
+            }
+        }
+        if (t->numerica) {
+            size_t base = t->c->inicio[i];
+            ordenarColunas(acc->presentes, acc->auxiliar, n, acc->colunas);
+            for (size_t q = 0; q < n; q++) {
+                t->c->coluna[base + q] = acc->presentes[q];
+                t->c->valor[base + q] = acc->denso[acc->presentes[q]];
+            }
+        }
+    } else {
+        // Tabela hash com pelo menos o dobro do limite (ocupação até 50%)
+        size_t capacidade = 16;
+        while (capacidade < 2 * limite) {
+            capacidade *= 2;
+        }
+        if (capacidade > acc->capacidadeHash) {
+            devolver(acc->chaves, acc->capacidadeHash * sizeof(int));
+            devolver(acc->valores, acc->capacidadeHash * sizeof(double));
+            acc->capacidadeHash = capacidade;
+            acc->chaves = (int *) reservar(capacidade * sizeof(int));
+            acc->valores = (double *) reservar(capacidade * sizeof(double));
+        }
+        size_t mascara = capacidade - 1;
+        memset(acc->chaves, 0xFF, capacidade * sizeof(int));
+        for (size_t k = a->inicio[i]; k < a->inicio[i + 1]; k++) {
+            int linhaB = a->coluna[k];
+            double v = a->valor[k];
+            for (size_t p = b->inicio[linhaB]; p < b->inicio[linhaB + 1]; p++) {
+                int j = b->coluna[p];
+                size_t posicao = posicaoHash(acc, mascara, j);
+                if (acc->chaves[posicao] == -1) {
+                    acc->chaves[posicao] = j;
+                    acc->presentes[n++] = j;
+                    if (t->numerica) {
+                        acc->valores[posicao] = v * b->valor[p];
+                    }
+                } else if (t->numerica) {
+                    acc->valores[posicao] += v * b->valor[p];
+                }
+            }
+        }
+        if (t->numerica) {
+            size_t base = t->c->inicio[i];
+            ordenarColunas(acc->presentes, acc->auxiliar, n, acc->colunas);
+            for (size_t q = 0; q < n; q++) {
+                t->c->coluna[base + q] = acc->presentes[q];
+                t->c->valor[base + q] = acc->valores[posicaoHash(acc, mascara, acc->presentes[q])];
+            }
+        }
+    }
+
+    if (!t->numerica) {
+        t->c->inicio[i + 1] = n;
+    }
+}
+
+/**
+ * Thread da SpGEMM: pega lotes de linhas até acabarem
+ */
+static void *executarSpGEMM(void *arg) {
+    struct tarefaSpGEMM *t = (struct tarefaSpGEMM *) arg;
+    int linhas = t->a->linhas;
+    for (;;) {
+        int primeira = atomic_fetch_add(t->proxima, LOTE_LINHAS);
+        if (primeira >= linhas) {
+            break;
+        }
+        int ultima = linhas - primeira < LOTE_LINHAS ? linhas : primeira + LOTE_LINHAS;
+        for (int i = primeira; i < ultima; i++) {
+            processarLinha(t, i);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Multiplicação de matrizes esparsas C = A B
+ * @param a Matriz CSR com a->colunas == b->linhas
+ * @param b Matriz CSR
+ * @return Nova matriz CSR com a->linhas linhas e b->colunas colunas
+ */
+static struct matrizCSR multiplicarMatrizes(const struct matrizCSR *a, const struct matrizCSR *b) {
+    if (a->colunas != b->linhas) {
+        fprintf(stderr, "Dimensões incompatíveis: %d x %d vezes %d x %d.\n", a->linhas, a->colunas, b->linhas, b->colunas);
+        exit(EXIT_FAILURE);
+    }
+    struct matrizCSR c;
+    c.linhas = a->linhas;
+    c.colunas = b->colunas;
+    c.inicio = (size_t *) reservar(((size_t) c.linhas + 1) * sizeof(size_t));
+    c.coluna = NULL;
+    c.valor = NULL;
+
+    int threads = threadsMatriz(a->nnz);
+    atomic_int proxima;
+    struct tarefaSpGEMM tarefas[MAX_THREADS_MATRIZ];
+    for (int t = 0; t < threads; t++) {
+        memset(&tarefas[t], 0, sizeof(struct tarefaSpGEMM));
+        tarefas[t].a = a;
+        tarefas[t].b = b;
+        tarefas[t].c = &c;
+        tarefas[t].proxima = &proxima;
+        tarefas[t].acumulador.colunas = b->colunas;
+    }
+
+    // Fase simbólica: tamanhos das linhas em inicio[i + 1]
+    atomic_init(&proxima, 0);
+    executarParalelo(threads, executarSpGEMM, tarefas, sizeof(struct tarefaSpGEMM));
+    c.inicio[0] = 0;
+    for (int i = 0; i < c.linhas; i++) {
+        c.inicio[i + 1] += c.inicio[i];
+    }
+
+    // Saída alocada uma vez, no tamanho exato
+    c.nnz = c.inicio[c.linhas];
+    c.coluna = (int *) reservar(c.nnz * sizeof(int));
+    c.valor = (double *) reservar(c.nnz * sizeof(double));
+
+    // Fase numérica; as marcas da fase simbólica não valem mais
+    atomic_store(&proxima, 0);
+    for (int t = 0; t < threads; t++) {
+        tarefas[t].numerica = true;
+        if (tarefas[t].acumulador.marca != NULL) {
+            memset(tarefas[t].acumulador.marca, 0xFF, (size_t) b->colunas * sizeof(int));
+        }
+    }
+    executarParalelo(threads, executarSpGEMM, tarefas, sizeof(struct tarefaSpGEMM));
+
+    for (int t = 0; t < threads; t++) {
+        struct acumulador *acc = &tarefas[t].acumulador;
+        devolver(acc->marca, (size_t) acc->colunas * sizeof(int));
+        devolver(acc->denso, (size_t) acc->colunas * sizeof(double));
+        devolver(acc->chaves, acc->capacidadeHash * sizeof(int));
+        devolver(acc->valores, acc->capacidadeHash * sizeof(double));
+        devolver(acc->presentes, acc->capacidadePresentes * sizeof(int));
+        devolver(acc->auxiliar, acc->capacidadePresentes * sizeof(int));
+    }
+    return c;
+}
+
+/**
+ * Confere algumas linhas de C contra um cálculo direto com vetor denso
+ * @return Quantidade de linhas com diferença
+ */
+static int conferirLinhas(const struct matrizCSR *a, const struct matrizCSR *b, const struct matrizCSR *c, int amostras) {
+    double *linha = (double *) calloc((size_t) c->colunas, sizeof(double));
+    bool *usada = (bool *) calloc((size_t) c->colunas, sizeof(bool));
+    if (linha == NULL || usada == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    int erros = 0;
+    for (int s = 0; s < amostras; s++) {
+        // Inclui a linha 0 (a mais longa) e linhas espalhadas
+        int i = (int) ((long long) c->linhas * s / amostras);
+        for (size_t k = a->inicio[i]; k < a->inicio[i + 1]; k++) {
+            for (size_t p = b->inicio[a->coluna[k]]; p < b->inicio[a->coluna[k] + 1]; p++) {
+                linha[b->coluna[p]] += a->valor[k] * b->valor[p];
+                usada[b->coluna[p]] = true;
+            }
+        }
+        size_t encontrados = 0;
+        bool correta = true;
+        for (size_t k = c->inicio[i]; k < c->inicio[i + 1]; k++) {
+            int j = c->coluna[k];
+            if (!usada[j] || fabs(c->valor[k] - linha[j]) > 1e-9 * (1.0 + fabs(linha[j])) ||
+                (k > c->inicio[i] && c->coluna[k - 1] >= j)) {
+                correta = false;
+            }
+        }
+        for (size_t k = a->inicio[i]; k < a->inicio[i + 1]; k++) {
+            for (size_t p = b->inicio[a->coluna[k]]; p < b->inicio[a->coluna[k] + 1]; p++) {
+                int j = b->coluna[p];
+                if (usada[j]) {
+                    encontrados++;
+                    usada[j] = false;
+                }
+                linha[j] = 0.0;
+            }
+        }
+        if (!correta || encontrados != c->inicio[i + 1] - c->inicio[i]) {
+            erros++;
+        }
+    }
+    free(linha);
+    free(usada);
+    return erros;
+}
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+/**
+ * Bytes ocupados por uma matriz CSR
+ */
+static size_t bytesCSR(const struct matrizCSR *a) {
+    return ((size_t) a->linhas + 1) * sizeof(size_t) + a->nnz * (sizeof(int) + sizeof(double));
+}
+
+int main(int argc, char *argv[]) {
+    int linhas = argc > 1 ? atoi(argv[1]) : 500000;
+    int porLinha = argc > 2 ? atoi(argv[2]) : 8;
+
+    // Exemplo pequeno
+    struct matrizCOO coo = criarCOO(3, 4, 5);
+    adicionarCOO(&coo, 0, 0, 1.0);
+    adicionarCOO(&coo, 0, 2, 2.0);
+    adicionarCOO(&coo, 1, 1, 3.0);
+    adicionarCOO(&coo, 2, 0, 4.0);
+    adicionarCOO(&coo, 2, 3, 5.0);
+    struct matrizCSR a = cooParaCSR(&coo);
+    liberarCOO(&coo);
+    coo = criarCOO(4, 2, 4);
+    adicionarCOO(&coo, 0, 0, 1.0);
+    adicionarCOO(&coo, 1, 1, 2.0);
+    adicionarCOO(&coo, 2, 0, 3.0);
+    adicionarCOO(&coo, 3, 1, 1.0);
+    struct matrizCSR b = cooParaCSR(&coo);
+    liberarCOO(&coo);
+    struct matrizCSR c = multiplicarMatrizes(&a, &b);
+
+    printf("A:\n");
+    imprimirCSR(&a);
+    printf("\nB:\n");
+    imprimirCSR(&b);
+    printf("\nA * B:\n");
+    imprimirCSR(&c);
+    liberarCSR(&a);
+    liberarCSR(&b);
+    liberarCSR(&c);
+
+    // Matriz aleatória com linhas em lei de potência, elevada ao quadrado
+    size_t total = (size_t) linhas * (size_t) porLinha;
+    coo = criarCOO(linhas, linhas, total);
+    uint64_t semente = 0x9E3779B97F4A7C15ull;
+    for (size_t k = 0; k < total; k++) {
+        semente ^= semente << 13;
+        semente ^= semente >> 7;
+        semente ^= semente << 17;
+        double u = (double) (semente >> 11) / 9007199254740992.0;
+        int i = (int) ((double) linhas * u * u * u);
+        int j = (int) ((semente >> 3) % (uint64_t) linhas);
+        adicionarCOO(&coo, i, j, (double) (k % 7) - 3.0);
+    }
+    a = cooParaCSR(&coo);
+    liberarCOO(&coo);
+
+    size_t produtos = 0;
+    for (size_t k = 0; k < a.nnz; k++) {
+        produtos += a.inicio[a.coluna[k] + 1] - a.inicio[a.coluna[k]];
+    }
+
+    atomic_store(&memoriaAtual, 0);
+    atomic_store(&memoriaPico, 0);
+    struct timespec t0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    c = multiplicarMatrizes(&a, &a);
+    double segundos = segundosDesde(&t0);
+
+    struct rusage uso;
+    getrusage(RUSAGE_SELF, &uso);
+    int erros = conferirLinhas(&a, &a, &c, 1000);
+
+    printf("\nA: %d x %d, %zu elementos (%.1f MB)\n", linhas, linhas, a.nnz, bytesCSR(&a) / 1e6);
+    printf("A * A: %zu elementos (%.1f MB), %zu produtos, %d threads\n", c.nnz, bytesCSR(&c) / 1e6,
+           produtos, threadsMatriz(a.nnz));
+    printf("Tempo: %.3f s, %.2f GFLOP/s\n", segundos, 2.0 * (double) produtos / segundos / 1e9);
+    printf("Pico de memoria da multiplicacao: %.1f MB (saida %.1f MB + acumuladores)\n",
+           atomic_load(&memoriaPico) / 1e6, bytesCSR(&c) / 1e6);
+    printf("Pico de RSS do processo: %.1f MB\n", uso.ru_maxrss / 1e3);
+    printf("Conferencia de 1000 linhas: %s\n", erros == 0 ? "ok" : "DIFERENCAS ENCONTRADAS");
+
+    liberarCSR(&a);
+    liberarCSR(&c);
+    return 0;
+}
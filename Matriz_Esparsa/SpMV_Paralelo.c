@@ -0,0 +1,504 @@
+/**
+ * Multiplicação Matriz Esparsa-Vetor (SpMV) Paralela e Vetorizada em C
+ *
+ * Este código acelera y = A x sobre a matriz CSR de Matriz_CSR.h:
+ * - Divisão entre threads por quantidade de elementos, e não de linhas: em
+ *   matrizes com distribuição de lei de potência algumas linhas concentram
+ *   boa parte dos elementos, e dividir por linhas deixa uma thread com quase
+ *   todo o trabalho
+ * - Núcleos AVX2 e AVX-512 que leem x com gather (uma instrução busca 4 ou
+ *   8 posições de x pelos índices de coluna), com versão escalar de reserva.
+ *   O núcleo é escolhido em tempo de execução pelo que o processador suporta
+ * - Formato SELL-C-σ: as linhas são agrupadas em fatias de C linhas e
+ *   guardadas coluna a coluna, de modo que cada passo do laço processa uma
+ *   posição de C linhas ao mesmo tempo (um vetor inteiro). Dentro de
+ *   janelas de σ linhas, as linhas são ordenadas por tamanho para reduzir o
+ *   preenchimento com zeros das fatias
+ *
+ * O main compara os formatos e núcleos em GFLOP/s e em largura de banda
+ * efetiva (bytes que precisam vir da memória por segundo).
+ *
+ *   gcc -O2 -pthread SpMV_Paralelo.c -o spmv_paralelo
+ *   ./spmv_paralelo [linhas] [elementos_por_linha]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+#include <immintrin.h>
+#include "Matriz_CSR.h"
+
+#define SELL_C 8            // Linhas por fatia (um vetor AVX-512 de doubles)
+#define SELL_SIGMA 256      // Janela de ordenação das linhas por tamanho
+
+enum nucleo {
+    NUCLEO_ESCALAR,
+    NUCLEO_AVX2,
+    NUCLEO_AVX512
+};
+
+static const char *nomesNucleos[] = {"escalar", "AVX2", "AVX-512"};
+
+// Matriz no formato SELL-C-σ
+struct matrizSELL {
+    int linhas;
+    int colunas;
+    int fatias;
+    size_t nnz;                 // Elementos reais
+    size_t armazenados;         // Elementos + preenchimento
+    size_t *inicioFatia;        // fatias + 1 posições
+    int *largura;               // Maior linha de cada fatia
+    int *permutacao;            // Posição na ordem SELL -> linha original (-1 = linha de preenchimento)
+    int *coluna;
+    double *valor;
+};
+
+// Tarefa de uma thread da SpMV
+struct tarefaSpMV {
+    const struct matrizCSR *csr;
+    const struct matrizSELL *sell;
+    const double *x;
+    double *y;
+    int primeira, ultima;       // Linhas (CSR) ou fatias (SELL)
+    enum nucleo nucleo;
+};
+
+/**
+ * Escolhe o melhor núcleo suportado pelo processador
+ */
+static enum nucleo detectarNucleo(void) {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl")) {
+        return NUCLEO_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return NUCLEO_AVX2;
+    }
+    return NUCLEO_ESCALAR;
+}
+
+/**
+ * Divide n itens entre threads pelo total acumulado (elementos)
+ * @param inicio Prefixo acumulado com n + 1 posições (inicio da CSR ou inicioFatia)
+ * @param n Quantidade de itens (linhas ou fatias)
+ * @param threads Quantidade de partes
+ * @param limites Recebe threads + 1 posições: a parte t vai de limites[t] a limites[t + 1]
+ */
+static void particionarPorElementos(const size_t *inicio, int n, int threads, int *limites) {
+    size_t total = inicio[n];
+    limites[0] = 0;
+    for (int t = 1; t < threads; t++) {
+        // Primeiro item cujo início alcança a fração t/threads dos elementos
+        size_t alvo = total * (size_t) t / (size_t) threads;
+        int baixo = limites[t - 1], alto = n;
+        while (baixo < alto) {
+            int meio = baixo + (alto - baixo) / 2;
+            if (inicio[meio] < alvo) {
+                baixo = meio + 1;
+            } else {
+                alto = meio;
+            }
+        }
+        limites[t] = baixo;
+    }
+    limites[threads] = n;
+}
+
+/**
+ * Divide n itens entre threads em partes de mesmo número de itens
+ */
+static void particionarPorLinhas(int n, int threads, int *limites) {
+    for (int t = 0; t <= threads; t++) {
+        limites[t] = (int) ((long long) n * t / threads);
+    }
+}
+
+/**
+ * Razão entre a maior parte e a média (1.0 = equilíbrio perfeito)
+ */
+static double desequilibrio(const size_t *inicio, int threads, const int *limites) {
+    size_t maior = 0;
+    for (int t = 0; t < threads; t++) {
+        size_t parte = inicio[limites[t + 1]] - inicio[limites[t]];
+        if (parte > maior) {
+            maior = parte;
+        }
+    }
+    double media = (double) inicio[limites[threads]] / threads;
+    return media > 0 ? (double) maior / media : 1.0;
+}
+
+/**
+ * CSR escalar
+ */
+static void csrEscalar(const struct matrizCSR *a, const double *x, double *y, int primeira, int ultima) {
+    for (int i = primeira; i < ultima; i++) {
+        double soma = 0.0;
+        for (size_t k = a->inicio[i]; k < a->inicio[i + 1]; k++) {
+            soma += a->valor[k] * x[a->coluna[k]];
+        }
+        y[i] = soma;
+    }
+}
+
+/**
+ * CSR com AVX2: 4 elementos da linha por passo
+ */
+__attribute__((target("avx2,fma")))
+static void csrAVX2(const struct matrizCSR *a, const double *x, double *y, int primeira, int ultima) {
+    for (int i = primeira; i < ultima; i++) {
+        size_t k = a->inicio[i], fim = a->inicio[i + 1];
+        __m256d acumulador = _mm256_setzero_pd();
+        for (; k + 4 <= fim; k += 4) {
+            __m128i indices = _mm_loadu_si128((const __m128i *) (a->coluna + k));
+            __m256d vx = _mm256_i32gather_pd(x, indices, 8);
+            acumulador = _mm256_fmadd_pd(_mm256_loadu_pd(a->valor + k), vx, acumulador);
+        }
+        __m128d metade = _mm_add_pd(_mm256_castpd256_pd128(acumulador), _mm256_extractf128_pd(acumulador, 1));
+        double soma = _mm_cvtsd_f64(_mm_add_sd(metade, _mm_unpackhi_pd(metade, metade)));
+        for (; k < fim; k++) {
+            soma += a->valor[k] * x[a->coluna[k]];
+        }
+        y[i] = soma;
+    }
+}
+
+/**
+ * CSR com AVX-512: 8 elementos da linha por passo, resto com máscara
+ * (a carga mascarada de 8 índices de 32 bits precisa de AVX-512VL)
+ */
+__attribute__((target("avx512f,avx512vl")))
+static void csrAVX512(const struct matrizCSR *a, const double *x, double *y, int primeira, int ultima) {
+    for (int i = primeira; i < ultima; i++) {
+        size_t k = a->inicio[i], fim = a->inicio[i + 1];
+        __m512d acumulador = _mm512_setzero_pd();
+        for (; k + 8 <= fim; k += 8) {
+            __m256i indices = _mm256_loadu_si256((const __m256i *) (a->coluna + k));
+            __m512d vx = _mm512_i32gather_pd(indices, x, 8);
+            acumulador = _mm512_fmadd_pd(_mm512_loadu_pd(a->valor + k), vx, acumulador);
+        }
+        if (k < fim) {
+            __mmask8 mascara = (__mmask8) ((1u << (fim - k)) - 1);
+            __m256i indices = _mm256_maskz_loadu_epi32(mascara, a->coluna + k);
+            __m512d vx = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mascara, indices, x, 8);
+            acumulador = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mascara, a->valor + k), vx, acumulador);
+        }
+        y[i] = _mm512_reduce_add_pd(acumulador);
+    }
+}
+
+/**
+ * SELL escalar: C linhas por vez, coluna a coluna da fatia
+ */
+static void sellEscalar(const struct matrizSELL *s, const double *x, double *y, int primeira, int ultima) {
+    for (int f = primeira; f < ultima; f++) {
+        double soma[SELL_C] = {0.0};
+        const int *coluna = s->coluna + s->inicioFatia[f];
+        const double *valor = s->valor + s->inicioFatia[f];
+        for (int j = 0; j < s->largura[f]; j++) {
+            for (int r = 0; r < SELL_C; r++) {
+                soma[r] += valor[j * SELL_C + r] * x[coluna[j * SELL_C + r]];
+            }
+        }
+        for (int r = 0; r < SELL_C; r++) {
+            int linha = s->permutacao[f * SELL_C + r];
+            if (linha >= 0) {
+                y[linha] = soma[r];
+            }
+        }
+    }
+}
+
+/**
+ * SELL com AVX2: dois vetores de 4 linhas por passo
+ */
+__attribute__((target("avx2,fma")))
+static void sellAVX2(const struct matrizSELL *s, const double *x, double *y, int primeira, int ultima) {
+    for (int f = primeira; f < ultima; f++) {
+        __m256d baixo = _mm256_setzero_pd(), alto = _mm256_setzero_pd();
+        const int *coluna = s->coluna + s->inicioFatia[f];
+        const double *valor = s->valor + s->inicioFatia[f];
+        for (int j = 0; j < s->largura[f]; j++) {
+            __m256i indices = _mm256_loadu_si256((const __m256i *) (coluna + j * SELL_C));
+            __m256d xBaixo = _mm256_i32gather_pd(x, _mm256_castsi256_si128(indices), 8);
+            __m256d xAlto = _mm256_i32gather_pd(x, _mm256_extracti128_si256(indices, 1), 8);
+            baixo = _mm256_fmadd_pd(_mm256_loadu_pd(valor + j * SELL_C), xBaixo, baixo);
+            alto = _mm256_fmadd_pd(_mm256_loadu_pd(valor + j * SELL_C + 4), xAlto, alto);
+        }
+        double soma[SELL_C];
+        _mm256_storeu_pd(soma, baixo);
+        _mm256_storeu_pd(soma + 4, alto);
+        for (int r = 0; r < SELL_C; r++) {
+            int linha = s->permutacao[f * SELL_C + r];
+            if (linha >= 0) {
+                y[linha] = soma[r];
+            }
+        }
+    }
+}
+
+/**
+ * SELL com AVX-512: as 8 linhas da fatia em um vetor
+ */
+__attribute__((target("avx512f")))
+static void sellAVX512(const struct matrizSELL *s, const double *x, double *y, int primeira, int ultima) {
+    for (int f = primeira; f < ultima; f++) {
+        __m512d acumulador = _mm512_setzero_pd();
+        const int *coluna = s->coluna + s->inicioFatia[f];
+        const double *valor = s->valor + s->inicioFatia[f];
+        for (int j = 0; j < s->largura[f]; j++) {
+            __m256i indices = _mm256_loadu_si256((const __m256i *) (coluna + j * SELL_C));
+            __m512d vx = _mm512_i32gather_pd(indices, x, 8);
+            acumulador = _mm512_fmadd_pd(_mm512_loadu_pd(valor + j * SELL_C), vx, acumulador);
+        }
+        double soma[SELL_C];
+        _mm512_storeu_pd(soma, acumulador);
+        for (int r = 0; r < SELL_C; r++) {
+            int linha = s->permutacao[f * SELL_C + r];
+            if (linha >= 0) {
+                y[linha] = soma[r];
+            }
+        }
+    }
+}
+
+/**
+ * Thread da SpMV: aplica o núcleo escolhido à sua faixa
+ */
+static void *executarTarefaSpMV(void *arg) {
+    struct tarefaSpMV *t = (struct tarefaSpMV *) arg;
+    if (t->csr != NULL) {
+        switch (t->nucleo) {
+            case NUCLEO_AVX512: csrAVX512(t->csr, t->x, t->y, t->primeira, t->ultima); break;
+            case NUCLEO_AVX2:   csrAVX2(t->csr, t->x, t->y, t->primeira, t->ultima); break;
+            default:            csrEscalar(t->csr, t->x, t->y, t->primeira, t->ultima); break;
+        }
+    } else {
+        switch (t->nucleo) {
+            case NUCLEO_AVX512: sellAVX512(t->sell, t->x, t->y, t->primeira, t->ultima); break;
+            case NUCLEO_AVX2:   sellAVX2(t->sell, t->x, t->y, t->primeira, t->ultima); break;
+            default:            sellEscalar(t->sell, t->x, t->y, t->primeira, t->ultima); break;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * SpMV paralela sobre CSR ou SELL
+ * @param csr Matriz CSR (ou NULL)
+ * @param sell Matriz SELL (usada se csr for NULL)
+ * @param limites Partição de linhas/fatias entre as threads
+ * @param threads Quantidade de threads
+ * @param nucleo Núcleo vetorial a usar
+ */
+static void multiplicarVetorParalelo(const struct matrizCSR *csr, const struct matrizSELL *sell,
+                                     const double *x, double *y, const int *limites, int threads,
+                                     enum nucleo nucleo) {
+    struct tarefaSpMV tarefas[MAX_THREADS_MATRIZ];
+    for (int t = 0; t < threads; t++) {
+        tarefas[t] = (struct tarefaSpMV) {csr, sell, x, y, limites[t], limites[t + 1], nucleo};
+    }
+    executarParalelo(threads, executarTarefaSpMV, tarefas, sizeof(struct tarefaSpMV));
+}
+
+// Linha e seu tamanho, para ordenar as linhas de uma janela σ
+struct linhaTamanho {
+    int linha;
+    size_t tamanho;
+};
+
+static int compararTamanhos(const void *a, const void *b) {
+    const struct linhaTamanho *x = (const struct linhaTamanho *) a;
+    const struct linhaTamanho *y = (const struct linhaTamanho *) b;
+    if (x->tamanho != y->tamanho) {
+        return x->tamanho < y->tamanho ? 1 : -1;   // Decrescente
+    }
+    return x->linha - y->linha;
+}
+
+/**
+ * Converte CSR para SELL-C-σ
+ * @param a Matriz CSR
+ * @return Matriz SELL com fatias de SELL_C linhas e ordenação em janelas de SELL_SIGMA
+ */
+static struct matrizSELL csrParaSELL(const struct matrizCSR *a) {
+    struct matrizSELL s;
+    s.linhas = a->linhas;
+    s.colunas = a->colunas;
+    s.nnz = a->nnz;
+    s.fatias = (a->linhas + SELL_C - 1) / SELL_C;
+    s.inicioFatia = (size_t *) alocarMatriz(((size_t) s.fatias + 1) * sizeof(size_t));
+    s.largura = (int *) alocarMatriz((size_t) s.fatias * sizeof(int));
+    s.permutacao = (int *) alocarMatriz((size_t) s.fatias * SELL_C * sizeof(int));
+
+    // Ordena as linhas por tamanho dentro de cada janela
+    struct linhaTamanho *ordem = (struct linhaTamanho *) alocarMatriz((size_t) a->linhas * sizeof(struct linhaTamanho));
+    for (int i = 0; i < a->linhas; i++) {
+        ordem[i].linha = i;
+        ordem[i].tamanho = a->inicio[i + 1] - a->inicio[i];
+    }
+    for (int i = 0; i < a->linhas; i += SELL_SIGMA) {
+        int n = a->linhas - i < SELL_SIGMA ? a->linhas - i : SELL_SIGMA;
+        qsort(ordem + i, (size_t) n, sizeof(struct linhaTamanho), compararTamanhos);
+    }
+
+    // Largura de cada fatia e posição de cada fatia nos vetores
+    size_t acumulado = 0;
+    for (int f = 0; f < s.fatias; f++) {
+        size_t largura = 0;
+        for (int r = 0; r < SELL_C; r++) {
+            int p = f * SELL_C + r;
+            s.permutacao[p] = p < a->linhas ? ordem[p].linha : -1;
+            if (p < a->linhas && ordem[p].tamanho > largura) {
+                largura = ordem[p].tamanho;
+            }
+        }
+        s.inicioFatia[f] = acumulado;
+        s.largura[f] = (int) largura;
+        acumulado += largura * SELL_C;
+    }
+    s.inicioFatia[s.fatias] = acumulado;
+    s.armazenados = acumulado;
+    free(ordem);
+
+    // Preenche coluna a coluna; o preenchimento usa coluna 0 e valor 0
+    s.coluna = (int *) calloc(acumulado > 0 ? acumulado : 1, sizeof(int));
+    s.valor = (double *) calloc(acumulado > 0 ? acumulado : 1, sizeof(double));
+    if (s.coluna == NULL || s.valor == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int f = 0; f < s.fatias; f++) {
+        for (int r = 0; r < SELL_C; r++) {
+            int linha = s.permutacao[f * SELL_C + r];
+            if (linha < 0) {
+                continue;
+            }
+            size_t j = 0;
+            for (size_t k = a->inicio[linha]; k < a->inicio[linha + 1]; k++, j++) {
+                s.coluna[s.inicioFatia[f] + j * SELL_C + (size_t) r] = a->coluna[k];
+                s.valor[s.inicioFatia[f] + j * SELL_C + (size_t) r] = a->valor[k];
+            }
+        }
+    }
+    return s;
+}
+
+/**
+ * Libera a memória de uma matriz SELL
+ */
+static void liberarSELL(struct matrizSELL *s) {
+    free(s->inicioFatia);
+    free(s->largura);
+    free(s->permutacao);
+    free(s->coluna);
+    free(s->valor);
+}
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+int main(int argc, char *argv[]) {
+    int linhas = argc > 1 ? atoi(argv[1]) : 1000000;
+    int porLinha = argc > 2 ? atoi(argv[2]) : 16;
+    const int repeticoes = 20;
+
+    // Matriz aleatória com linhas em lei de potência (algumas muito longas)
+    size_t total = (size_t) linhas * (size_t) porLinha;
+    struct matrizCOO coo = criarCOO(linhas, linhas, total);
+    uint64_t semente = 0x9E3779B97F4A7C15ull;
+    for (size_t k = 0; k < total; k++) {
+        semente ^= semente << 13;
+        semente ^= semente >> 7;
+        semente ^= semente << 17;
+        double u = (double) (semente >> 11) / 9007199254740992.0;
+        int i = (int) ((double) linhas * u * u * u);
+        int j = (int) ((semente >> 3) % (uint64_t) linhas);
+        adicionarCOO(&coo, i, j, (double) (k % 7) - 3.0);
+    }
+    struct matrizCSR a = cooParaCSR(&coo);
+    liberarCOO(&coo);
+    struct matrizSELL s = csrParaSELL(&a);
+
+    double *x = (double *) alocarMatriz((size_t) linhas * sizeof(double));
+    double *y = (double *) alocarMatriz((size_t) linhas * sizeof(double));
+    double *referencia = (double *) alocarMatriz((size_t) linhas * sizeof(double));
+    for (int i = 0; i < linhas; i++) {
+        x[i] = 1.0 / (1.0 + i % 17);
+    }
+    csrEscalar(&a, x, referencia, 0, a.linhas);
+
+    int threads = threadsMatriz(a.nnz);
+    enum nucleo melhor = detectarNucleo();
+    int limitesCSR[MAX_THREADS_MATRIZ + 1], limitesSELL[MAX_THREADS_MATRIZ + 1];
+    particionarPorElementos(a.inicio, a.linhas, threads, limitesCSR);
+    particionarPorElementos(s.inicioFatia, s.fatias, threads, limitesSELL);
+
+    // Desequilíbrio das duas partições com 8 partes, independente dos núcleos desta máquina
+    int limites8[9];
+    particionarPorLinhas(a.linhas, 8, limites8);
+    double porLinhas = desequilibrio(a.inicio, 8, limites8);
+    particionarPorElementos(a.inicio, a.linhas, 8, limites8);
+    double porElementos = desequilibrio(a.inicio, 8, limites8);
+
+    size_t maiorLinha = 0;
+    for (int i = 0; i < a.linhas; i++) {
+        if (a.inicio[i + 1] - a.inicio[i] > maiorLinha) {
+            maiorLinha = a.inicio[i + 1] - a.inicio[i];
+        }
+    }
+    printf("Matriz %d x %d, %zu elementos, maior linha com %zu\n", linhas, linhas, a.nnz, maiorLinha);
+    printf("SELL-%d-%d: %zu posicoes armazenadas (%.1f%% de preenchimento)\n", SELL_C, SELL_SIGMA,
+           s.armazenados, 100.0 * (double) (s.armazenados - s.nnz) / (double) s.armazenados);
+    printf("Maior parte / media com 8 threads: por linhas %.2f, por elementos %.2f\n", porLinhas, porElementos);
+    printf("Threads: %d, nucleo escolhido: %s\n\n", threads, nomesNucleos[melhor]);
+
+    // Bytes que precisam vir da memória: matriz inteira, x e y uma vez cada
+    double bytesVetores = (double) linhas * 2 * sizeof(double);
+    double bytesCSR = (double) a.nnz * (sizeof(double) + sizeof(int)) + (double) (linhas + 1) * sizeof(size_t) + bytesVetores;
+    double bytesSELL = (double) s.armazenados * (sizeof(double) + sizeof(int)) +
+                       (double) s.fatias * (sizeof(size_t) + sizeof(int) + SELL_C * sizeof(int)) + bytesVetores;
+
+    printf("%-8s %-8s %10s %10s %12s\n", "Formato", "Nucleo", "ms/SpMV", "GFLOP/s", "GB/s efet.");
+    for (int formato = 0; formato < 2; formato++) {
+        for (int n = NUCLEO_ESCALAR; n <= (int) melhor; n++) {
+            const struct matrizCSR *csr = formato == 0 ? &a : NULL;
+            const int *limites = formato == 0 ? limitesCSR : limitesSELL;
+
+            struct timespec t0;
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            for (int r = 0; r < repeticoes; r++) {
+                multiplicarVetorParalelo(csr, &s, x, y, limites, threads, (enum nucleo) n);
+            }
+            double segundos = segundosDesde(&t0) / repeticoes;
+
+            double erro = 0.0;
+            for (int i = 0; i < linhas; i++) {
+                double d = fabs(y[i] - referencia[i]) / (1.0 + fabs(referencia[i]));
+                if (d > erro) {
+                    erro = d;
+                }
+            }
+            printf("%-8s %-8s %10.3f %10.2f %12.2f%s\n", formato == 0 ? "CSR" : "SELL", nomesNucleos[n],
+                   segundos * 1e3, 2.0 * (double) a.nnz / segundos / 1e9,
+                   (formato == 0 ? bytesCSR : bytesSELL) / segundos / 1e9,
+                   erro > 1e-9 ? "  (RESULTADO DIFERENTE)" : "");
+        }
+    }
+
+    free(x);
+    free(y);
+    free(referencia);
+    liberarCSR(&a);
+    liberarSELL(&s);
+    return 0;
+}
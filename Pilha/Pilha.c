@@ -9,12 +9,16 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include "../Alocador_Nos/Alocador_Nos.h"
 
 struct no {
     int numero;
     struct no *proximo;
 };
 
+// Alocador dos nós (caches por thread, ver Alocador_Nos.h)
+static struct alocadorNos alocadorPilha = ALOCADOR_NOS_INICIALIZADOR(struct no);
+
 /**
  * Insere um novo número no topo da pilha (push)
  * @param topo Ponteiro para o topo da pilha
@@ -22,7 +26,7 @@ struct no {
  * @return Novo ponteiro para o topo da pilha
  */
 struct no *push(struct no *topo, int numero) {
-    struct no *novoNo = (struct no *) malloc(sizeof(struct no));
+    struct no *novoNo = (struct no *) alocarNo(&alocadorPilha);
     
     // Verifica se a alocação foi bem sucedida
     if (novoNo == NULL) {
@@ -36,22 +40,24 @@ struct no *push(struct no *topo, int numero) {
 }
 
 /**
- * Remove e retorna o elemento do topo da pilha (pop)
- * @param topo Ponteiro para o topo da pilha
+ * Remove o elemento do topo da pilha (pop)
+ * @param topo Ponteiro para o topo da pilha (não vazia)
+ * @param numero Recebe o valor removido (pode ser NULL)
  * @return Novo ponteiro para o topo da pilha
  */
-struct no *pop(struct no *topo) {
+struct no *pop(struct no *topo, int *numero) {
     // Pilha vazia
     if (topo == NULL) {
-        printf("Pilha vazia!\n");
         return NULL;
     }
 
     // Remove o elemento do topo
     struct no *remover = topo;
     topo = topo->proximo;
-    printf("Removido: %d\n", remover->numero);
-    free(remover);
+    if (numero != NULL) {
+        *numero = remover->numero;
+    }
+    liberarNo(&alocadorPilha, remover);
     return topo;
 }
 
@@ -77,13 +83,14 @@ void liberarPilha(struct no *topo) {
     while (topo != NULL) {
         struct no *remover = topo;
         topo = topo->proximo;
-        free(remover);
+        liberarNo(&alocadorPilha, remover);
     }
 }
 
 int main() {
     struct no *pilha = NULL;
     int i;
+    int numero;
     
     // Exemplo de uso com valores menores para teste
     for (i = 0; i < 10; i++) {
@@ -95,7 +102,12 @@ int main() {
     
     printf("\nRemovendo elementos:\n");
     for (i = 0; i < 5; i++) {
-        pilha = pop(pilha);
+        if (pilha == NULL) {
+            printf("Pilha vazia!\n");
+            break;
+        }
+        pilha = pop(pilha, &numero);
+        printf("Removido: %d\n", numero);
     }
     
     printf("\nEstado final da pilha:\n");
@@ -0,0 +1,308 @@
+/**
+ * Implementação de Pilha em Blocos (lista desenrolada) em C
+ *
+ * Este código implementa uma pilha formada por blocos de 4 KB encadeados, onde:
+ * - Cada bloco guarda um vetor de números, e não um único número por nó
+ * - Apenas o bloco do topo é acessado em push/pop, que ficam em cache
+ * - Um bloco vazio é guardado como reserva, evitando alocar e liberar
+ *   repetidamente quando a pilha oscila na fronteira entre dois blocos
+ * - pushN/popN transferem vários números de uma vez, bloco a bloco
+ *
+ * Comparada à Pilha.c (um malloc de 16 bytes por número), a sobrecarga de
+ * memória cai para 8 bytes a cada ~1000 números e o alocador só é chamado
+ * uma vez por bloco.
+ *
+ *   gcc -O2 Pilha_Blocos.c -o pilha_blocos
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define BYTES_BLOCO 4096
+#define ITENS_POR_BLOCO ((BYTES_BLOCO - sizeof(void *)) / sizeof(int))
+
+// Estrutura de um bloco da pilha
+struct bloco {
+    struct bloco *anterior;          // Bloco abaixo deste
+    int numeros[ITENS_POR_BLOCO];
+};
+
+// Estrutura da pilha em blocos
+struct pilhaBlocos {
+    struct bloco *topo;      // Bloco que contém o topo da pilha
+    size_t usados;           // Posições ocupadas no bloco do topo
+    size_t tamanho;          // Total de números na pilha
+    struct bloco *reserva;   // Bloco vazio guardado para reutilização
+};
+
+/**
+ * Aloca um bloco, reaproveitando a reserva se existir
+ * @param pilha Ponteiro para a pilha
+ * @return Ponteiro para o bloco
+ */
+static struct bloco *novoBloco(struct pilhaBlocos *pilha) {
+    struct bloco *bloco = pilha->reserva;
+    if (bloco != NULL) {
+        pilha->reserva = NULL;
+        return bloco;
+    }
+
+    bloco = (struct bloco *) malloc(sizeof(struct bloco));
+    if (bloco == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    return bloco;
+}
+
+/**
+ * Guarda um bloco vazio como reserva (liberando a reserva anterior)
+ * @param pilha Ponteiro para a pilha
+ * @param bloco Bloco que ficou vazio
+ */
+static void descartarBloco(struct pilhaBlocos *pilha, struct bloco *bloco) {
+    free(pilha->reserva);
+    pilha->reserva = bloco;
+}
+
+/**
+ * Inicializa uma pilha vazia
+ * @param pilha Ponteiro para a pilha
+ */
+void iniciarPilha(struct pilhaBlocos *pilha) {
+    pilha->topo = NULL;
+    pilha->usados = ITENS_POR_BLOCO;  // Força a alocação no primeiro push
+    pilha->tamanho = 0;
+    pilha->reserva = NULL;
+}
+
+/**
+ * Insere um número no topo da pilha (push)
+ * @param pilha Ponteiro para a pilha
+ * @param numero Valor a ser inserido
+ */
+static inline void push(struct pilhaBlocos *pilha, int numero) {
+    if (pilha->usados == ITENS_POR_BLOCO) {
+        struct bloco *bloco = novoBloco(pilha);
+        bloco->anterior = pilha->topo;
+        pilha->topo = bloco;
+        pilha->usados = 0;
+    }
+    pilha->topo->numeros[pilha->usados++] = numero;
+    pilha->tamanho++;
+}
+
+/**
+ * Remove o número do topo da pilha (pop)
+ * @param pilha Ponteiro para a pilha
+ * @param numero Recebe o valor removido
+ * @return true se removeu, false se a pilha estava vazia
+ */
+static inline bool pop(struct pilhaBlocos *pilha, int *numero) {
+    if (pilha->tamanho == 0) {
+        return false;
+    }
+
+    *numero = pilha->topo->numeros[--pilha->usados];
+    pilha->tamanho--;
+
+    // Bloco do topo esvaziou: desce para o bloco anterior (que está cheio)
+    if (pilha->usados == 0) {
+        struct bloco *vazio = pilha->topo;
+        pilha->topo = vazio->anterior;
+        pilha->usados = ITENS_POR_BLOCO;
+        descartarBloco(pilha, vazio);
+    }
+    return true;
+}
+
+/**
+ * Insere vários números de uma vez (equivale a push de v[0], v[1], ...)
+ * @param pilha Ponteiro para a pilha
+ * @param numeros Vetor com os valores
+ * @param n Quantidade de valores
+ */
+void pushN(struct pilhaBlocos *pilha, const int *numeros, size_t n) {
+    while (n > 0) {
+        if (pilha->usados == ITENS_POR_BLOCO) {
+            struct bloco *bloco = novoBloco(pilha);
+            bloco->anterior = pilha->topo;
+            pilha->topo = bloco;
+            pilha->usados = 0;
+        }
+
+        size_t cabe = ITENS_POR_BLOCO - pilha->usados;
+        size_t k = n < cabe ? n : cabe;
+        memcpy(pilha->topo->numeros + pilha->usados, numeros, k * sizeof(int));
+        pilha->usados += k;
+        pilha->tamanho += k;
+        numeros += k;
+        n -= k;
+    }
+}
+
+/**
+ * Remove vários números de uma vez, na ordem em que pop os devolveria
+ * @param pilha Ponteiro para a pilha
+ * @param numeros Vetor que recebe os valores (numeros[0] era o topo)
+ * @param n Quantidade máxima de valores
+ * @return Quantidade de valores realmente removidos
+ */
+size_t popN(struct pilhaBlocos *pilha, int *numeros, size_t n) {
+    size_t removidos = 0;
+    if (n > pilha->tamanho) {
+        n = pilha->tamanho;
+    }
+
+    while (removidos < n) {
+        size_t k = n - removidos < pilha->usados ? n - removidos : pilha->usados;
+        const int *origem = pilha->topo->numeros + pilha->usados - 1;
+        for (size_t i = 0; i < k; i++) {
+            numeros[removidos + i] = origem[-(long) i];
+        }
+        pilha->usados -= k;
+        pilha->tamanho -= k;
+        removidos += k;
+
+        if (pilha->usados == 0 && pilha->tamanho > 0) {
+            struct bloco *vazio = pilha->topo;
+            pilha->topo = vazio->anterior;
+            pilha->usados = ITENS_POR_BLOCO;
+            descartarBloco(pilha, vazio);
+        }
+    }
+    return removidos;
+}
+
+/**
+ * Imprime todos os elementos da pilha (do topo para a base)
+ * @param pilha Ponteiro para a pilha
+ */
+void imprimir(const struct pilhaBlocos *pilha) {
+    const struct bloco *bloco = pilha->topo;
+    size_t usados = pilha->usados;
+    printf("Pilha: ");
+    if (pilha->tamanho > 0) {
+        while (bloco != NULL) {
+            for (size_t i = usados; i > 0; i--) {
+                printf("%d ", bloco->numeros[i - 1]);
+            }
+            bloco = bloco->anterior;
+            usados = ITENS_POR_BLOCO;
+        }
+    }
+    printf("\n");
+}
+
+/**
+ * Libera toda a memória alocada pela pilha
+ * @param pilha Ponteiro para a pilha
+ */
+void liberarPilha(struct pilhaBlocos *pilha) {
+    while (pilha->topo != NULL) {
+        struct bloco *remover = pilha->topo;
+        pilha->topo = remover->anterior;
+        free(remover);
+    }
+    free(pilha->reserva);
+    iniciarPilha(pilha);
+}
+
+/**
+ * Mede o tempo decorrido em segundos
+ */
+static double segundosDesde(const struct timespec *t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (double) (t1.tv_sec - t0->tv_sec) + (double) (t1.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+// Nó da pilha encadeada de Pilha.c, usado apenas na comparação
+struct no {
+    int numero;
+    struct no *proximo;
+};
+
+int main() {
+    struct pilhaBlocos pilha;
+    int numero;
+    int i;
+
+    iniciarPilha(&pilha);
+
+    // Exemplo de uso com valores menores para teste
+    for (i = 0; i < 10; i++) {
+        push(&pilha, i);
+    }
+
+    printf("Estado inicial da pilha:\n");
+    imprimir(&pilha);
+
+    printf("\nRemovendo elementos:\n");
+    for (i = 0; i < 5; i++) {
+        if (pop(&pilha, &numero)) {
+            printf("Removido: %d\n", numero);
+        }
+    }
+
+    printf("\nEstado final da pilha:\n");
+    imprimir(&pilha);
+    liberarPilha(&pilha);
+
+    // Operações em lote
+    int lote[8] = {10, 20, 30, 40, 50, 60, 70, 80};
+    int saida[8];
+    pushN(&pilha, lote, 8);
+    size_t n = popN(&pilha, saida, 3);
+    printf("\npopN(3) apos pushN(10..80): ");
+    for (size_t k = 0; k < n; k++) {
+        printf("%d ", saida[k]);
+    }
+    printf("\n");
+    imprimir(&pilha);
+    liberarPilha(&pilha);
+
+    // Comparação de desempenho com a pilha encadeada (um malloc por número)
+    const int total = 20000000;
+    struct timespec t0;
+    long long soma = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    struct no *encadeada = NULL;
+    for (i = 0; i < total; i++) {
+        struct no *novoNo = (struct no *) malloc(sizeof(struct no));
+        if (novoNo == NULL) {
+            fprintf(stderr, "Erro na alocação de memória.\n");
+            exit(EXIT_FAILURE);
+        }
+        novoNo->numero = i;
+        novoNo->proximo = encadeada;
+        encadeada = novoNo;
+    }
+    while (encadeada != NULL) {
+        struct no *remover = encadeada;
+        soma += remover->numero;
+        encadeada = remover->proximo;
+        free(remover);
+    }
+    double tempoEncadeada = segundosDesde(&t0);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (i = 0; i < total; i++) {
+        push(&pilha, i);
+    }
+    while (pop(&pilha, &numero)) {
+        soma -= numero;
+    }
+    double tempoBlocos = segundosDesde(&t0);
+    liberarPilha(&pilha);
+
+    printf("\n%d push + %d pop (conferencia: %lld)\n", total, total, soma);
+    printf("Pilha encadeada: %.3f s\n", tempoEncadeada);
+    printf("Pilha em blocos: %.3f s (%.1fx)\n", tempoBlocos, tempoEncadeada / tempoBlocos);
+
+    return 0;
+}
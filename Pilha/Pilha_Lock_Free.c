@@ -0,0 +1,496 @@
+/**
+ * Implementação de Pilha sem Travas (Treiber) com Eliminação em C
+ *
+ * Este código implementa uma pilha compartilhada entre threads sem mutex, onde:
+ * - O topo é um ponteiro atômico alterado por compare-and-swap (pilha de Treiber)
+ * - A memória é recuperada com hazard pointers: antes de ler topo->proximo a
+ *   thread publica o nó que vai acessar, e um nó removido só é liberado
+ *   quando nenhuma thread o publicou. Isso também elimina o problema ABA,
+ *   pois o endereço de um nó protegido nunca é reutilizado
+ * - Quando o CAS no topo falha por disputa, a thread tenta a eliminação:
+ *   um push e um pop simultâneos se encontram em um vetor de trocas e se
+ *   anulam sem tocar no topo
+ *
+ * O main compara a vazão com uma pilha protegida por mutex de 1 a 64 threads.
+ *
+ *   gcc -O2 -pthread Pilha_Lock_Free.c -o pilha_lock_free
+ *   ./pilha_lock_free [operacoes_por_teste]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <stdalign.h>
+#include <pthread.h>
+#include <time.h>
+
+#define LINHA_CACHE 64
+#define MAX_THREADS 128
+#define LIMITE_APOSENTADOS (2 * MAX_THREADS)  // Nós retidos antes de uma varredura
+#define TAMANHO_ELIMINACAO 16
+#define ESPERA_ELIMINACAO 128                 // Iterações aguardando um par
+
+// Marcas especiais do vetor de eliminação
+#define TROCA_VAZIA ((uintptr_t) 0)
+#define TROCA_ENTREGUE ((uintptr_t) 1)
+
+struct no {
+    int numero;
+    struct no *proximo;
+};
+
+// Estado de cada thread registrada na pilha
+struct registroThread {
+    alignas(LINHA_CACHE) _Atomic(struct no *) perigo;  // Hazard pointer publicado
+    struct no *aposentados[LIMITE_APOSENTADOS];        // Nós removidos aguardando liberação
+    size_t quantidadeAposentados;
+    uint64_t semente;                                  // Gerador para escolher a troca
+};
+
+// Posição do vetor de eliminação
+struct troca {
+    alignas(LINHA_CACHE) atomic_uintptr_t valor;
+};
+
+// Estrutura da pilha sem travas
+struct pilhaLockFree {
+    alignas(LINHA_CACHE) _Atomic(struct no *) topo;
+    struct troca eliminacao[TAMANHO_ELIMINACAO];
+    alignas(LINHA_CACHE) atomic_int threadsRegistradas;
+    struct registroThread registros[MAX_THREADS];
+};
+
+/**
+ * Cria uma pilha sem travas vazia
+ * @return Ponteiro para a nova pilha
+ */
+struct pilhaLockFree *criarPilhaLockFree(void) {
+    struct pilhaLockFree *pilha = (struct pilhaLockFree *) aligned_alloc(LINHA_CACHE, sizeof(struct pilhaLockFree));
+    if (pilha == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    atomic_init(&pilha->topo, NULL);
+    atomic_init(&pilha->threadsRegistradas, 0);
+    for (int i = 0; i < TAMANHO_ELIMINACAO; i++) {
+        atomic_init(&pilha->eliminacao[i].valor, TROCA_VAZIA);
+    }
+    for (int i = 0; i < MAX_THREADS; i++) {
+        atomic_init(&pilha->registros[i].perigo, NULL);
+        pilha->registros[i].quantidadeAposentados = 0;
+        pilha->registros[i].semente = 0x9E3779B97F4A7C15ull * (uint64_t) (i + 1);
+    }
+    return pilha;
+}
+
+/**
+ * Registra a thread atual na pilha
+ * @param pilha Ponteiro para a pilha
+ * @return Identificador da thread, usado nas demais operações
+ */
+int registrarThread(struct pilhaLockFree *pilha) {
+    int id = atomic_fetch_add(&pilha->threadsRegistradas, 1);
+    if (id >= MAX_THREADS) {
+        fprintf(stderr, "Limite de %d threads excedido.\n", MAX_THREADS);
+        exit(EXIT_FAILURE);
+    }
+    return id;
+}
+
+/**
+ * Sorteia uma posição do vetor de eliminação (xorshift)
+ * @param registro Estado da thread
+ * @return Índice da troca
+ */
+static inline int sortearTroca(struct registroThread *registro) {
+    uint64_t x = registro->semente;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    registro->semente = x;
+    return (int) (x % TAMANHO_ELIMINACAO);
+}
+
+/**
+ * Compara ponteiros (para qsort e bsearch)
+ */
+static int compararPonteiros(const void *a, const void *b) {
+    uintptr_t x = (uintptr_t) *(struct no * const *) a;
+    uintptr_t y = (uintptr_t) *(struct no * const *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Libera os nós aposentados que nenhuma thread protege
+ * @param pilha Ponteiro para a pilha
+ * @param registro Estado da thread que faz a varredura
+ */
+static void varrerAposentados(struct pilhaLockFree *pilha, struct registroThread *registro) {
+    struct no *protegidos[MAX_THREADS];
+    int registradas = atomic_load(&pilha->threadsRegistradas);
+    size_t quantidade = 0;
+
+    if (registradas > MAX_THREADS) {
+        registradas = MAX_THREADS;
+    }
+    for (int i = 0; i < registradas; i++) {
+        struct no *p = atomic_load(&pilha->registros[i].perigo);
+        if (p != NULL) {
+            protegidos[quantidade++] = p;
+        }
+    }
+    qsort(protegidos, quantidade, sizeof(struct no *), compararPonteiros);
+
+    size_t mantidos = 0;
+    for (size_t i = 0; i < registro->quantidadeAposentados; i++) {
+        struct no *candidato = registro->aposentados[i];
+        if (bsearch(&candidato, protegidos, quantidade, sizeof(struct no *), compararPonteiros)) {
+            registro->aposentados[mantidos++] = candidato;
+        } else {
+            free(candidato);
+        }
+    }
+    registro->quantidadeAposentados = mantidos;
+}
+
+/**
+ * Marca um nó removido para liberação futura
+ * @param pilha Ponteiro para a pilha
+ * @param registro Estado da thread
+ * @param no Nó removido
+ */
+static inline void aposentar(struct pilhaLockFree *pilha, struct registroThread *registro, struct no *no) {
+    registro->aposentados[registro->quantidadeAposentados++] = no;
+    if (registro->quantidadeAposentados == LIMITE_APOSENTADOS) {
+        varrerAposentados(pilha, registro);
+    }
+}
+
+/**
+ * Oferece um nó no vetor de eliminação, esperando um pop para recebê-lo
+ * @param pilha Ponteiro para a pilha
+ * @param registro Estado da thread
+ * @param novoNo Nó a entregar
+ * @return true se um pop recebeu o nó
+ */
+static bool eliminarPush(struct pilhaLockFree *pilha, struct registroThread *registro, struct no *novoNo) {
+    atomic_uintptr_t *troca = &pilha->eliminacao[sortearTroca(registro)].valor;
+    uintptr_t esperado = TROCA_VAZIA;
+
+    if (!atomic_compare_exchange_strong(troca, &esperado, (uintptr_t) novoNo)) {
+        return false;
+    }
+
+    for (int i = 0; i < ESPERA_ELIMINACAO; i++) {
+        if (atomic_load_explicit(troca, memory_order_acquire) == TROCA_ENTREGUE) {
+            atomic_store_explicit(troca, TROCA_VAZIA, memory_order_release);
+            return true;
+        }
+    }
+
+    // Ninguém apareceu: tenta retirar a oferta
+    esperado = (uintptr_t) novoNo;
+    if (atomic_compare_exchange_strong(troca, &esperado, TROCA_VAZIA)) {
+        return false;
+    }
+    // Um pop levou o nó entre a espera e a retirada
+    atomic_store_explicit(troca, TROCA_VAZIA, memory_order_release);
+    return true;
+}
+
+/**
+ * Procura uma oferta de push no vetor de eliminação
+ * @param pilha Ponteiro para a pilha
+ * @param registro Estado da thread
+ * @return Nó recebido ou NULL
+ */
+static struct no *eliminarPop(struct pilhaLockFree *pilha, struct registroThread *registro) {
+    atomic_uintptr_t *troca = &pilha->eliminacao[sortearTroca(registro)].valor;
+
+    for (int i = 0; i < ESPERA_ELIMINACAO; i++) {
+        uintptr_t oferta = atomic_load_explicit(troca, memory_order_acquire);
+        if (oferta != TROCA_VAZIA && oferta != TROCA_ENTREGUE) {
+            // Se o CAS vencer, a oferta estava viva e o nó agora é desta thread
+            if (atomic_compare_exchange_strong(troca, &oferta, TROCA_ENTREGUE)) {
+                return (struct no *) oferta;
+            }
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Insere um número no topo da pilha (push)
+ * @param pilha Ponteiro para a pilha
+ * @param id Identificador da thread (registrarThread)
+ * @param numero Valor a ser inserido
+ */
+void pushLockFree(struct pilhaLockFree *pilha, int id, int numero) {
+    struct no *novoNo = (struct no *) malloc(sizeof(struct no));
+    if (novoNo == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    novoNo->numero = numero;
+    novoNo->proximo = atomic_load_explicit(&pilha->topo, memory_order_relaxed);
+
+    for (;;) {
+        if (atomic_compare_exchange_weak_explicit(&pilha->topo, &novoNo->proximo, novoNo,
+                                                  memory_order_release, memory_order_relaxed)) {
+            return;
+        }
+        // Disputa no topo: tenta se anular com um pop concorrente
+        if (eliminarPush(pilha, &pilha->registros[id], novoNo)) {
+            return;
+        }
+        novoNo->proximo = atomic_load_explicit(&pilha->topo, memory_order_relaxed);
+    }
+}
+
+/**
+ * Remove o número do topo da pilha (pop)
+ * @param pilha Ponteiro para a pilha
+ * @param id Identificador da thread (registrarThread)
+ * @param numero Recebe o valor removido
+ * @return true se removeu, false se a pilha estava vazia
+ */
+bool popLockFree(struct pilhaLockFree *pilha, int id, int *numero) {
+    struct registroThread *registro = &pilha->registros[id];
+    struct no *topo;
+
+    for (;;) {
+        topo = atomic_load_explicit(&pilha->topo, memory_order_acquire);
+        if (topo == NULL) {
+            atomic_store_explicit(&registro->perigo, NULL, memory_order_release);
+            return false;
+        }
+
+        // Publica o nó e confirma que ele ainda é o topo antes de acessá-lo
+        atomic_store(&registro->perigo, topo);
+        if (atomic_load(&pilha->topo) != topo) {
+            continue;
+        }
+
+        struct no *proximo = topo->proximo;
+        if (atomic_compare_exchange_weak_explicit(&pilha->topo, &topo, proximo,
+                                                  memory_order_acquire, memory_order_relaxed)) {
+            break;
+        }
+
+        struct no *recebido = eliminarPop(pilha, registro);
+        if (recebido != NULL) {
+            topo = recebido;
+            break;
+        }
+    }
+
+    atomic_store_explicit(&registro->perigo, NULL, memory_order_release);
+    *numero = topo->numero;
+    aposentar(pilha, registro, topo);
+    return true;
+}
+
+/**
+ * Libera toda a memória da pilha (nenhuma thread pode estar usando-a)
+ * @param pilha Ponteiro para a pilha
+ */
+void liberarPilhaLockFree(struct pilhaLockFree *pilha) {
+    struct no *atual = atomic_load(&pilha->topo);
+    while (atual != NULL) {
+        struct no *remover = atual;
+        atual = atual->proximo;
+        free(remover);
+    }
+    for (int i = 0; i < MAX_THREADS; i++) {
+        for (size_t j = 0; j < pilha->registros[i].quantidadeAposentados; j++) {
+            free(pilha->registros[i].aposentados[j]);
+        }
+    }
+    free(pilha);
+}
+
+// Pilha protegida por mutex, usada como referência na comparação
+struct pilhaTravada {
+    pthread_mutex_t trava;
+    struct no *topo;
+};
+
+/**
+ * Insere um número na pilha com mutex
+ */
+void pushTravada(struct pilhaTravada *pilha, int numero) {
+    struct no *novoNo = (struct no *) malloc(sizeof(struct no));
+    if (novoNo == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    novoNo->numero = numero;
+    pthread_mutex_lock(&pilha->trava);
+    novoNo->proximo = pilha->topo;
+    pilha->topo = novoNo;
+    pthread_mutex_unlock(&pilha->trava);
+}
+
+/**
+ * Remove o número do topo da pilha com mutex
+ */
+bool popTravada(struct pilhaTravada *pilha, int *numero) {
+    pthread_mutex_lock(&pilha->trava);
+    struct no *remover = pilha->topo;
+    if (remover != NULL) {
+        pilha->topo = remover->proximo;
+    }
+    pthread_mutex_unlock(&pilha->trava);
+
+    if (remover == NULL) {
+        return false;
+    }
+    *numero = remover->numero;
+    free(remover);
+    return true;
+}
+
+// Parâmetros de cada thread do teste de disputa
+struct parametrosTeste {
+    struct pilhaLockFree *lockFree;
+    struct pilhaTravada *travada;
+    long operacoes;
+    long long saldo;   // Soma dos inseridos menos soma dos removidos
+};
+
+/**
+ * Thread do teste: alterna push e pop aleatoriamente na pilha sem travas
+ */
+static void *trabalharLockFree(void *arg) {
+    struct parametrosTeste *p = (struct parametrosTeste *) arg;
+    int id = registrarThread(p->lockFree);
+    uint64_t x = 0x2545F4914F6CDD1Dull * (uint64_t) (id + 1);
+    int numero;
+
+    for (long i = 0; i < p->operacoes; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        if (x & 1) {
+            numero = (int) (x >> 40);
+            pushLockFree(p->lockFree, id, numero);
+            p->saldo += numero;
+        } else if (popLockFree(p->lockFree, id, &numero)) {
+            p->saldo -= numero;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Thread do teste: alterna push e pop aleatoriamente na pilha com mutex
+ */
+static void *trabalharTravada(void *arg) {
+    struct parametrosTeste *p = (struct parametrosTeste *) arg;
+    uint64_t x = 0x2545F4914F6CDD1Dull * (uint64_t) ((uintptr_t) arg | 1);
+    int numero;
+
+    for (long i = 0; i < p->operacoes; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        if (x & 1) {
+            numero = (int) (x >> 40);
+            pushTravada(p->travada, numero);
+            p->saldo += numero;
+        } else if (popTravada(p->travada, &numero)) {
+            p->saldo -= numero;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Executa um teste de disputa com n threads
+ * @param lockFree true para a pilha sem travas, false para a pilha com mutex
+ * @param threads Quantidade de threads
+ * @param total Operações somadas de todas as threads
+ * @param saldoCorreto Recebe se o conteúdo final confere com as operações
+ * @return Milhões de operações por segundo
+ */
+static double executarTeste(bool lockFree, int threads, long total, bool *saldoCorreto) {
+    struct pilhaLockFree *pilhaLF = criarPilhaLockFree();
+    struct pilhaTravada pilhaT = {PTHREAD_MUTEX_INITIALIZER, NULL};
+    pthread_t ids[MAX_THREADS];
+    struct parametrosTeste params[MAX_THREADS];
+    struct timespec t0, t1;
+
+    for (int i = 0; i < threads; i++) {
+        params[i].lockFree = pilhaLF;
+        params[i].travada = &pilhaT;
+        params[i].operacoes = total / threads;
+        params[i].saldo = 0;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < threads; i++) {
+        pthread_create(&ids[i], NULL, lockFree ? trabalharLockFree : trabalharTravada, &params[i]);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(ids[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    // Confere: o que sobrou na pilha deve somar o saldo de todas as threads
+    long long saldo = 0, restante = 0;
+    int numero;
+    for (int i = 0; i < threads; i++) {
+        saldo += params[i].saldo;
+    }
+    if (lockFree) {
+        int id = registrarThread(pilhaLF);
+        while (popLockFree(pilhaLF, id, &numero)) {
+            restante += numero;
+        }
+    } else {
+        while (popTravada(&pilhaT, &numero)) {
+            restante += numero;
+        }
+    }
+    *saldoCorreto = saldo == restante;
+
+    liberarPilhaLockFree(pilhaLF);
+    double segundos = (double) (t1.tv_sec - t0.tv_sec) + (double) (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    return (double) (total / threads * threads) / segundos / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+    long total = argc > 1 ? atol(argv[1]) : 4000000;
+    int numero;
+
+    // Exemplo de uso em uma única thread
+    struct pilhaLockFree *pilha = criarPilhaLockFree();
+    int id = registrarThread(pilha);
+    for (int i = 0; i < 10; i++) {
+        pushLockFree(pilha, id, i);
+    }
+    printf("Removendo elementos:\n");
+    for (int i = 0; i < 5; i++) {
+        if (popLockFree(pilha, id, &numero)) {
+            printf("Removido: %d\n", numero);
+        }
+    }
+    liberarPilhaLockFree(pilha);
+
+    // Comparação de vazão sob disputa
+    printf("\n%ld operacoes (50%% push, 50%% pop) por teste\n", total);
+    printf("Threads | Lock-free (Mops/s) | Mutex (Mops/s)\n");
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        bool corretoLF, corretoT;
+        double vazaoLF = executarTeste(true, threads, total, &corretoLF);
+        double vazaoT = executarTeste(false, threads, total, &corretoT);
+        printf("%7d | %18.2f | %14.2f%s\n", threads, vazaoLF, vazaoT,
+               corretoLF && corretoT ? "" : "  (CONTEUDO INCORRETO)");
+    }
+
+    return 0;
+}
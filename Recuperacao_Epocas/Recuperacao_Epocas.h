@@ -0,0 +1,195 @@
+/**
+ * Recuperação de Memória por Épocas em C
+ *
+ * Estruturas sem travas não podem dar free em um nó assim que o desligam:
+ * outra thread pode ter lido o ponteiro antes e ainda estar com o nó em
+ * mãos. Este módulo adia a liberação, onde:
+ * - Cada operação anuncia a época global em que entrou e, ao sair, deixa de
+ *   anunciar época alguma
+ * - Um nó desligado vai para a sacola da época global lida logo após
+ *   desligá-lo; cada thread tem três sacolas, indexadas por época % 3
+ * - A época global só avança quando todas as threads ativas já a anunciaram,
+ *   então uma sacola de duas épocas atrás não pode mais ser vista por
+ *   ninguém e é liberada
+ *
+ * Os nós são de qualquer tipo alocado com malloc: basta um campo
+ * struct noAposentado, cujo deslocamento é informado em iniciarEpocas().
+ *
+ * Uso:
+ *   struct no { int numero; struct noAposentado aposentado; ... };
+ *   iniciarEpocas(&dominio, MAX_THREADS, offsetof(struct no, aposentado));
+ *   struct registroThread *registro = &dominio.registros[id];
+ *   entrarEpoca(&dominio, registro);
+ *   ... desliga um nó ...
+ *   aposentar(&dominio, registro, no);
+ *   sairEpoca(registro);
+ *   finalizarEpocas(&dominio);
+ *
+ * Usado por Lista_Lock_Free.c e Lista_Skip_Concorrente.c. Todas as funções
+ * são static inline: o arquivo é incluído por cada programa.
+ */
+
+#ifndef RECUPERACAO_EPOCAS_H
+#define RECUPERACAO_EPOCAS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <stdalign.h>
+
+#ifndef LINHA_CACHE
+#define LINHA_CACHE 64
+#endif
+#define LIMITE_SACOLA 64        // Nós aposentados antes de tentar avançar a época
+#define FORA_DE_EPOCA UINT64_MAX
+
+// Encadeamento embutido no nó aposentado
+struct noAposentado {
+    struct noAposentado *proximo;
+};
+
+// Nós aposentados em uma mesma época global
+struct sacola {
+    struct noAposentado *nos;
+    uint64_t epoca;
+};
+
+// Estado de cada thread que usa a estrutura
+struct registroThread {
+    alignas(LINHA_CACHE) _Atomic uint64_t epoca;  // Época anunciada ou FORA_DE_EPOCA
+    struct sacola sacolas[3];                     // Indexadas por época % 3
+    size_t quantidadeSacola;
+};
+
+// Épocas de uma estrutura compartilhada
+struct dominioEpocas {
+    alignas(LINHA_CACHE) _Atomic uint64_t epocaGlobal;
+    int maxThreads;
+    size_t deslocamento;        // Posição do struct noAposentado dentro do nó
+    struct registroThread *registros;
+};
+
+/**
+ * Inicializa um domínio de épocas
+ * @param dominio Ponteiro para o domínio
+ * @param maxThreads Quantidade de registros (um por thread ativa)
+ * @param deslocamento offsetof do campo struct noAposentado no nó
+ */
+static inline void iniciarEpocas(struct dominioEpocas *dominio, int maxThreads, size_t deslocamento) {
+    dominio->registros = (struct registroThread *) aligned_alloc(LINHA_CACHE,
+                                                                 (size_t) maxThreads * sizeof(struct registroThread));
+    if (dominio->registros == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    atomic_init(&dominio->epocaGlobal, 0);
+    dominio->maxThreads = maxThreads;
+    dominio->deslocamento = deslocamento;
+    for (int i = 0; i < maxThreads; i++) {
+        atomic_init(&dominio->registros[i].epoca, FORA_DE_EPOCA);
+        for (int j = 0; j < 3; j++) {
+            dominio->registros[i].sacolas[j] = (struct sacola) {NULL, 0};
+        }
+        dominio->registros[i].quantidadeSacola = 0;
+    }
+}
+
+/**
+ * Libera uma sacola de nós aposentados
+ * @param dominio Ponteiro para o domínio
+ * @param sacola Sacola a ser esvaziada
+ */
+static inline void liberarSacola(const struct dominioEpocas *dominio, struct sacola *sacola) {
+    struct noAposentado *atual = sacola->nos;
+    while (atual != NULL) {
+        struct noAposentado *remover = atual;
+        atual = atual->proximo;
+        free((char *) remover - dominio->deslocamento);
+    }
+    sacola->nos = NULL;
+}
+
+/**
+ * Anuncia a entrada da thread em uma operação
+ * Sacolas de duas ou mais épocas atrás já não podem ser vistas por
+ * ninguém e são liberadas.
+ * @param dominio Ponteiro para o domínio
+ * @param registro Estado da thread
+ */
+static inline void entrarEpoca(struct dominioEpocas *dominio, struct registroThread *registro) {
+    uint64_t epoca = atomic_load(&dominio->epocaGlobal);
+    atomic_store(&registro->epoca, epoca);
+
+    for (int i = 0; i < 3; i++) {
+        struct sacola *sacola = &registro->sacolas[i];
+        if (sacola->nos != NULL && sacola->epoca + 2 <= epoca) {
+            liberarSacola(dominio, sacola);
+        }
+    }
+}
+
+/**
+ * Anuncia a saída da thread da operação
+ * @param registro Estado da thread
+ */
+static inline void sairEpoca(struct registroThread *registro) {
+    atomic_store_explicit(&registro->epoca, FORA_DE_EPOCA, memory_order_release);
+}
+
+/**
+ * Avança a época global se todas as threads ativas já estão nela
+ * @param dominio Ponteiro para o domínio
+ */
+static inline void tentarAvancarEpoca(struct dominioEpocas *dominio) {
+    uint64_t epoca = atomic_load(&dominio->epocaGlobal);
+    for (int i = 0; i < dominio->maxThreads; i++) {
+        uint64_t anunciada = atomic_load(&dominio->registros[i].epoca);
+        if (anunciada != FORA_DE_EPOCA && anunciada != epoca) {
+            return;
+        }
+    }
+    atomic_compare_exchange_strong(&dominio->epocaGlobal, &epoca, epoca + 1);
+}
+
+/**
+ * Coloca um nó desligado na sacola da época global atual
+ * A época é lida depois de desligar o nó: uma thread que entrou na época
+ * seguinte antes do desligamento ainda pode estar com o nó em mãos.
+ * @param dominio Ponteiro para o domínio
+ * @param registro Estado da thread
+ * @param no Nó desligado da estrutura
+ */
+static inline void aposentar(struct dominioEpocas *dominio, struct registroThread *registro, void *no) {
+    uint64_t epoca = atomic_load(&dominio->epocaGlobal);
+    struct sacola *sacola = &registro->sacolas[epoca % 3];
+    if (sacola->epoca != epoca) {
+        // Sacola de três épocas atrás: já pode ser liberada
+        liberarSacola(dominio, sacola);
+        sacola->epoca = epoca;
+    }
+    struct noAposentado *aposentado = (struct noAposentado *) ((char *) no + dominio->deslocamento);
+    aposentado->proximo = sacola->nos;
+    sacola->nos = aposentado;
+    if (++registro->quantidadeSacola >= LIMITE_SACOLA) {
+        tentarAvancarEpoca(dominio);
+        registro->quantidadeSacola = 0;
+    }
+}
+
+/**
+ * Libera todos os nós aposentados e os registros (sem outras threads em uso)
+ * @param dominio Ponteiro para o domínio
+ */
+static inline void finalizarEpocas(struct dominioEpocas *dominio) {
+    for (int i = 0; i < dominio->maxThreads; i++) {
+        for (int j = 0; j < 3; j++) {
+            liberarSacola(dominio, &dominio->registros[i].sacolas[j]);
+        }
+    }
+    free(dominio->registros);
+    dominio->registros = NULL;
+}
+
+#endif
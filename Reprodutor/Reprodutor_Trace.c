@@ -0,0 +1,334 @@
+/**
+ * Reprodutor de Traces para as Estruturas com Menu em C
+ *
+ * Fila.c, Lista_Circular.c e Lista_Duplamente_Encadeada.c só funcionam pelo
+ * menu interativo (scanf), uma operação por vez. Este programa inclui o
+ * código de uma delas (escolhida na compilação), lê um trace de operações
+ * de um arquivo ou da entrada padrão e o aplica diretamente às funções da
+ * estrutura, medindo:
+ * - Vazão (operações por segundo)
+ * - Latência por operação (percentis via histograma HDR)
+ * - Pico de memória residente do processo
+ *
+ * Formato do trace (uma operação por linha, '#' inicia comentário):
+ *   i <numero>   ou  1 <numero>   Inserir (entrar, na fila)
+ *   r <numero>   ou  2 <numero>   Remover (na fila o número é ignorado)
+ *   p            ou  3            Imprimir
+ * Os códigos numéricos são os mesmos do menu de cada estrutura.
+ *
+ * Compilação (escolha uma estrutura):
+ *   gcc -O2 -DESTRUTURA_FILA Reprodutor_Trace.c -o reprodutor_fila
+ *   gcc -O2 -DESTRUTURA_LISTA_CIRCULAR Reprodutor_Trace.c -o reprodutor_circular
+ *   gcc -O2 -DESTRUTURA_LISTA_ENCADEADA Reprodutor_Trace.c -o reprodutor_lista
+ *
+ * Uso:
+ *   ./reprodutor_fila [-v] [arquivo|-]   Reproduz o trace (-v mostra a saída da estrutura)
+ *   ./reprodutor_fila -g N [semente]     Gera um trace aleatório com N operações
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "../Histograma_HDR/Histograma_HDR.h"
+
+// Inclui a estrutura escolhida, renomeando seu main interativo
+#define main mainEstrutura
+#if defined(ESTRUTURA_LISTA_CIRCULAR)
+#include "../Lista_Circular/Lista_Circular.c"
+#define NOME_ESTRUTURA "Lista Circular"
+#define OP_INSERIR(e, n) ((e) = inserir((e), (n)))
+#define OP_REMOVER(e, n) ((e) = remover((e), (n)))
+#elif defined(ESTRUTURA_LISTA_ENCADEADA)
+#include "../Lista_Encadeada/Lista_Duplamente_Encadeada.c"
+#define NOME_ESTRUTURA "Lista Duplamente Encadeada"
+#define OP_INSERIR(e, n) ((e) = inserir((e), (n)))
+#define OP_REMOVER(e, n) ((e) = remover((e), (n)))
+#else
+#include "../Fila/Fila.c"
+#define NOME_ESTRUTURA "Fila"
+#define OP_INSERIR(e, n) ((e) = entrar((e), (n)))
+#define OP_REMOVER(e, n) ((void) (n), (e) = sair((e), NULL))
+#endif
+#define OP_IMPRIMIR(e) imprimir(e)
+#undef main
+
+#define TAMANHO_BUFFER (1 << 20)
+
+// Tipos de operação do trace
+enum tipoOperacao {
+    OP_TIPO_INSERIR,
+    OP_TIPO_REMOVER,
+    OP_TIPO_IMPRIMIR
+};
+
+// Operação já decodificada
+struct operacao {
+    int tipo;
+    int numero;
+};
+
+// Vetor dinâmico de operações
+struct trace {
+    struct operacao *operacoes;
+    size_t quantidade;
+    size_t capacidade;
+    size_t linhasInvalidas;
+};
+
+/**
+ * Lê o relógio monotônico
+ * @return Instante atual em nanossegundos
+ */
+static inline uint64_t agoraNs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t) t.tv_sec * 1000000000u + (uint64_t) t.tv_nsec;
+}
+
+/**
+ * Acrescenta uma operação ao trace
+ * @param t Ponteiro para o trace
+ * @param tipo Tipo da operação
+ * @param numero Operando
+ */
+static void adicionarOperacao(struct trace *t, int tipo, int numero) {
+    if (t->quantidade == t->capacidade) {
+        t->capacidade = t->capacidade ? t->capacidade * 2 : 4096;
+        t->operacoes = (struct operacao *) realloc(t->operacoes, t->capacidade * sizeof(struct operacao));
+        if (t->operacoes == NULL) {
+            fprintf(stderr, "Erro na alocação de memória.\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    t->operacoes[t->quantidade].tipo = tipo;
+    t->operacoes[t->quantidade].numero = numero;
+    t->quantidade++;
+}
+
+/**
+ * Decodifica uma linha do trace (sem o '\n')
+ * @param t Ponteiro para o trace
+ * @param p Início da linha
+ * @param fim Fim da linha (exclusivo)
+ */
+static void decodificarLinha(struct trace *t, const char *p, const char *fim) {
+    while (p < fim && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+    if (p == fim || *p == '#') {
+        return;
+    }
+
+    int tipo;
+    switch (*p) {
+        case 'i': case 'I': case '1': tipo = OP_TIPO_INSERIR; break;
+        case 'r': case 'R': case '2': tipo = OP_TIPO_REMOVER; break;
+        case 'p': case 'P': case '3': tipo = OP_TIPO_IMPRIMIR; break;
+        default:
+            t->linhasInvalidas++;
+            return;
+    }
+    p++;
+
+    // Conversão manual do operando, muito mais barata que scanf/strtol
+    while (p < fim && (*p == ' ' || *p == '\t')) p++;
+    bool negativo = false;
+    if (p < fim && (*p == '-' || *p == '+')) {
+        negativo = *p == '-';
+        p++;
+    }
+    bool temDigito = false;
+    bool foraDoInt = false;
+    long long limite = negativo ? -(long long) INT_MIN : INT_MAX;
+    long long valor = 0;
+    while (p < fim && *p >= '0' && *p <= '9') {
+        // Para de acumular ao passar do limite: o valor não é truncado em silêncio
+        if (!foraDoInt) {
+            valor = valor * 10 + (*p - '0');
+            foraDoInt = valor > limite;
+        }
+        temDigito = true;
+        p++;
+    }
+
+    if ((!temDigito && tipo == OP_TIPO_INSERIR) || foraDoInt) {
+        t->linhasInvalidas++;
+        return;
+    }
+    adicionarOperacao(t, tipo, (int) (negativo ? -valor : valor));
+}
+
+/**
+ * Lê e decodifica um trace inteiro em blocos grandes
+ * @param arquivo Arquivo de entrada
+ * @param t Ponteiro para o trace de destino
+ */
+static void lerTrace(FILE *arquivo, struct trace *t) {
+    char *buffer = (char *) malloc(TAMANHO_BUFFER);
+    size_t sobra = 0;
+    if (buffer == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (;;) {
+        size_t lidos = fread(buffer + sobra, 1, TAMANHO_BUFFER - sobra, arquivo);
+        size_t total = sobra + lidos;
+        bool acabou = lidos == 0;
+        const char *inicio = buffer;
+        const char *fim = buffer + total;
+        const char *quebra;
+
+        while ((quebra = memchr(inicio, '\n', (size_t) (fim - inicio))) != NULL) {
+            decodificarLinha(t, inicio, quebra);
+            inicio = quebra + 1;
+        }
+
+        // Linha incompleta: guarda para o próximo bloco (ou processa no fim)
+        sobra = (size_t) (fim - inicio);
+        if (acabou || sobra == TAMANHO_BUFFER) {
+            decodificarLinha(t, inicio, fim);
+            sobra = 0;
+            if (acabou) break;
+        }
+        memmove(buffer, inicio, sobra);
+    }
+    free(buffer);
+}
+
+/**
+ * Gera um trace aleatório na saída padrão
+ * @param quantidade Número de operações
+ * @param semente Semente do gerador
+ */
+static void gerarTrace(size_t quantidade, unsigned semente) {
+    uint64_t estado = semente * 6364136223846793005ull + 1442695040888963407ull;
+    for (size_t i = 0; i < quantidade; i++) {
+        estado ^= estado << 13;
+        estado ^= estado >> 7;
+        estado ^= estado << 17;
+        unsigned sorteio = (unsigned) (estado % 100);
+        int numero = (int) ((estado >> 32) % 1000000);
+        if (sorteio < 60) {
+            printf("i %d\n", numero);
+        } else {
+            printf("r %d\n", numero);
+        }
+    }
+}
+
+/**
+ * Retorna o pico de memória residente do processo
+ * @return Pico em kilobytes
+ */
+static long picoMemoriaKB(void) {
+    struct rusage uso;
+    getrusage(RUSAGE_SELF, &uso);
+    return uso.ru_maxrss;
+}
+
+int main(int argc, char *argv[]) {
+    bool verboso = false;
+    const char *caminho = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+            unsigned semente = i + 2 < argc ? (unsigned) atoi(argv[i + 2]) : 1u;
+            gerarTrace(strtoull(argv[i + 1], NULL, 10), semente);
+            return 0;
+        } else if (strcmp(argv[i], "-v") == 0) {
+            verboso = true;
+        } else {
+            caminho = argv[i];
+        }
+    }
+
+    FILE *arquivo = stdin;
+    if (caminho != NULL && strcmp(caminho, "-") != 0) {
+        arquivo = fopen(caminho, "rb");
+        if (arquivo == NULL) {
+            fprintf(stderr, "Erro ao abrir %s\n", caminho);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Decodifica todo o trace antes de medir
+    struct trace trace = {NULL, 0, 0, 0};
+    uint64_t t0 = agoraNs();
+    lerTrace(arquivo, &trace);
+    double segundosLeitura = (double) (agoraNs() - t0) / 1e9;
+    if (arquivo != stdin) {
+        fclose(arquivo);
+    }
+    long memoriaBase = picoMemoriaKB();
+
+    // Sem -v, descarta o que a estrutura imprime a cada operação
+    int saidaOriginal = -1;
+    fflush(stdout);
+    if (!verboso) {
+        int nulo = open("/dev/null", O_WRONLY);
+        saidaOriginal = dup(STDOUT_FILENO);
+        dup2(nulo, STDOUT_FILENO);
+        close(nulo);
+    }
+
+    struct histograma *latencias = (struct histograma *) malloc(sizeof(struct histograma));
+    if (latencias == NULL) {
+        fprintf(stderr, "Erro na alocação de memória.\n");
+        return EXIT_FAILURE;
+    }
+    zerarHistograma(latencias);
+
+    struct no *estrutura = NULL;
+    size_t contagem[3] = {0, 0, 0};
+    uint64_t inicio = agoraNs();
+    for (size_t i = 0; i < trace.quantidade; i++) {
+        const struct operacao *op = &trace.operacoes[i];
+        uint64_t antes = agoraNs();
+        switch (op->tipo) {
+            case OP_TIPO_INSERIR:
+                OP_INSERIR(estrutura, op->numero);
+                break;
+            case OP_TIPO_REMOVER:
+                OP_REMOVER(estrutura, op->numero);
+                break;
+            case OP_TIPO_IMPRIMIR:
+                OP_IMPRIMIR(estrutura);
+                break;
+        }
+        registrarHistograma(latencias, agoraNs() - antes);
+        contagem[op->tipo]++;
+    }
+    double segundos = (double) (agoraNs() - inicio) / 1e9;
+
+    fflush(stdout);
+    if (saidaOriginal >= 0) {
+        dup2(saidaOriginal, STDOUT_FILENO);
+        close(saidaOriginal);
+    }
+
+    printf("Estrutura: %s\n", NOME_ESTRUTURA);
+    printf("Operacoes: %zu (inserir=%zu remover=%zu imprimir=%zu, linhas invalidas=%zu)\n",
+           trace.quantidade, contagem[OP_TIPO_INSERIR], contagem[OP_TIPO_REMOVER],
+           contagem[OP_TIPO_IMPRIMIR], trace.linhasInvalidas);
+    printf("Leitura do trace: %.3f s\n", segundosLeitura);
+    printf("Reproducao: %.3f s - %.0f ops/s\n", segundos,
+           segundos > 0 ? (double) trace.quantidade / segundos : 0.0);
+    printf("Latencia (ns): p50=%llu p90=%llu p99=%llu p99.9=%llu max=%llu\n",
+           (unsigned long long) percentilHistograma(latencias, 50.0),
+           (unsigned long long) percentilHistograma(latencias, 90.0),
+           (unsigned long long) percentilHistograma(latencias, 99.0),
+           (unsigned long long) percentilHistograma(latencias, 99.9),
+           (unsigned long long) latencias->maximo);
+    printf("Pico de memoria: %ld KB (%ld KB apos ler o trace)\n", picoMemoriaKB(), memoriaBase);
+
+    free(latencias);
+    free(trace.operacoes);
+    return 0;
+}